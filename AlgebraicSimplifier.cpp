@@ -0,0 +1,397 @@
+/*
+ * AlgebraicSimplifier.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ *
+ * Compile time pass over a type checked, constant folded ExprTreeNode tree that
+ * drops OPR8Rs that can't change their operand (x * 1, x + 0, x | 0, x << 0,
+ * !!b) and swaps in cheaper OPR8Rs where the result is guaranteed identical.
+ *
+ * [*][count][0x8]  ->  [<<][count][3]
+ * [%][count][0x8]  ->  [&][count][7]
+ * [*][count][2]    ->  [B+][count][count]
+ *
+ * Every rule lives in the rules table built by the constructor, along with the
+ * data type categories the literal and the other operand have to be limited to
+ * for RunTimeInterpreter::execStandardMath et al. to come up with the same
+ * result - e.g. an unsigned [/] never promotes to a DOUBLE, but a signed one can,
+ * so only unsigned division by an unsigned gets turned into a [>>].
+ *
+ * An OPR8R result is usually shrunk down to the smallest data type that holds
+ * the value, so [x * 1] isn't necessarily the same width as [x].  [~] is the
+ * only OPR8R that cares, so operands of [~] don't get their OPR8R dropped.
+ */
+
+#include "AlgebraicSimplifier.h"
+#include <iostream>
+#include "InfoWarnError.h"
+#include "OpCodes.h"
+#include "TypeChecker.h"
+#include "common.h"
+
+/* ****************************************************************************
+ * Rules are tried in order; 1st match wins
+ * ***************************************************************************/
+AlgebraicSimplifier::AlgebraicSimplifier(const CompileExecTerms & inExecTerms, std::shared_ptr<UserMessages> userMessages)
+  : execTerms (inExecTerms)
+  , rules {
+    // Decimal literals are signed and hex literals are unsigned.  Mixing signed & unsigned operands
+    // results in a signed, so most rules need a separate entry for each kind of literal.
+
+    // x * 1 -> x
+    {MULTIPLY_OPR8R_OPCODE, true, LITERAL_IS_ONE, UNSIGNED_DATA_TYPE, NUMERIC_DATA_TYPES, KEEP_OTHER_OPERAND, INVALID_OPCODE}
+    ,{MULTIPLY_OPR8R_OPCODE, true, LITERAL_IS_ONE, SIGNED_DATA_TYPE, SIGNED_DATA_TYPE | DOUBLE_DATA_TYPE, KEEP_OTHER_OPERAND, INVALID_OPCODE}
+    // x * 2 -> x + x
+    ,{MULTIPLY_OPR8R_OPCODE, true, LITERAL_IS_TWO, UNSIGNED_DATA_TYPE, NUMERIC_DATA_TYPES, ADD_TO_ITSELF, BINARY_PLUS_OPR8R_OPCODE}
+    ,{MULTIPLY_OPR8R_OPCODE, true, LITERAL_IS_TWO, SIGNED_DATA_TYPE, SIGNED_DATA_TYPE | DOUBLE_DATA_TYPE, ADD_TO_ITSELF, BINARY_PLUS_OPR8R_OPCODE}
+    // x * 2^N -> x << N; shifting a signed # doesn't necessarily result in a signed
+    ,{MULTIPLY_OPR8R_OPCODE, true, LITERAL_IS_POWER_OF_2, UNSIGNED_DATA_TYPE, UNSIGNED_DATA_TYPE, SHIFT_BY_LOG_2, LEFT_SHIFT_OPR8R_OPCODE}
+    // x / 1 -> x
+    ,{DIV_OPR8R_OPCODE, false, LITERAL_IS_ONE, UNSIGNED_DATA_TYPE, NUMERIC_DATA_TYPES, KEEP_OTHER_OPERAND, INVALID_OPCODE}
+    ,{DIV_OPR8R_OPCODE, false, LITERAL_IS_ONE, SIGNED_DATA_TYPE, SIGNED_DATA_TYPE | DOUBLE_DATA_TYPE, KEEP_OTHER_OPERAND, INVALID_OPCODE}
+    // x / 2^N -> x >> N; only unsigned division is guaranteed not to promote to a DOUBLE
+    ,{DIV_OPR8R_OPCODE, false, LITERAL_IS_POWER_OF_2, UNSIGNED_DATA_TYPE, UNSIGNED_DATA_TYPE, SHIFT_BY_LOG_2, RIGHT_SHIFT_OPR8R_OPCODE}
+    // x % 2^N -> x & (2^N - 1)
+    ,{MOD_OPR8R_OPCODE, false, LITERAL_IS_POWER_OF_2, UNSIGNED_DATA_TYPE, UNSIGNED_DATA_TYPE, MASK_BY_LITERAL_MINUS_1, BITWISE_AND_OPR8R_OPCODE}
+    // x + 0 -> x; a DOUBLE -0.0 would turn into 0.0
+    ,{BINARY_PLUS_OPR8R_OPCODE, true, LITERAL_IS_ZERO, UNSIGNED_DATA_TYPE, INTEGER_DATA_TYPES, KEEP_OTHER_OPERAND, INVALID_OPCODE}
+    ,{BINARY_PLUS_OPR8R_OPCODE, true, LITERAL_IS_ZERO, SIGNED_DATA_TYPE, SIGNED_DATA_TYPE, KEEP_OTHER_OPERAND, INVALID_OPCODE}
+    // x - 0 -> x
+    ,{BINARY_MINUS_OPR8R_OPCODE, false, LITERAL_IS_ZERO, UNSIGNED_DATA_TYPE, INTEGER_DATA_TYPES, KEEP_OTHER_OPERAND, INVALID_OPCODE}
+    ,{BINARY_MINUS_OPR8R_OPCODE, false, LITERAL_IS_ZERO, SIGNED_DATA_TYPE, SIGNED_DATA_TYPE, KEEP_OTHER_OPERAND, INVALID_OPCODE}
+    // x | 0 -> x; bitwise OPR8Rs always result in an unsigned, so x has to be one already
+    ,{BITWISE_OR_OPR8R_OPCODE, true, LITERAL_IS_ZERO, INTEGER_DATA_TYPES, UNSIGNED_DATA_TYPE, KEEP_OTHER_OPERAND, INVALID_OPCODE}
+    // x ^ 0 -> x
+    ,{BITWISE_XOR_OPR8R_OPCODE, true, LITERAL_IS_ZERO, INTEGER_DATA_TYPES, UNSIGNED_DATA_TYPE, KEEP_OTHER_OPERAND, INVALID_OPCODE}
+    // x << 0 -> x; shifting a positive signed # results in an unsigned
+    ,{LEFT_SHIFT_OPR8R_OPCODE, false, LITERAL_IS_ZERO, INTEGER_DATA_TYPES, UNSIGNED_DATA_TYPE, KEEP_OTHER_OPERAND, INVALID_OPCODE}
+    // x >> 0 -> x
+    ,{RIGHT_SHIFT_OPR8R_OPCODE, false, LITERAL_IS_ZERO, INTEGER_DATA_TYPES, UNSIGNED_DATA_TYPE, KEEP_OTHER_OPERAND, INVALID_OPCODE}
+    // !!b -> b; only a BOOL survives [!] with its value intact
+    ,{LOGICAL_NOT_OPR8R_OPCODE, false, OPERAND_IS_SAME_UNARY, 0, BOOL_DATA_TYPE, KEEP_OTHER_OPERAND, INVALID_OPCODE}
+  } {
+
+  this->userMessages = userMessages;
+  thisSrcFile = util.getLastSegment(util.stringToWstring(__FILE__), L"/");
+  failed_on_src_line = 0;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+AlgebraicSimplifier::~AlgebraicSimplifier() {
+  if (failed_on_src_line > 0 && !userMessages->isExistsInternalError(thisSrcFile, failed_on_src_line))  {
+    // Dump out a debugging hint
+    std::wcout << L"FAILURE on " << thisSrcFile << L":" << failed_on_src_line << std::endl;
+  }
+}
+
+/* ****************************************************************************
+ * Simplify everything under rootOfExpr in place.  Not finding anything to
+ * simplify is not a failure; a malformed tree is.
+ * ***************************************************************************/
+int AlgebraicSimplifier::simplifyExprTree (std::shared_ptr<ExprTreeNode> rootOfExpr) {
+  return simplifyNode_OLR (rootOfExpr, false);
+}
+
+/* ****************************************************************************
+ * Post-order walk; operands get simplified before the OPR8R that uses them, so
+ * [(x * 1) * 1] goes all the way down to [x].  isWidthSensitive is set when the
+ * data type width of currNode's result could show up in a [~] result.
+ * ***************************************************************************/
+int AlgebraicSimplifier::simplifyNode_OLR (std::shared_ptr<ExprTreeNode> currNode, bool isWidthSensitive)  {
+  int ret_code = GENERAL_FAILURE;
+  uint8_t op_code;
+
+  if (currNode == NULL || currNode->originalTkn == NULL)  {
+    userMessages->logMsg (INTERNAL_ERROR, L"Unexpected NULL expression tree node", thisSrcFile, __LINE__, 0);
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (currNode->originalTkn->tkn_type == SYSTEM_CALL_TKN)  {
+    ret_code = OK;
+    for (auto param : currNode->parameter_list) {
+      if (OK != simplifyNode_OLR (param, false))  {
+        SET_FAILED_ON_SRC_LINE;
+        ret_code = GENERAL_FAILURE;
+        break;
+      }
+    }
+
+  } else if (!isOpr8rNode (currNode, op_code)) {
+    // Leaf node; either a literal or a variable
+    ret_code = OK;
+
+  } else  {
+    switch (op_code)  {
+      case POST_INCR_OPR8R_OPCODE :
+      case POST_DECR_OPR8R_OPCODE :
+      case PRE_INCR_OPR8R_OPCODE :
+      case PRE_DECR_OPR8R_OPCODE :
+        // Operand has to be a variable, so nothing to simplify
+        ret_code = OK;
+        break;
+      case ASSIGNMENT_OPR8R_OPCODE :
+      case PLUS_ASSIGN_OPR8R_OPCODE :
+      case MINUS_ASSIGN_OPR8R_OPCODE :
+      case MULTIPLY_ASSIGN_OPR8R_OPCODE :
+      case DIV_ASSIGN_OPR8R_OPCODE :
+      case MOD_ASSIGN_OPR8R_OPCODE :
+      case LEFT_SHIFT_ASSIGN_OPR8R_OPCODE :
+      case RIGHT_SHIFT_ASSIGN_OPR8R_OPCODE :
+      case BITWISE_AND_ASSIGN_OPR8R_OPCODE :
+      case BITWISE_XOR_ASSIGN_OPR8R_OPCODE :
+      case BITWISE_OR_ASSIGN_OPR8R_OPCODE :
+        // Left operand is the variable being assigned to; only the right side can be simplified
+        if (currNode->_2ndChild != NULL && OK != simplifyNode_OLR (currNode->_2ndChild, isWidthSensitive))
+          SET_FAILED_ON_SRC_LINE;
+        else
+          ret_code = OK;
+        break;
+      default:
+        {
+          bool isChildSensitive = (op_code == BITWISE_NOT_OPR8R_OPCODE) || (isWidthSensitive && !isResultReset (op_code));
+
+          if (currNode->_1stChild != NULL && OK != simplifyNode_OLR (currNode->_1stChild, isChildSensitive))
+            SET_FAILED_ON_SRC_LINE;
+          else if (currNode->_2ndChild != NULL && OK != simplifyNode_OLR (currNode->_2ndChild, isChildSensitive))
+            SET_FAILED_ON_SRC_LINE;
+          else  {
+            applyRules (currNode, op_code, isWidthSensitive);
+            ret_code = OK;
+          }
+        }
+        break;
+    }
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * Rewrite currNode with the 1st rule that matches, if any
+ * ***************************************************************************/
+bool AlgebraicSimplifier::applyRules (std::shared_ptr<ExprTreeNode> currNode, uint8_t op_code, bool isWidthSensitive)  {
+  bool isRewritten = false;
+  uint8_t nested_op_code;
+
+  for (auto ruleR8r = rules.begin(); ruleR8r != rules.end() && !isRewritten; ruleR8r++)  {
+    if (ruleR8r->op_code != op_code || (isWidthSensitive && ruleR8r->rewrite == KEEP_OTHER_OPERAND))
+      continue;
+
+    if (ruleR8r->match == OPERAND_IS_SAME_UNARY)  {
+      std::shared_ptr<ExprTreeNode> nestedNode = currNode->_1stChild;
+
+      if (nestedNode != NULL && isOpr8rNode (nestedNode, nested_op_code) && nested_op_code == op_code
+        && nestedNode->_1stChild != NULL && nestedNode->_1stChild->resultTypes != 0
+        && 0 == (nestedNode->_1stChild->resultTypes & ~ruleR8r->operand_types)) {
+        replaceWithSubTree (currNode, nestedNode->_1stChild);
+        isRewritten = true;
+      }
+
+    } else if (currNode->_1stChild != NULL && currNode->_2ndChild != NULL) {
+      if (isRuleMatch (*ruleR8r, currNode->_2ndChild, currNode->_1stChild)) {
+        rewriteNode (*ruleR8r, currNode, currNode->_2ndChild, currNode->_1stChild);
+        isRewritten = true;
+
+      } else if (ruleR8r->is_commutative && isRuleMatch (*ruleR8r, currNode->_1stChild, currNode->_2ndChild))  {
+        rewriteNode (*ruleR8r, currNode, currNode->_1stChild, currNode->_2ndChild);
+        isRewritten = true;
+      }
+    }
+  }
+
+  return isRewritten;
+}
+
+/* ****************************************************************************
+ * Does literalNode satisfy the rule, and is otherNode limited to data types
+ * the rewrite gives the same result for?
+ * ***************************************************************************/
+bool AlgebraicSimplifier::isRuleMatch (algebraicRule & rule, std::shared_ptr<ExprTreeNode> literalNode
+  , std::shared_ptr<ExprTreeNode> otherNode) {
+  bool isMatch = false;
+  uint64_t value;
+  uint8_t dummy_op_code;
+
+  if (!isIntegerLiteral (literalNode, value))
+    isMatch = false;
+
+  else if (0 != (TypeChecker::getDataTypeMask (literalNode->originalTkn->tkn_type) & ~rule.literal_types))
+    isMatch = false;
+
+  else if (otherNode->resultTypes == 0 || 0 != (otherNode->resultTypes & ~rule.operand_types))
+    isMatch = false;
+
+  else if (rule.rewrite == ADD_TO_ITSELF && (otherNode->originalTkn->tkn_type != USER_WORD_TKN || isOpr8rNode (otherNode, dummy_op_code)))
+    // Only a variable is cheap and side effect free enough to read twice
+    isMatch = false;
+
+  else  {
+    switch (rule.match) {
+      case LITERAL_IS_ZERO :
+        isMatch = (value == 0);
+        break;
+      case LITERAL_IS_ONE :
+        isMatch = (value == 1);
+        break;
+      case LITERAL_IS_TWO :
+        isMatch = (value == 2);
+        break;
+      case LITERAL_IS_POWER_OF_2 :
+        isMatch = (value != 0 && 0 == (value & (value - 1)));
+        break;
+      default:
+        break;
+    }
+  }
+
+  return isMatch;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+void AlgebraicSimplifier::rewriteNode (algebraicRule & rule, std::shared_ptr<ExprTreeNode> currNode
+  , std::shared_ptr<ExprTreeNode> literalNode, std::shared_ptr<ExprTreeNode> otherNode)  {
+  uint64_t value;
+
+  if (rule.rewrite == KEEP_OTHER_OPERAND)  {
+    replaceWithSubTree (currNode, otherNode);
+
+  } else if (isIntegerLiteral (literalNode, value)) {
+    Operator opr8r;
+    execTerms.getExecOpr8rDetails (rule.new_op_code, opr8r);
+
+    // Keep the original OPR8R's source position for any run time messages
+    std::shared_ptr<Token> newOpr8rTkn = std::make_shared<Token> (*currNode->originalTkn);
+    newOpr8rTkn->tkn_type = SRC_OPR8R_TKN;
+    newOpr8rTkn->_string = opr8r.symbol;
+    currNode->originalTkn = newOpr8rTkn;
+
+    std::shared_ptr<Token> newLiteralTkn = std::make_shared<Token> (*literalNode->originalTkn);
+
+    if (rule.rewrite == ADD_TO_ITSELF)  {
+      literalNode->originalTkn = std::make_shared<Token> (*otherNode->originalTkn);
+      literalNode->resultTypes = otherNode->resultTypes;
+
+    } else if (rule.rewrite == SHIFT_BY_LOG_2)  {
+      uint64_t log_2 = 0;
+      while ((value >>= 1) > 0)
+        log_2++;
+      newLiteralTkn->resetToUnsigned (log_2);
+
+    } else if (rule.rewrite == MASK_BY_LITERAL_MINUS_1) {
+      newLiteralTkn->resetToUnsigned (value - 1);
+    }
+
+    if (rule.rewrite != ADD_TO_ITSELF)  {
+      newLiteralTkn->isInitialized = true;
+      literalNode->originalTkn = newLiteralTkn;
+      literalNode->resultTypes = TypeChecker::getDataTypeMask (newLiteralTkn->tkn_type);
+    }
+
+    // Literal might have been on the left of a commutative OPR8R, but it has to be on the right now
+    currNode->_1stChild = otherNode;
+    currNode->_2ndChild = literalNode;
+  }
+}
+
+/* ****************************************************************************
+ * Pull subTree up into currNode's spot, so whatever points at currNode now
+ * gets subTree instead
+ * ***************************************************************************/
+void AlgebraicSimplifier::replaceWithSubTree (std::shared_ptr<ExprTreeNode> currNode, std::shared_ptr<ExprTreeNode> subTree) {
+  currNode->originalTkn = subTree->originalTkn;
+  currNode->_1stChild = subTree->_1stChild;
+  currNode->_2ndChild = subTree->_2ndChild;
+  currNode->parameter_list = subTree->parameter_list;
+  currNode->resultTypes = subTree->resultTypes;
+
+  if (currNode->_1stChild != NULL)
+    currNode->_1stChild->treeParent = currNode;
+  if (currNode->_2ndChild != NULL)
+    currNode->_2ndChild->treeParent = currNode;
+  for (auto param : currNode->parameter_list)
+    param->treeParent = currNode;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+bool AlgebraicSimplifier::isOpr8rNode (std::shared_ptr<ExprTreeNode> currNode, uint8_t & op_code) {
+  bool isOpr8r = false;
+  op_code = INVALID_OPCODE;
+
+  if (currNode->originalTkn->tkn_type == SRC_OPR8R_TKN) {
+    if (currNode->originalTkn->_string == execTerms.get_statement_ender())
+      op_code = STATEMENT_ENDER_OPR8R_OPCODE;
+    else
+      op_code = execTerms.getOpCodeFor (currNode->originalTkn->_string);
+    isOpr8r = true;
+
+  } else if (currNode->originalTkn->tkn_type == EXEC_OPR8R_TKN) {
+    op_code = currNode->originalTkn->_unsigned;
+    isOpr8r = true;
+  }
+
+  return isOpr8r;
+}
+
+/* ****************************************************************************
+ * Non-negative UINT[N] or INT[N] literal
+ * ***************************************************************************/
+bool AlgebraicSimplifier::isIntegerLiteral (std::shared_ptr<ExprTreeNode> currNode, uint64_t & value)  {
+  bool isIntLiteral = false;
+  Token & tkn = *currNode->originalTkn;
+
+  if (currNode->_1stChild == NULL && currNode->_2ndChild == NULL)  {
+    if (tkn.isUnsigned())  {
+      value = tkn._unsigned;
+      isIntLiteral = true;
+
+    } else if (tkn.isSigned() && tkn._signed >= 0) {
+      value = tkn._signed;
+      isIntLiteral = true;
+    }
+  }
+
+  return isIntLiteral;
+}
+
+/* ****************************************************************************
+ * OPR8Rs whose result gets a fresh data type picked for it, rather than
+ * passing along the data type of an operand
+ * ***************************************************************************/
+bool AlgebraicSimplifier::isResultReset (uint8_t op_code) {
+  bool isReset = false;
+
+  switch (op_code)  {
+    case UNARY_MINUS_OPR8R_OPCODE :
+    case LOGICAL_NOT_OPR8R_OPCODE :
+    case MULTIPLY_OPR8R_OPCODE :
+    case DIV_OPR8R_OPCODE :
+    case MOD_OPR8R_OPCODE :
+    case BINARY_PLUS_OPR8R_OPCODE :
+    case BINARY_MINUS_OPR8R_OPCODE :
+    case LEFT_SHIFT_OPR8R_OPCODE :
+    case RIGHT_SHIFT_OPR8R_OPCODE :
+    case LESS_THAN_OPR8R_OPCODE :
+    case LESS_EQUALS_OPR8R8_OPCODE :
+    case GREATER_THAN_OPR8R_OPCODE :
+    case GREATER_EQUALS_OPR8R8_OPCODE :
+    case EQUALITY_OPR8R_OPCODE :
+    case NOT_EQUALS_OPR8R_OPCODE :
+    case BITWISE_AND_OPR8R_OPCODE :
+    case BITWISE_XOR_OPR8R_OPCODE :
+    case BITWISE_OR_OPR8R_OPCODE :
+    case LOGICAL_AND_OPR8R_OPCODE :
+    case LOGICAL_OR_OPR8R_OPCODE :
+      isReset = true;
+      break;
+    default:
+      break;
+  }
+
+  return isReset;
+}
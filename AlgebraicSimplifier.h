@@ -0,0 +1,82 @@
+/*
+ * AlgebraicSimplifier.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ */
+
+#ifndef ALGEBRAICSIMPLIFIER_H_
+#define ALGEBRAICSIMPLIFIER_H_
+
+#include <string>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include "CompileExecTerms.h"
+#include "ExprTreeNode.h"
+#include "Token.h"
+#include "Utilities.h"
+#include "UserMessages.h"
+
+// What the literal operand (or nested OPR8R) has to look like for a rule to apply
+enum algebraic_match_enum {
+  LITERAL_IS_ZERO
+  ,LITERAL_IS_ONE
+  ,LITERAL_IS_TWO
+  ,LITERAL_IS_POWER_OF_2
+  ,OPERAND_IS_SAME_UNARY    // e.g. [!][!][b]
+};
+
+typedef algebraic_match_enum algebraicMatchEnum;
+
+// What the OPR8R node gets rewritten to
+enum algebraic_rewrite_enum {
+  KEEP_OTHER_OPERAND        // [*][x][1] -> [x]
+  ,ADD_TO_ITSELF            // [*][x][2] -> [B+][x][x]
+  ,SHIFT_BY_LOG_2           // [*][x][8] -> [<<][x][3]
+  ,MASK_BY_LITERAL_MINUS_1  // [%][x][8] -> [&][x][7]
+};
+
+typedef algebraic_rewrite_enum algebraicRewriteEnum;
+
+struct algebraic_rule_struct {
+  uint8_t op_code;
+  bool is_commutative;        // Literal can be on either side of the OPR8R
+  algebraicMatchEnum match;
+  uint8_t literal_types;      // Data type categories (see TypeChecker.h) the literal is allowed to be
+  uint8_t operand_types;      // ...and the data type categories the other operand is limited to
+  algebraicRewriteEnum rewrite;
+  uint8_t new_op_code;
+};
+
+typedef algebraic_rule_struct algebraicRule;
+
+class AlgebraicSimplifier {
+public:
+  AlgebraicSimplifier(const CompileExecTerms & inExecTerms, std::shared_ptr<UserMessages> userMessages);
+  virtual ~AlgebraicSimplifier();
+
+  int simplifyExprTree (std::shared_ptr<ExprTreeNode> rootOfExpr);
+
+private:
+  const CompileExecTerms & execTerms;
+  std::shared_ptr<UserMessages> userMessages;
+  std::wstring thisSrcFile;
+  Utilities util;
+  int failed_on_src_line;
+  std::vector<algebraicRule> rules;
+
+  int simplifyNode_OLR (std::shared_ptr<ExprTreeNode> currNode, bool isWidthSensitive);
+  bool applyRules (std::shared_ptr<ExprTreeNode> currNode, uint8_t op_code, bool isWidthSensitive);
+  bool isRuleMatch (algebraicRule & rule, std::shared_ptr<ExprTreeNode> literalNode, std::shared_ptr<ExprTreeNode> otherNode);
+  void rewriteNode (algebraicRule & rule, std::shared_ptr<ExprTreeNode> currNode, std::shared_ptr<ExprTreeNode> literalNode
+    , std::shared_ptr<ExprTreeNode> otherNode);
+  void replaceWithSubTree (std::shared_ptr<ExprTreeNode> currNode, std::shared_ptr<ExprTreeNode> subTree);
+
+  bool isOpr8rNode (std::shared_ptr<ExprTreeNode> currNode, uint8_t & op_code);
+  bool isIntegerLiteral (std::shared_ptr<ExprTreeNode> currNode, uint64_t & value);
+  bool isResultReset (uint8_t op_code);
+
+};
+
+#endif /* ALGEBRAICSIMPLIFIER_H_ */
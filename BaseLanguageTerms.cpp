@@ -56,8 +56,8 @@ void BaseLanguageTerms::validityCheck() {
   }
 
   // Reference count reserved words
-  for (idx = 0; idx < reserved_words.size(); idx++) {
-    std::wstring next_type = reserved_words[idx];
+  for (auto itr8r = reserved_words.begin(); itr8r != reserved_words.end(); itr8r++) {
+    std::wstring next_type = *itr8r;
     assert (!next_type.empty());
     auto search = nameReferenceCnt.find(next_type);
     if (search == nameReferenceCnt.end()) {
@@ -69,9 +69,11 @@ void BaseLanguageTerms::validityCheck() {
   }
 
   // Reference count system calls
+  assert (system_calls.size() <= MAX_SYSTEM_CALLS);
   for (auto itr8r = system_calls.begin(); itr8r != system_calls.end(); itr8r++) {
-    std::wstring nxt_sys_call = itr8r->first;
+    std::wstring nxt_sys_call = itr8r->name;
     assert (!nxt_sys_call.empty());
+    assert (itr8r->exec_fxn != NULL);
     auto search = nameReferenceCnt.find(nxt_sys_call);
     if (search == nameReferenceCnt.end()) {
       nameReferenceCnt.insert(std::pair {nxt_sys_call, 1});
@@ -95,9 +97,8 @@ void BaseLanguageTerms::validityCheck() {
   }
 
   std::wstring opr8r;
-  std::list<Opr8rPrecedenceLvl>::iterator outr8r;
-  std::list<Operator>::iterator innr8r;
-  Opr8rPrecedenceLvl precedenceLvl;
+  std::vector<Opr8rPrecedenceLvl>::iterator outr8r;
+  std::vector<Operator>::iterator innr8r;
 
   for(std::wstring::iterator o = atomic_1char_opr8rs.begin(); o != atomic_1char_opr8rs.end(); ++o) {
     opr8r.clear();
@@ -105,11 +106,8 @@ void BaseLanguageTerms::validityCheck() {
     bool isFound = false;
 
     for (outr8r = grouped_opr8rs.begin(); outr8r != grouped_opr8rs.end() && !isFound; outr8r++){
-      precedenceLvl = *outr8r;
-
-      for (innr8r = precedenceLvl.opr8rs.begin(); innr8r != precedenceLvl.opr8rs.end(); ++innr8r){
-        Operator nxtDefOpr8r = *innr8r;
-        if (0 == opr8r.compare(nxtDefOpr8r.symbol)) {
+      for (innr8r = outr8r->opr8rs.begin(); innr8r != outr8r->opr8rs.end(); ++innr8r){
+        if (0 == opr8r.compare(innr8r->symbol)) {
           isFound = true;
           break;
         }
@@ -128,10 +126,8 @@ void BaseLanguageTerms::validityCheck() {
 
 
   for (outr8r = grouped_opr8rs.begin(); outr8r != grouped_opr8rs.end(); outr8r++){
-    precedenceLvl = *outr8r;
-
-    for (innr8r = precedenceLvl.opr8rs.begin(); innr8r != precedenceLvl.opr8rs.end(); ++innr8r){
-      Operator nxtDefOpr8r = *innr8r;
+    for (innr8r = outr8r->opr8rs.begin(); innr8r != outr8r->opr8rs.end(); ++innr8r){
+      Operator & nxtDefOpr8r = *innr8r;
 
       std::wstring opr8r = innr8r->symbol;
 
@@ -184,10 +180,44 @@ void BaseLanguageTerms::validityCheck() {
 
 }
 
+/* ****************************************************************************
+ * The language definition tables don't change once the derived class has built
+ * them, so precompute the lookups the compiler and interpreter hit on every
+ * Token. Must be called after validityCheck has filled in execTimeOpr8rMap.
+ * ***************************************************************************/
+void BaseLanguageTerms::buildLookupTables() {
+
+  execOpr8rsByOpCode.assign(UINT8_MAX + 1, Operator());
+  for (auto itr8r = execTimeOpr8rMap.begin(); itr8r != execTimeOpr8rMap.end(); itr8r++) {
+    assert (execOpr8rsByOpCode[itr8r->second.op_code].op_code == INVALID_OPCODE);
+    execOpr8rsByOpCode[itr8r->second.op_code] = itr8r->second;
+  }
+
+  opr8rsBySymbol.clear();
+  for (auto outr8r = grouped_opr8rs.begin(); outr8r != grouped_opr8rs.end(); outr8r++) {
+    for (auto innr8r = outr8r->opr8rs.begin(); innr8r != outr8r->opr8rs.end(); innr8r++)
+      opr8rsBySymbol[innr8r->symbol].push_back(*innr8r);
+  }
+
+  srcToExecOpr8rs.clear();
+  for (auto itr8r = execToSrcOpr8rMap.begin(); itr8r != execToSrcOpr8rMap.end(); itr8r++)
+    srcToExecOpr8rs[itr8r->second].push_back(itr8r->first);
+
+  tknTypesByOpCode.assign(UINT8_MAX + 1, START_UNDEF_TKN);
+  for (auto itr8r = valid_data_types.begin(); itr8r != valid_data_types.end(); itr8r++) {
+    if (itr8r->second.first != INTERNAL_USE_TKN && itr8r->second.second != INVALID_OPCODE)
+      tknTypesByOpCode[itr8r->second.second] = itr8r->second.first;
+  }
+
+  sysCallIdsByName.clear();
+  for (int sys_call_id = 0; sys_call_id < system_calls.size(); sys_call_id++)
+    sysCallIdsByName[system_calls[sys_call_id].name] = sys_call_id;
+}
+
 /* ****************************************************************************
  * Determine if curr_char is a single charactor separator or not.
  * ***************************************************************************/
-bool BaseLanguageTerms::is_sngl_char_spr8r (wchar_t curr_char) {
+bool BaseLanguageTerms::is_sngl_char_spr8r (wchar_t curr_char) const {
   bool is_spr8r = false;
 
   if (_1char_spr8rs.find(curr_char) != std::wstring::npos)
@@ -202,7 +232,7 @@ bool BaseLanguageTerms::is_sngl_char_spr8r (wchar_t curr_char) {
  * num_tomatoes = 3;;;;;;;
  * are legal, but the extra ; will pop an empty stack
  * ***************************************************************************/
-bool BaseLanguageTerms::is_atomic_opr8r (wchar_t curr_char) {
+bool BaseLanguageTerms::is_atomic_opr8r (wchar_t curr_char) const {
   bool is_opr8r = false;
 
   if (atomic_1char_opr8rs.find(curr_char) != std::wstring::npos)
@@ -214,30 +244,16 @@ bool BaseLanguageTerms::is_atomic_opr8r (wchar_t curr_char) {
 /* ****************************************************************************
  * Check if term is a valid OPR8R or not.
  * ***************************************************************************/
-bool BaseLanguageTerms::is_valid_opr8r (std::wstring check_for_opr8r, uint8_t usage_mode) {
+bool BaseLanguageTerms::is_valid_opr8r (const std::wstring & check_for_opr8r, uint8_t usage_mode) const {
   bool is_valid = false;
 
-
-  std::list<Opr8rPrecedenceLvl>::iterator outr8r;
-  std::list<Operator>::iterator innr8r;
-  Opr8rPrecedenceLvl precedenceLvl;
-
-    for (outr8r = grouped_opr8rs.begin(); outr8r != grouped_opr8rs.end() && !is_valid; outr8r++){
-      precedenceLvl = *outr8r;
-
-      for (innr8r = precedenceLvl.opr8rs.begin(); innr8r != precedenceLvl.opr8rs.end() && !is_valid; ++innr8r){
-        Operator nxtOpr8r = *innr8r;
-
-        if (0 == nxtOpr8r.symbol.compare(check_for_opr8r))  {
-          // Operator string matches
-          if (usage_mode == (usage_mode & nxtOpr8r.valid_usage))  {
-            // And the current usage_mode is acceptable also
-            is_valid = true;
-          }
-          break;
-        }
-      }
+  if (auto search = opr8rsBySymbol.find(check_for_opr8r); search != opr8rsBySymbol.end())  {
+    for (auto itr8r = search->second.begin(); itr8r != search->second.end() && !is_valid; itr8r++) {
+      if (usage_mode == (usage_mode & itr8r->valid_usage))
+        // Operator string matches and the current usage_mode is acceptable also
+        is_valid = true;
     }
+  }
 
   return is_valid;
 }
@@ -245,7 +261,7 @@ bool BaseLanguageTerms::is_valid_opr8r (std::wstring check_for_opr8r, uint8_t us
 /* ****************************************************************************
  * Check if term is a valid datatype
  * ***************************************************************************/
-bool BaseLanguageTerms::is_valid_datatype (std::wstring check_for_datatype) {
+bool BaseLanguageTerms::is_valid_datatype (const std::wstring & check_for_datatype) const {
   bool is_valid = false;
 
   if (auto search = valid_data_types.find(check_for_datatype); search != valid_data_types.end())  {
@@ -259,24 +275,12 @@ bool BaseLanguageTerms::is_valid_datatype (std::wstring check_for_datatype) {
 /* ****************************************************************************
  * Check if this OPR8R has the type_mask the caller expects
  * ***************************************************************************/
-uint8_t BaseLanguageTerms::get_type_mask (std::wstring pssbl_opr8r) {
+uint8_t BaseLanguageTerms::get_type_mask (const std::wstring & pssbl_opr8r) const {
   uint8_t opr8r_mask = 0x0;
 
-  std::list<Opr8rPrecedenceLvl>::iterator outr8r;
-  std::list<Operator>::iterator innr8r;
-  Opr8rPrecedenceLvl precedenceLvl;
-
-  for (outr8r = grouped_opr8rs.begin(); outr8r != grouped_opr8rs.end() && opr8r_mask == 0x0; outr8r++){
-    precedenceLvl = *outr8r;
-
-    for (innr8r = precedenceLvl.opr8rs.begin(); innr8r != precedenceLvl.opr8rs.end(); ++innr8r){
-      Operator nxtOpr8r = *innr8r;
-      if (0 == nxtOpr8r.symbol.compare(pssbl_opr8r))  {
-        opr8r_mask = nxtOpr8r.type_mask;
-        break;
-      }
-    }
-  }
+  // 1st definition in precedence order wins
+  if (auto search = opr8rsBySymbol.find(pssbl_opr8r); search != opr8rsBySymbol.end())
+    opr8r_mask = search->second.front().type_mask;
 
   return opr8r_mask;
 }
@@ -286,24 +290,12 @@ uint8_t BaseLanguageTerms::get_type_mask (std::wstring pssbl_opr8r) {
 /* ****************************************************************************
  * Get the number of operands this OPR8R requires
  * ***************************************************************************/
-int BaseLanguageTerms::get_operand_cnt (std::wstring pssbl_opr8r) {
+int BaseLanguageTerms::get_operand_cnt (const std::wstring & pssbl_opr8r) const {
   int rand_cnt = -1;
 
-  std::list<Opr8rPrecedenceLvl>::iterator outr8r;
-  std::list<Operator>::iterator innr8r;
-  Opr8rPrecedenceLvl precedenceLvl;
-
-  for (outr8r = grouped_opr8rs.begin(); outr8r != grouped_opr8rs.end() && rand_cnt == -1; outr8r++){
-    precedenceLvl = *outr8r;
-
-    for (innr8r = precedenceLvl.opr8rs.begin(); innr8r != precedenceLvl.opr8rs.end(); ++innr8r){
-      Operator nxtOpr8r = *innr8r;
-      if (0 == nxtOpr8r.symbol.compare(pssbl_opr8r))  {
-        rand_cnt = nxtOpr8r.numReqSrcOperands;
-        break;
-      }
-    }
-  }
+  // 1st definition in precedence order wins
+  if (auto search = opr8rsBySymbol.find(pssbl_opr8r); search != opr8rsBySymbol.end())
+    rand_cnt = search->second.front().numReqSrcOperands;
 
   return rand_cnt;
 }
@@ -311,28 +303,28 @@ int BaseLanguageTerms::get_operand_cnt (std::wstring pssbl_opr8r) {
 /* ****************************************************************************
  * Return the starting ternary opr8r string
  * ***************************************************************************/
-std::wstring BaseLanguageTerms::get_ternary_1st ()  {
+std::wstring BaseLanguageTerms::get_ternary_1st () const {
   return ternary_1st;
 }
 
 /* ****************************************************************************
  * Return the middle ternary opr8r string
  * ***************************************************************************/
-std::wstring BaseLanguageTerms::get_ternary_2nd ()  {
+std::wstring BaseLanguageTerms::get_ternary_2nd () const {
   return ternary_2nd;
 }
 
 /* ****************************************************************************
  * Return the 1 & only STATEMENT_ENDER opr8r string
  * ***************************************************************************/
-std::wstring BaseLanguageTerms::get_statement_ender() {
+std::wstring BaseLanguageTerms::get_statement_ender() const {
   return statement_ender;
 }
 
 /* ****************************************************************************
  * Return the BYTE sized opCode for this OPR8R
  * ***************************************************************************/
-uint8_t BaseLanguageTerms::getOpCodeFor (std::wstring opr8r)  {
+uint8_t BaseLanguageTerms::getOpCodeFor (const std::wstring & opr8r) const {
   uint8_t op_code = INVALID_OPCODE;
 
   if (auto search = execTimeOpr8rMap.find(opr8r); search != execTimeOpr8rMap.end()) {
@@ -349,7 +341,7 @@ uint8_t BaseLanguageTerms::getOpCodeFor (std::wstring opr8r)  {
 /* ****************************************************************************
  * Return the OPR8R for the passed in BYTE sized opCode
  * ***************************************************************************/
-std::wstring BaseLanguageTerms::getSrcOpr8rStrFor (uint8_t op_code) {
+std::wstring BaseLanguageTerms::getSrcOpr8rStrFor (uint8_t op_code) const {
   std::wstring srcOpr8rStr = L"";
   Operator opr8r;
 
@@ -374,17 +366,12 @@ std::wstring BaseLanguageTerms::getSrcOpr8rStrFor (uint8_t op_code) {
 /* ****************************************************************************
  * Fill in the OPR8R object details, if found
  * ***************************************************************************/
-int BaseLanguageTerms::getExecOpr8rDetails (uint8_t op_code, Operator & callers_opr8r)  {
+int BaseLanguageTerms::getExecOpr8rDetails (uint8_t op_code, Operator & callers_opr8r) const {
   int ret_code = GENERAL_FAILURE;
 
-  for (auto itr8r = execTimeOpr8rMap.begin(); itr8r != execTimeOpr8rMap.end(); itr8r++) {
-    Operator r8r = itr8r->second;
-
-    if (r8r.op_code == op_code) {
-      callers_opr8r = r8r;
-      ret_code = OK;
-      break;
-    }
+  if (op_code != INVALID_OPCODE && execOpr8rsByOpCode[op_code].op_code == op_code) {
+    callers_opr8r = execOpr8rsByOpCode[op_code];
+    ret_code = OK;
   }
 
   return (ret_code);
@@ -394,50 +381,30 @@ int BaseLanguageTerms::getExecOpr8rDetails (uint8_t op_code, Operator & callers_
  * For the passed ambiguous source OPR8R, search the special case map used
  * for disambiguation and find the exec OPR8R that matches the req_type_mask
  * ***************************************************************************/
-std::wstring BaseLanguageTerms::getUniqExecOpr8rStr (std::wstring srcStr, uint8_t req_type_mask)  {
+std::wstring BaseLanguageTerms::getUniqExecOpr8rStr (const std::wstring & srcStr, uint8_t req_type_mask) const {
   std::wstring execOpr8rStr = L"";
+  int matchCnt = 0;
 
-  std::vector <std::wstring> pssblExecOpr8rs;
-  std::vector <Operator> matchingOpr8rs;
+  std::vector <std::wstring> noDisambiguation {srcStr};
+  const std::vector <std::wstring> * pssblExecOpr8rs = &noDisambiguation;
 
-  // TODO: decrypt, disambiguate, clarify, uniqify.....
-  for (auto itr8r = execToSrcOpr8rMap.begin(); itr8r != execToSrcOpr8rMap.end(); itr8r++) {
-    if (itr8r->second == srcStr)  {
-      // Matched on the passed in source OPR8R string
-      pssblExecOpr8rs.push_back (itr8r->first);
-    }
-  }
-
-  if (pssblExecOpr8rs.empty())
-    // No disambiguation matches from execToSrcOpr8rMap
-    pssblExecOpr8rs.push_back (srcStr);
-
-  std::list<Opr8rPrecedenceLvl>::iterator outr8r;
-  std::list<Operator>::iterator innr8r;
-  std::vector <std::wstring>::iterator pssblR8r;
-  Opr8rPrecedenceLvl precedenceLvl;
-
-  for (outr8r = grouped_opr8rs.begin(); outr8r != grouped_opr8rs.end(); outr8r++){
-    precedenceLvl = *outr8r;
-
-    for (innr8r = precedenceLvl.opr8rs.begin(); innr8r != precedenceLvl.opr8rs.end(); ++innr8r){
-      Operator nxtOpr8r = *innr8r;
+  if (auto search = srcToExecOpr8rs.find(srcStr); search != srcToExecOpr8rs.end())
+    // Matched on the passed in source OPR8R string
+    pssblExecOpr8rs = &search->second;
 
-      if (req_type_mask == (req_type_mask & nxtOpr8r.type_mask) && (nxtOpr8r.valid_usage & GNR8D_SRC))  {
+  for (auto pssblR8r = pssblExecOpr8rs->begin(); pssblR8r != pssblExecOpr8rs->end(); pssblR8r++) {
+    // execTimeOpr8rMap only holds GNR8D_SRC OPR8Rs
+    if (auto search = execTimeOpr8rMap.find(*pssblR8r); search != execTimeOpr8rMap.end())  {
+      if (req_type_mask == (req_type_mask & search->second.type_mask))  {
         // The current usage mode of this defined OPR8R meets the search criteria
-        for (pssblR8r = pssblExecOpr8rs.begin(); pssblR8r != pssblExecOpr8rs.end(); pssblR8r++) {
-          if (0 == nxtOpr8r.symbol.compare(*pssblR8r))  {
-            // Operator string directly matches
-            matchingOpr8rs.push_back(nxtOpr8r);
-            break;
-          }
-        }
+        execOpr8rStr = search->second.symbol;
+        matchCnt++;
       }
     }
   }
 
-  if (matchingOpr8rs.size() == 1)
-    execOpr8rStr = matchingOpr8rs[0].symbol;
+  if (matchCnt != 1)
+    execOpr8rStr.clear();
 
   return (execOpr8rStr);
 }
@@ -448,7 +415,7 @@ std::wstring BaseLanguageTerms::getUniqExecOpr8rStr (std::wstring srcStr, uint8_
  * If the passed in USER_WORD is a valid data type, return the associated Token type
  * enum and op_code. Otherwise, return an obviously invalid (hopefully)l pair
  * ***************************************************************************/
-std::pair<TokenTypeEnum, uint8_t> BaseLanguageTerms::getDataType_tknEnum_opCode (std::wstring user_word)  {
+std::pair<TokenTypeEnum, uint8_t> BaseLanguageTerms::getDataType_tknEnum_opCode (const std::wstring & user_word) const {
   std::pair ret_info {START_UNDEF_TKN, INVALID_OPCODE};
 
   if (auto search = valid_data_types.find(user_word); search != valid_data_types.end()) {
@@ -465,20 +432,11 @@ std::pair<TokenTypeEnum, uint8_t> BaseLanguageTerms::getDataType_tknEnum_opCode
  * If the passed in op_code represents a valid data type, a valid datatype string
  * will be returned. Otherwise, return an empty string.
  * ***************************************************************************/
-TokenTypeEnum BaseLanguageTerms::getTokenTypeForOpCode (uint8_t op_code)  {
+TokenTypeEnum BaseLanguageTerms::getTokenTypeForOpCode (uint8_t op_code) const {
   TokenTypeEnum tknType = START_UNDEF_TKN;
 
-  if (op_code != INVALID_OPCODE)  {
-    for (auto itr8r = valid_data_types.begin(); itr8r != valid_data_types.end(); itr8r++) {
-      if (itr8r->second.first != INTERNAL_USE_TKN)  {
-        std::pair tknEnum_opCode = itr8r->second;
-        if (tknEnum_opCode.second == op_code) {
-          tknType = tknEnum_opCode.first;
-          break;
-        }
-      }
-    }
-  }
+  if (op_code != INVALID_OPCODE)
+    tknType = tknTypesByOpCode[op_code];
 
   return (tknType);
 
@@ -487,7 +445,7 @@ TokenTypeEnum BaseLanguageTerms::getTokenTypeForOpCode (uint8_t op_code)  {
 /* ****************************************************************************
  * Determine if the passed in string is a valid data type or not
  * ***************************************************************************/
-bool BaseLanguageTerms::is_valid_user_data_type (std::wstring inStr)  {
+bool BaseLanguageTerms::is_valid_user_data_type (const std::wstring & inStr) const {
   bool isValid = false;
 
   if ( auto search = valid_data_types.find(inStr); search != valid_data_types.end())  {
@@ -501,13 +459,11 @@ bool BaseLanguageTerms::is_valid_user_data_type (std::wstring inStr)  {
 /* ****************************************************************************
  * Determine if the passed in string is a valid reserved word or not
  * ***************************************************************************/
-bool BaseLanguageTerms::is_reserved_word (std::wstring inStr) {
+bool BaseLanguageTerms::is_reserved_word (const std::wstring & inStr) const {
   bool isValid = false;
 
-    for (auto itr8r = reserved_words.begin(); itr8r != reserved_words.end() && !isValid; itr8r++) {
-      if (0 == inStr.compare(*itr8r))
-        isValid = true;
-    }
+  if (reserved_words.count(inStr) > 0)
+    isValid = true;
 
   return isValid;
 }
@@ -515,54 +471,76 @@ bool BaseLanguageTerms::is_reserved_word (std::wstring inStr) {
 /* ****************************************************************************
  * Determine if the passed in string is a valid system call or not
  * ***************************************************************************/
- bool BaseLanguageTerms::is_system_call (std::wstring inStr)  {
-  bool is_valid = false;
-
-  if (auto search = system_calls.find(inStr); search != system_calls.end())  {
-      is_valid = true;
-  }
-
-  return is_valid;
-  
+ bool BaseLanguageTerms::is_system_call (const std::wstring & inStr) const {
+  return (sysCallIdsByName.find(inStr) != sysCallIdsByName.end());
 }
   
 /* ****************************************************************************
  * Get the parameter list and return type details for this system call
- * std::map <std::wstring, std::pair <std::vector<uint8_t>, TokenTypeEnum>> system_calls;
  * ***************************************************************************/
- int BaseLanguageTerms::get_system_call_details (std::wstring sys_call, std::vector<uint8_t> & param_list, TokenTypeEnum & data_type)  {
+ int BaseLanguageTerms::get_system_call_details (const std::wstring & sys_call, std::vector<uint8_t> & param_list, TokenTypeEnum & data_type) const {
   int ret_code = GENERAL_FAILURE;
+  uint8_t sys_call_id;
 
-  if (auto search = system_calls.find(sys_call); search != system_calls.end())  {
-    param_list = search->second.first;
-    data_type = search->second.second;
+  if (OK == get_system_call_id (sys_call, sys_call_id))  {
+    param_list = system_calls[sys_call_id].param_list;
+    data_type = system_calls[sys_call_id].ret_type;
     ret_code = OK;
   }
 
   return ret_code;
 }
 
+/* ****************************************************************************
+ * A pure system call has no side effects and its result depends only on its
+ * parameters, so a call with literal parameters can be resolved at compile time
+ * ***************************************************************************/
+ bool BaseLanguageTerms::is_pure_system_call (const std::wstring & sys_call) const {
+  uint8_t sys_call_id;
+
+  return (OK == get_system_call_id (sys_call, sys_call_id) && system_calls[sys_call_id].is_pure);
+}
+
 /* ****************************************************************************
  * Get how many parameters this system call needs before it can be resolved
- * TODO: The declarative part is here, but the actual system calls are 
- * currently in RunTimeInterpreter.  
  * ***************************************************************************/
- int BaseLanguageTerms::get_num_sys_call_parameters (std::wstring sys_call, int & num_params) {
+ int BaseLanguageTerms::get_num_sys_call_parameters (const std::wstring & sys_call, int & num_params) const {
   int ret_code = GENERAL_FAILURE;
+  uint8_t sys_call_id;
 
-  if (auto search = system_calls.find(sys_call); search != system_calls.end())  {
-    std::vector<uint8_t> param_list = search->second.first;
-    num_params = param_list.size();
+  if (OK == get_system_call_id (sys_call, sys_call_id))  {
+    num_params = system_calls[sys_call_id].param_list.size();
     ret_code = OK;
   }
   return ret_code;
 }
 
+/* ****************************************************************************
+ * The ID is what the compiler writes out in place of the system call's name
+ * ***************************************************************************/
+ int BaseLanguageTerms::get_system_call_id (const std::wstring & sys_call, uint8_t & sys_call_id) const {
+  int ret_code = GENERAL_FAILURE;
+
+  if (auto search = sysCallIdsByName.find(sys_call); search != sysCallIdsByName.end())  {
+    sys_call_id = search->second;
+    ret_code = OK;
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * Run time lookup; NULL if there's no system call with this ID
+ * ***************************************************************************/
+ const systemCall * BaseLanguageTerms::get_system_call (uint8_t sys_call_id) const {
+  return (sys_call_id < system_calls.size() ? &system_calls[sys_call_id] : NULL);
+}
+
 /* ****************************************************************************
  * Determine if the passed in string meets the requirements for a legit variable
  * name
  * ***************************************************************************/
-bool BaseLanguageTerms::is_viable_var_name (std::wstring varName) {
+bool BaseLanguageTerms::is_viable_var_name (const std::wstring & varName) const {
   bool isViable = true;
 
   if (is_reserved_word(varName))  {
@@ -593,7 +571,7 @@ bool BaseLanguageTerms::is_viable_var_name (std::wstring varName) {
  * Determine if the passed in Token can be converted to a data type that 
  * corresponds with the passed in op_code
  * ***************************************************************************/
- int BaseLanguageTerms::tkn_type_converts_to_opcode (uint8_t planned_op_code, Token & check_token, std::wstring variable_name, std::wstring & error_msg)  {
+ int BaseLanguageTerms::tkn_type_converts_to_opcode (uint8_t planned_op_code, Token & check_token, std::wstring variable_name, std::wstring & error_msg) const {
   int ret_code = GENERAL_FAILURE;
 
   Token expected_tkn;
@@ -650,216 +628,9 @@ bool BaseLanguageTerms::is_viable_var_name (std::wstring varName) {
  }
 
  /* ****************************************************************************
- *
- * ***************************************************************************/
-int BaseLanguageTerms::append_to_flat_tkn_list (std::shared_ptr<ExprTreeNode> tree_node, std::vector<Token> & flatExprTknList)  {
-  int ret_code = GENERAL_FAILURE;
-
-  if (tree_node != NULL)  {
-    if (tree_node->originalTkn->tkn_type == SRC_OPR8R_TKN && get_statement_ender() == tree_node->originalTkn->_string)  {
-      // Syntactic sugar
-      ret_code = OK;
-
-    } else if (tree_node->originalTkn->tkn_type == SYSTEM_CALL_TKN) {
-      if (OK != append_flattened_system_call (tree_node, flatExprTknList))
-        SET_FAILED_ON_SRC_LINE;
-      else
-        ret_code = OK;
-
-    } else if (tree_node->originalTkn->tkn_type != SRC_OPR8R_TKN && tree_node->originalTkn->tkn_type != EXEC_OPR8R_TKN) {
-      switch(tree_node->originalTkn->tkn_type)  {
-        case USER_WORD_TKN :
-        case STRING_TKN :
-        case DATETIME_TKN :
-        case BOOL_TKN :
-        case UINT8_TKN :
-        case UINT16_TKN :
-        case UINT32_TKN :
-        case UINT64_TKN :
-        case INT8_TKN :
-        case INT16_TKN :
-        case INT32_TKN :
-        case INT64_TKN :
-        case DOUBLE_TKN :
-        case SRC_OPR8R_TKN :
-          break;
-        default:
-          SET_FAILED_ON_SRC_LINE;
-          break;
-      }
-    }
-
-    if (!failed_on_src_line && ret_code != OK)  {
-      if (tree_node->originalTkn->tkn_type == SRC_OPR8R_TKN || tree_node->originalTkn->tkn_type == EXEC_OPR8R_TKN)  {
-        // Prior to putting OPR8Rs in flattened list, make them EXEC_OPR8R_TKNs
-        // since the caller is expected to use the RunTimeInterpreter to resolve
-        // the expression
-        uint8_t op_code = getOpCodeFor (tree_node->originalTkn->_string);
-        tree_node->originalTkn->resetTokenExceptSrc();
-        tree_node->originalTkn->tkn_type = EXEC_OPR8R_TKN;
-        tree_node->originalTkn->_unsigned = op_code;
-        Operator opr8r;
-        if (OK != getExecOpr8rDetails (op_code, opr8r))
-          SET_FAILED_ON_SRC_LINE;
-        else
-          tree_node->originalTkn->_string = opr8r.symbol;
-
-        if (op_code == INVALID_OPCODE)
-          SET_FAILED_ON_SRC_LINE;
-
-      }
-
-      if (!failed_on_src_line)  {
-        if (!(tree_node->originalTkn->tkn_type == EXEC_OPR8R_TKN && tree_node->originalTkn->_unsigned == TERNARY_2ND_OPR8R_OPCODE))
-          // No need to put the [:] OPR8R in the stream
-          flatExprTknList.push_back (*tree_node->originalTkn);
-        ret_code = OK;
-      }
-    }
-  }
-
-  return (ret_code);
-}
-
-/* ****************************************************************************
- * A system call ExprTreeNode *may* have additional parameter expressions that need to be
- * pushed to the flat list, which cannot be handled by the more simplistic
- * append_to_flat_tkn_list
- * ***************************************************************************/
- int BaseLanguageTerms::append_flattened_system_call (std::shared_ptr<ExprTreeNode> tree_node, std::vector<Token> & flatExprTknList)  {
-  int ret_code = GENERAL_FAILURE;
-
-  flatExprTknList.push_back(*(tree_node->originalTkn));
-
-  int idx = 0;
-  for (; idx < tree_node->parameter_list.size() && !failed_on_src_line; idx++) {
-    if (OK != makeFlatExpr_OLR (tree_node->parameter_list[idx], flatExprTknList))
-      SET_FAILED_ON_SRC_LINE;
-  }
-
-  if (idx == tree_node->parameter_list.size() && !failed_on_src_line)
-    ret_code = OK;
-
-  return ret_code;
-}
-
-/* ****************************************************************************
- * Take the parse tree supplied by the compiler and recursively turn it into a 
- * flattened expression with a sequence of 
- * [operator][left expression][right expression]
- * NOTE that [left expression] and/or right expression could consist of a single
- * operand, or could contain other nested expressions.
- * TODO: Does this proc belong in this class or in InterpretedFileWriter?
- * ***************************************************************************/
- int BaseLanguageTerms::makeFlatExpr_OLR (std::shared_ptr<ExprTreeNode> currBranch, std::vector<Token> & flatExprTknList) {
-  int ret_code = GENERAL_FAILURE;
-
-  if (currBranch != NULL) {
-
-    if (OK != append_to_flat_tkn_list(currBranch, flatExprTknList))
-      SET_FAILED_ON_SRC_LINE;
-
-    if (!failed_on_src_line && currBranch->_1stChild != NULL) {
-      if (OK != makeFlatExpr_OLR (currBranch->_1stChild, flatExprTknList))
-        SET_FAILED_ON_SRC_LINE;
-
-      if (!failed_on_src_line && currBranch->_2ndChild != NULL) {
-        if (OK != makeFlatExpr_OLR (currBranch->_2ndChild, flatExprTknList))
-          SET_FAILED_ON_SRC_LINE;
-      }
-    }
-
-    if (!failed_on_src_line)  {
-      ret_code = OK;
-    }
-  }
-
-  return (ret_code);
-}
-
-/* ****************************************************************************
- * Tree that represents an expression will be written out recursively into a
- * flat list for storing in a file stream.  Expression is written out in 
- * [OPR8R][LEFT][RIGHT] order.  The OPR8R goes 1st to enable short-circuiting of
- * [&&], [||] and [?] OPR8Rs.
- * Some example source expressions and their corresponding Token lists that get
- * written out to the interpreted file are shown below.
- * 
- * seven = three + four;
- * [=][seven][B+][three][four]
- *
- * one = 1;
- * [=][one][1]
- *
- * seven * seven + init1++; 
- * [B+][*][seven][seven][1+][init1]
- * 
- * seven * seven + ++init2;
- * [B+][*][seven][seven][+1][init2]
- * 
- * one >= two ? 1 : three <= two ? 2 : three == four ? 3 : six > seven ? 4 : six > (two << two) ? 5 : 12345;
- * [?][>=][one][two][1][?][<=][three][two][2][?][==][three][four][3][?][>][six][seven][4][?][>][six][<<][two][two][5][12345]
- * 
- * count == 1 ? "one" : count == 2 ? "two" : "MANY";
- * [?][==][count][1]["one"][?][==][count][2]["two"]["MANY"]
- * 
- * 3 * 4 / 3 + 4 << 4;
- * [<<][B+][/][*][3][4][3][4][4]
- * 
- * 3 * 4 / 3 + 4 << 4 + 1;
- * [<<][B+][/][*][3][4][3][4][B+][4][1]
- * 
- * (one * two >= three || two * three > six || three * four < seven || four / two < one) && (three % two > 1 || (shortCircuitAnd987 = 654));
- * [&&][||][||][||][>=][*][one][two][three][>][*][two][three][six][<][*][three][four][seven][<][/][four][two][one][||][>][%][three][two][1][=][shortCircuitAnd987][654]
- * TODO: Does this proc belong in this class or in InterpretedFileWriter?
- * ***************************************************************************/
- int BaseLanguageTerms::flattenExprTree (std::shared_ptr<ExprTreeNode> rootOfExpr, std::vector<Token> & flatExprTknList)  {
-  int ret_code = GENERAL_FAILURE;
-  bool isFailed = false;
-  int usrSrcLineNum;
-  int usrSrcColPos;
-
-  if (rootOfExpr == NULL)
-    SET_FAILED_ON_SRC_LINE;
-  else  
-    ret_code = makeFlatExpr_OLR (rootOfExpr, flatExprTknList);
-
-  return (ret_code);
-}
-
-/* ****************************************************************************
- * System call and associated parameters are bundled up in an ExprTreeNode
- * This proc walks through the structure and generates a flattened sequence
- * that can be consumed & operated on by RunTimeInterpreter.
- * TODO: Does this proc belong in this class or in InterpretedFileWriter?
- * ***************************************************************************/
- int BaseLanguageTerms::flatten_system_call (std::shared_ptr<ExprTreeNode> sys_call_node, std::vector<Token> & flat_tkn_list) {
-  int ret_code = GENERAL_FAILURE;
-
-  if (sys_call_node == NULL)  {
-    SET_FAILED_ON_SRC_LINE;
-    
-  } else {
-    flat_tkn_list.push_back(Token (SYSTEM_CALL_TKN, sys_call_node->originalTkn->_string));
-    // TODO: Would it be useful to include a parameter count token here?
-    int idx = 0;
-    for (; idx < sys_call_node->parameter_list.size() && !failed_on_src_line; idx++) {
-      if (OK != makeFlatExpr_OLR (sys_call_node->parameter_list[idx], flat_tkn_list))
-        SET_FAILED_ON_SRC_LINE;
-    }
-
-    if (idx == sys_call_node->parameter_list.size() && !failed_on_src_line)
-      ret_code = OK;
-
-  }
-
-  return ret_code;
-}
-
-/* ****************************************************************************
  * TODO: Should various dumpTokenList fxns get moved into Token class?
  * ***************************************************************************/
- void BaseLanguageTerms::dumpTokenList (std::vector<Token> & tokenStream, std::wstring callersSrcFile, int lineNum) {
+ void BaseLanguageTerms::dumpTokenList (std::vector<Token> & tokenStream, std::wstring callersSrcFile, int lineNum) const {
   std::wstring tknStrmStr = L"";
 
   dumpTokenList (tokenStream, 0, callersSrcFile, lineNum);
@@ -868,7 +639,7 @@ int BaseLanguageTerms::append_to_flat_tkn_list (std::shared_ptr<ExprTreeNode> tr
 /* ****************************************************************************
  *
  * ***************************************************************************/
-void BaseLanguageTerms::dumpTokenList (std::vector<Token> & tokenStream, int startIdx, std::wstring callersSrcFile, int lineNum)  {
+void BaseLanguageTerms::dumpTokenList (std::vector<Token> & tokenStream, int startIdx, std::wstring callersSrcFile, int lineNum) const {
   std::wstring tknStrmStr = L"";
 
 
@@ -890,7 +661,7 @@ void BaseLanguageTerms::dumpTokenList (std::vector<Token> & tokenStream, int sta
  *
  * ***************************************************************************/
 void BaseLanguageTerms::dumpTokenList (TokenPtrVector & tknPtrVector
-  , std::wstring callersSrcFile, int lineNum, bool isShowDetail)  {
+  , std::wstring callersSrcFile, int lineNum, bool isShowDetail) const {
   std::wstring tknStrmStr = L"";
 
   dumpTokenList (tknPtrVector, 0, callersSrcFile, lineNum, isShowDetail);
@@ -900,7 +671,7 @@ void BaseLanguageTerms::dumpTokenList (TokenPtrVector & tknPtrVector
  *
  * ***************************************************************************/
 void BaseLanguageTerms::dumpTokenList (TokenPtrVector & tknPtrVector, int startIdx
-  , std::wstring callersSrcFile, int lineNum, bool isShowDetail)  {
+  , std::wstring callersSrcFile, int lineNum, bool isShowDetail) const {
   std::wstring tknStrmStr = L"";
 
 
@@ -15,6 +15,8 @@
 #include <cassert>
 #include <set>
 #include <map>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include "Token.h"
 #include "Operator.h"
@@ -22,83 +24,110 @@
 #include "OpCodes.h"
 #include "ExprTreeNode.h"
 #include "Utilities.h"
-
-enum interpreter_modes_enum {
-  COMPILE_TIME
-  ,INTERPRETER
-
+#include "InternedString.h"
+
+// System call IDs get written out as an 8-bit payload
+#define MAX_SYSTEM_CALLS        0x100
+// param_list entry for a parameter that takes any integer or double
+#define SYS_CALL_NUMERIC_PARAM  0xFF
+// param_list entries for a parameter that has to be an array name, rather than an expression
+#define SYS_CALL_ARRAY_PARAM            0xFE    // Array of any data type
+#define SYS_CALL_NUMERIC_ARRAY_PARAM    0xFD    // Array of integers or doubles
+#define SYS_CALL_MATCHING_ARRAY_PARAM   0xFC    // Array w/ the same element data type as the preceding array parameter
+// param_list entry for an expression that has to be convertible to the preceding array parameter's element data type
+#define SYS_CALL_ELEMENT_PARAM          0xFB
+
+class RunTimeInterpreter;
+// Resolves the system call at sys_call_idx in a flattened expression
+typedef int (RunTimeInterpreter::*sysCallExecFxn) (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+
+struct system_call_struct {
+  InternedString name;
+  std::vector<uint8_t> param_list;        // DATA_TYPE_[]_OPCODE for each parameter; INVALID_OPCODE takes ANY data type
+  TokenTypeEnum ret_type;                 // INTERNAL_USE_TKN returns whichever data type its parameters are
+  bool is_pure;                           // Result depends only on its parameters, so can be resolved at compile time
+  sysCallExecFxn exec_fxn;
 };
 
-typedef interpreter_modes_enum InterpreterModesType;
+typedef system_call_struct systemCall;
 
 class BaseLanguageTerms {
 
 public:
   BaseLanguageTerms();
   virtual ~BaseLanguageTerms();
-  bool is_sngl_char_spr8r (wchar_t curr_char);
-  bool is_atomic_opr8r (wchar_t curr_char);
-  bool is_valid_opr8r (std::wstring pssbl_opr8r, uint8_t usage_mode);
-  bool is_valid_datatype (std::wstring pssbl_datatype);
-  uint8_t get_type_mask (std::wstring pssbl_opr8r);
-  int get_operand_cnt (std::wstring pssbl_opr8r);
-  std::wstring get_ternary_1st ();
-  std::wstring get_ternary_2nd ();
-  std::wstring get_statement_ender();
-  bool is_viable_var_name (std::wstring varName);
-  bool is_valid_user_data_type (std::wstring inStr);
-  bool is_reserved_word (std::wstring inStr);
-  bool is_system_call (std::wstring inStr);
+  bool is_sngl_char_spr8r (wchar_t curr_char) const;
+  bool is_atomic_opr8r (wchar_t curr_char) const;
+  bool is_valid_opr8r (const std::wstring & pssbl_opr8r, uint8_t usage_mode) const;
+  bool is_valid_datatype (const std::wstring & pssbl_datatype) const;
+  uint8_t get_type_mask (const std::wstring & pssbl_opr8r) const;
+  int get_operand_cnt (const std::wstring & pssbl_opr8r) const;
+  std::wstring get_ternary_1st () const;
+  std::wstring get_ternary_2nd () const;
+  std::wstring get_statement_ender() const;
+  bool is_viable_var_name (const std::wstring & varName) const;
+  bool is_valid_user_data_type (const std::wstring & inStr) const;
+  bool is_reserved_word (const std::wstring & inStr) const;
+  bool is_system_call (const std::wstring & inStr) const;
 
   
-  // Outer list indicates precedence level.  Multiple OPR8Rs can reside at same precedence level
-  std::list<Opr8rPrecedenceLvl> grouped_opr8rs;
-  uint8_t getOpCodeFor (std::wstring opr8r);
-  std::wstring getSrcOpr8rStrFor (uint8_t op_code);
-  int getExecOpr8rDetails (uint8_t op_code, Operator & opr8r);
-  std::wstring getUniqExecOpr8rStr (std::wstring srcStr, uint8_t req_type_mask);
-  std::wstring getDataTypeForOpCode (uint8_t op_code);
-  TokenTypeEnum getTokenTypeForOpCode (uint8_t op_code);
-  std::pair<TokenTypeEnum, uint8_t> getDataType_tknEnum_opCode (std::wstring keyword);
-  std::wstring getOpr8rsInPrecedenceList();
-  int get_system_call_details (std::wstring sys_call, std::vector<uint8_t> & param_list, TokenTypeEnum & data_type);
-  int get_num_sys_call_parameters (std::wstring sys_call, int & num_params);
-  int tkn_type_converts_to_opcode (uint8_t op_code, Token & check_token, std::wstring variable_name, std::wstring & error_msg);
-
-  void dumpTokenList (std::vector<Token> & tokenStream, std::wstring callersSrcFile, int lineNum);
-  void dumpTokenList (std::vector<Token> & tokenStream, int startIdx, std::wstring callersSrcFile, int lineNum);
-  void dumpTokenList (TokenPtrVector & tknPtrVector, std::wstring callersSrcFile, int lineNum, bool isShowDetail);
-  void dumpTokenList (TokenPtrVector & tknPtrVector, int startIdx, std::wstring callersSrcFile, int lineNum, bool isShowDetail);
-
-  // TODO: Is this the right place for these to live?
-  int append_to_flat_tkn_list (std::shared_ptr<ExprTreeNode> tree_node, std::vector<Token> & flatExprTknList);
-  int flattenExprTree (std::shared_ptr<ExprTreeNode> rootOfExpr, std::vector<Token> & flatExprTknList);
-  int flatten_system_call (std::shared_ptr<ExprTreeNode> sys_call_node, std::vector<Token> & flat_tkn_list);
-  int append_flattened_system_call (std::shared_ptr<ExprTreeNode> tree_node, std::vector<Token> & flatExprTknList);
+  // Outer vector indicates precedence level.  Multiple OPR8Rs can reside at same precedence level
+  std::vector<Opr8rPrecedenceLvl> grouped_opr8rs;
+  uint8_t getOpCodeFor (const std::wstring & opr8r) const;
+  std::wstring getSrcOpr8rStrFor (uint8_t op_code) const;
+  int getExecOpr8rDetails (uint8_t op_code, Operator & opr8r) const;
+  std::wstring getUniqExecOpr8rStr (const std::wstring & srcStr, uint8_t req_type_mask) const;
+  std::wstring getDataTypeForOpCode (uint8_t op_code) const;
+  TokenTypeEnum getTokenTypeForOpCode (uint8_t op_code) const;
+  std::pair<TokenTypeEnum, uint8_t> getDataType_tknEnum_opCode (const std::wstring & keyword) const;
+  std::wstring getOpr8rsInPrecedenceList() const;
+  int get_system_call_details (const std::wstring & sys_call, std::vector<uint8_t> & param_list, TokenTypeEnum & data_type) const;
+  int get_num_sys_call_parameters (const std::wstring & sys_call, int & num_params) const;
+  bool is_pure_system_call (const std::wstring & sys_call) const;
+  int get_system_call_id (const std::wstring & sys_call, uint8_t & sys_call_id) const;
+  const systemCall * get_system_call (uint8_t sys_call_id) const;
+  int tkn_type_converts_to_opcode (uint8_t op_code, Token & check_token, std::wstring variable_name, std::wstring & error_msg) const;
+
+  void dumpTokenList (std::vector<Token> & tokenStream, std::wstring callersSrcFile, int lineNum) const;
+  void dumpTokenList (std::vector<Token> & tokenStream, int startIdx, std::wstring callersSrcFile, int lineNum) const;
+  void dumpTokenList (TokenPtrVector & tknPtrVector, std::wstring callersSrcFile, int lineNum, bool isShowDetail) const;
+  void dumpTokenList (TokenPtrVector & tknPtrVector, int startIdx, std::wstring callersSrcFile, int lineNum, bool isShowDetail) const;
 
 protected:
-  int failed_on_src_line;  
+  // Only used as a debugging hint; the language tables themselves don't change after construction
+  mutable int failed_on_src_line;  
   std::wstring this_src_file;
   
   std::wstring atomic_1char_opr8rs;
   std::wstring _1char_spr8rs;
-  std::map<std::wstring, std::pair<TokenTypeEnum, uint8_t>> valid_data_types;
-  std::vector<std::wstring> reserved_words;
-  // system call name, {parameter list, return data_type}
-  std::map <std::wstring, std::pair <std::vector<uint8_t>, TokenTypeEnum>> system_calls;
+  std::unordered_map<std::wstring, std::pair<TokenTypeEnum, uint8_t>> valid_data_types;
+  std::unordered_set<std::wstring> reserved_words;
+  // Indexed by system call ID, which is what gets written to the interpreted file
+  std::vector<systemCall> system_calls;
   std::wstring ternary_1st;
   std::wstring ternary_2nd;
   std::wstring statement_ender;
-  std::map <std::wstring, Operator> execTimeOpr8rMap;
+  std::unordered_map <std::wstring, Operator> execTimeOpr8rMap;
   std::map <std::wstring, std::wstring> execToSrcOpr8rMap;
 
   void validityCheck();
-
+  void buildLookupTables();
 
 private:
-  int makeFlatExpr_OLR (std::shared_ptr<ExprTreeNode> currBranch, std::vector<Token> & flatExprTknList);
   Utilities util;
 
+  // Lookup tables derived from the definitions above by buildLookupTables
+  // GNR8D_SRC OPR8Rs indexed by op_code
+  std::vector<Operator> execOpr8rsByOpCode;
+  // Every definition of a symbol, in precedence order; e.g. [++] is both POSTFIX and PREFIX
+  std::unordered_map<std::wstring, std::vector<Operator>> opr8rsBySymbol;
+  // Ambiguous source OPR8R -> exec OPR8R candidates; e.g. [+] -> [+U] [B+]
+  std::unordered_map<std::wstring, std::vector<std::wstring>> srcToExecOpr8rs;
+  // Data type op_code -> Token type
+  std::vector<TokenTypeEnum> tknTypesByOpCode;
+  // System call name -> ID
+  std::unordered_map<std::wstring, uint8_t> sysCallIdsByName;
+
 };
 
 #endif /* BASELANGUAGETERMS_H_ */
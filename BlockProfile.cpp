@@ -0,0 +1,125 @@
+/*
+ * BlockProfile.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ *
+ * Execution counts for [if] [else if] [else] blocks, keyed by the line and
+ * column of the keyword that opened each block.  The RunTimeInterpreter counts
+ * a block every time it runs, and the counts get saved to a plain text file
+ * after the run.  The next compile of the same source loads them back in and
+ * uses them to put the hottest blocks of a chain 1st.
+ *
+ * # <user source file name>
+ * <line #> <column #> <hit count>
+ * ...
+ *
+ * Counts saved for a different source file don't get loaded.  Editing the
+ * source moves blocks around, so stale counts only affect the order blocks get
+ * checked in, never which block gets run.
+ */
+
+#include "BlockProfile.h"
+#include <fstream>
+#include <sstream>
+#include "common.h"
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+BlockProfile::BlockProfile(std::string profileFileName, std::wstring userSrcFileName) {
+  profile_file_name = profileFileName;
+  usr_src_file_name = userSrcFileName;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+BlockProfile::~BlockProfile() {
+  hit_counts.clear();
+}
+
+/* ****************************************************************************
+ * A missing profile file just means there's nothing to go on yet
+ * ***************************************************************************/
+int BlockProfile::load ()  {
+  int ret_code = GENERAL_FAILURE;
+  std::wifstream profileStream (profile_file_name);
+  std::wstring textLine;
+
+  hit_counts.clear();
+
+  if (!profileStream.is_open())  {
+    ret_code = OK;
+
+  } else if (!std::getline (profileStream, textLine) || textLine != L"# " + usr_src_file_name)  {
+    // Counts from some other source file are no good to us
+    ret_code = OK;
+
+  } else  {
+    ret_code = OK;
+
+    while (OK == ret_code && std::getline (profileStream, textLine))  {
+      std::wstringstream lineStream (textLine);
+      uint32_t line_num, col_pos;
+      uint64_t hit_cnt;
+
+      if (lineStream >> line_num >> col_pos >> hit_cnt)
+        hit_counts[{line_num, col_pos}] = hit_cnt;
+      else if (!textLine.empty())
+        ret_code = GENERAL_FAILURE;
+    }
+
+    if (OK != ret_code)
+      hit_counts.clear();
+  }
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+int BlockProfile::save ()  {
+  int ret_code = GENERAL_FAILURE;
+  std::wofstream profileStream (profile_file_name, std::ios::out | std::ios::trunc);
+
+  if (profileStream.is_open())  {
+    profileStream << L"# " << usr_src_file_name << std::endl;
+
+    for (auto & count : hit_counts)
+      profileStream << count.first.first << L" " << count.first.second << L" " << count.second << std::endl;
+
+    profileStream.close();
+    if (!profileStream.fail())
+      ret_code = OK;
+  }
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+void BlockProfile::countHit (uint32_t line_num, uint32_t col_pos)  {
+  hit_counts[{line_num, col_pos}]++;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+uint64_t BlockProfile::getHitCount (uint32_t line_num, uint32_t col_pos)  {
+  uint64_t hit_cnt = 0;
+
+  if (auto search = hit_counts.find ({line_num, col_pos}); search != hit_counts.end())
+    hit_cnt = search->second;
+
+  return (hit_cnt);
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+bool BlockProfile::isEmpty ()  {
+  return (hit_counts.empty());
+}
@@ -0,0 +1,37 @@
+/*
+ * BlockProfile.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ */
+
+#ifndef BLOCKPROFILE_H_
+#define BLOCKPROFILE_H_
+
+#include <string>
+#include <map>
+#include <utility>
+#include <cstdint>
+
+// Where a [if] [else if] block's opening keyword sits in the user's source
+typedef std::pair<uint32_t, uint32_t> blockLineCol;
+
+class BlockProfile {
+public:
+  BlockProfile(std::string profileFileName, std::wstring userSrcFileName);
+  virtual ~BlockProfile();
+
+  int load ();
+  int save ();
+  void countHit (uint32_t line_num, uint32_t col_pos);
+  uint64_t getHitCount (uint32_t line_num, uint32_t col_pos);
+  bool isEmpty ();
+
+private:
+  std::string profile_file_name;
+  std::wstring usr_src_file_name;
+  std::map <blockLineCol, uint64_t> hit_counts;
+
+};
+
+#endif /* BLOCKPROFILE_H_ */
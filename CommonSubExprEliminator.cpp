@@ -0,0 +1,339 @@
+/*
+ * CommonSubExprEliminator.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ *
+ * Compile time pass over a type checked, constant folded ExprTreeNode tree that
+ * finds structurally identical, side effect free sub-trees within the same
+ * expression so they only get evaluated once at run time.
+ *
+ * (one * two + three) * (one * two + three) + one * two
+ * [B+][*][=tmp][tmp::0][B+][=tmp][tmp::1][*][one][two][three][tmp::0][tmp::1]
+ *
+ * The 1st occurrence is wrapped in a [=tmp] OPR8R that saves its result off to
+ * a temp slot; every later occurrence is replaced by that [tmp::N] slot.  The
+ * RunTimeInterpreter always resolves the left most ready OPR8R first, so the
+ * [=tmp] is guaranteed to run before any [tmp::N] to its right gets used, as
+ * long as the [=tmp] isn't in a spot that could get short-circuited.
+ *
+ * A sub-tree is only shared if it has no assignments, [pre|post]-fix OPR8Rs or
+ * impure system calls, and none of its variables get written anywhere in the
+ * expression.  Bigger sub-trees are claimed first.
+ */
+
+#include "CommonSubExprEliminator.h"
+#include <iostream>
+#include <map>
+#include <algorithm>
+#include "InfoWarnError.h"
+#include "OpCodes.h"
+#include "common.h"
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+CommonSubExprEliminator::CommonSubExprEliminator(const CompileExecTerms & inExecTerms, std::shared_ptr<UserMessages> userMessages)
+  : execTerms (inExecTerms)  {
+
+  this->userMessages = userMessages;
+  thisSrcFile = util.getLastSegment(util.stringToWstring(__FILE__), L"/");
+  failed_on_src_line = 0;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+CommonSubExprEliminator::~CommonSubExprEliminator() {
+  if (failed_on_src_line > 0 && !userMessages->isExistsInternalError(thisSrcFile, failed_on_src_line))  {
+    // Dump out a debugging hint
+    std::wcout << L"FAILURE on " << thisSrcFile << L":" << failed_on_src_line << std::endl;
+  }
+}
+
+/* ****************************************************************************
+ * Share every common sub-expression under rootOfExpr in place.  Not finding
+ * anything to share is not a failure; a malformed tree is.
+ * ***************************************************************************/
+int CommonSubExprEliminator::eliminateCommonSubExprs (std::shared_ptr<ExprTreeNode> rootOfExpr) {
+  int ret_code = GENERAL_FAILURE;
+  std::set<std::wstring> writtenVars;
+  std::vector<cseNodeInfo> flatNodes;
+  bool isPure, isVarFree;
+
+  if (OK != collectWrittenVars_OLR (rootOfExpr, writtenVars)) {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (OK != collectNodes_OLR (rootOfExpr, false, writtenVars, flatNodes, isPure, isVarFree))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    // Occurrences of each candidate sub-tree, in the order they'll be evaluated
+    std::map<std::wstring, std::vector<int>> occurrences;
+    std::vector<std::wstring> keysBySize;
+    int idx;
+
+    for (idx = 0; idx < flatNodes.size(); idx++) {
+      if (flatNodes[idx].is_candidate)  {
+        if (occurrences[flatNodes[idx].key].empty())
+          keysBySize.push_back (flatNodes[idx].key);
+        occurrences[flatNodes[idx].key].push_back (idx);
+      }
+    }
+
+    std::stable_sort (keysBySize.begin(), keysBySize.end(), [&] (const std::wstring & key1, const std::wstring & key2) {
+      return flatNodes[occurrences[key1][0]].num_nodes > flatNodes[occurrences[key2][0]].num_nodes;
+    });
+
+    // Sub-trees that will be replaced by a [tmp::N]; anything inside of them is gone
+    std::vector<std::pair<int, int>> loadRanges;
+    std::vector<std::pair<int, uint8_t>> stores;
+    std::vector<std::pair<int, uint8_t>> loads;
+    int numSlots = 0;
+
+    for (auto keyR8r = keysBySize.begin(); keyR8r != keysBySize.end() && numSlots < MAX_TEMP_SLOTS; keyR8r++)  {
+      std::vector<int> visible;
+
+      for (int occurIdx : occurrences[*keyR8r]) {
+        bool isHidden = false;
+        for (auto & range : loadRanges) {
+          if (occurIdx > range.first && occurIdx < range.second)
+            isHidden = true;
+        }
+
+        if (!isHidden)
+          visible.push_back (occurIdx);
+      }
+
+      if (visible.size() >= 2 && !flatNodes[visible[0]].is_conditional)  {
+        stores.push_back ({visible[0], numSlots});
+        for (idx = 1; idx < visible.size(); idx++) {
+          loads.push_back ({visible[idx], numSlots});
+          loadRanges.push_back ({visible[idx], flatNodes[visible[idx]].sub_tree_end});
+        }
+        numSlots++;
+      }
+    }
+
+    for (auto & store : stores)
+      makeTempStore (flatNodes[store.first].node, store.second);
+
+    for (auto & load : loads)
+      makeTempLoad (flatNodes[load.first].node, load.second);
+
+    ret_code = OK;
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * Variables written to by an assignment or [pre|post]-fix OPR8R anywhere in
+ * this expression
+ * ***************************************************************************/
+int CommonSubExprEliminator::collectWrittenVars_OLR (std::shared_ptr<ExprTreeNode> currNode, std::set<std::wstring> & writtenVars) {
+  int ret_code = GENERAL_FAILURE;
+  uint8_t op_code;
+
+  if (currNode == NULL || currNode->originalTkn == NULL)  {
+    userMessages->logMsg (INTERNAL_ERROR, L"Unexpected NULL expression tree node", thisSrcFile, __LINE__, 0);
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    if (isOpr8rNode (currNode, op_code) && isWritingOpr8r (op_code) && currNode->_1stChild != NULL
+      && currNode->_1stChild->originalTkn->tkn_type == USER_WORD_TKN)
+      writtenVars.insert (currNode->_1stChild->originalTkn->_string);
+
+    ret_code = OK;
+    for (auto param : currNode->parameter_list) {
+      if (OK != collectWrittenVars_OLR (param, writtenVars))
+        ret_code = GENERAL_FAILURE;
+    }
+
+    if (currNode->_1stChild != NULL && OK != collectWrittenVars_OLR (currNode->_1stChild, writtenVars))
+      ret_code = GENERAL_FAILURE;
+
+    if (currNode->_2ndChild != NULL && OK != collectWrittenVars_OLR (currNode->_2ndChild, writtenVars))
+      ret_code = GENERAL_FAILURE;
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * Flatten the tree in the same [OPR8R][1st][2nd] order it gets written out and
+ * executed in, figuring out a structural key for every node along the way.
+ * isConditional tracks whether the node sits somewhere that could get
+ * short-circuited: the right side of [&&]|[||] or either [?] path.
+ * ***************************************************************************/
+int CommonSubExprEliminator::collectNodes_OLR (std::shared_ptr<ExprTreeNode> currNode, bool isConditional
+  , std::set<std::wstring> & writtenVars, std::vector<cseNodeInfo> & flatNodes, bool & isPure, bool & isVarFree) {
+  int ret_code = GENERAL_FAILURE;
+  uint8_t op_code = INVALID_OPCODE;
+  int myIdx = flatNodes.size();
+  Token & currTkn = *currNode->originalTkn;
+
+  isPure = true;
+  isVarFree = true;
+  flatNodes.push_back ({currNode, L"", 0, 1, false, isConditional});
+
+  if (currTkn.tkn_type == SYSTEM_CALL_TKN)  {
+    std::wstring key = L"sys_call::" + currTkn._string + L"(";
+    ret_code = OK;
+
+    isPure = execTerms.is_pure_system_call (currTkn._string);
+    for (auto param : currNode->parameter_list) {
+      bool isParamPure, isParamVarFree;
+      int paramIdx = flatNodes.size();
+
+      if (OK != collectNodes_OLR (param, isConditional, writtenVars, flatNodes, isParamPure, isParamVarFree))  {
+        ret_code = GENERAL_FAILURE;
+        break;
+      }
+      isPure = isPure && isParamPure;
+      isVarFree = isVarFree && isParamVarFree;
+      key.append (flatNodes[paramIdx].key + L",");
+    }
+    key.append (L")");
+    flatNodes[myIdx].key = key;
+    flatNodes[myIdx].is_candidate = isPure && !isVarFree;
+
+  } else if (isOpr8rNode (currNode, op_code))  {
+    std::wstring key = L"(" + std::to_wstring(op_code);
+    bool is1stConditional = isConditional;
+    bool is2ndConditional = isConditional || op_code == LOGICAL_AND_OPR8R_OPCODE || op_code == LOGICAL_OR_OPR8R_OPCODE;
+
+    if (op_code == TERNARY_2ND_OPR8R_OPCODE)  {
+      // Only 1 of the [?] paths gets taken
+      is1stConditional = true;
+      is2ndConditional = true;
+    }
+
+    ret_code = OK;
+    // An array element can get written to w/o its array name showing up as written to
+    isPure = !isWritingOpr8r (op_code) && op_code != ARRAY_ELEMENT_OPR8R_OPCODE;
+
+    if (currNode->_1stChild != NULL)  {
+      bool isRandPure, isRandVarFree;
+      int randIdx = flatNodes.size();
+
+      if (OK != collectNodes_OLR (currNode->_1stChild, is1stConditional, writtenVars, flatNodes, isRandPure, isRandVarFree))  {
+        ret_code = GENERAL_FAILURE;
+      } else  {
+        isPure = isPure && isRandPure;
+        isVarFree = isVarFree && isRandVarFree;
+        key.append (L" " + flatNodes[randIdx].key);
+      }
+    }
+
+    if (OK == ret_code && currNode->_1stChild != NULL && currNode->_2ndChild != NULL)  {
+      bool isRandPure, isRandVarFree;
+      int randIdx = flatNodes.size();
+
+      if (OK != collectNodes_OLR (currNode->_2ndChild, is2ndConditional, writtenVars, flatNodes, isRandPure, isRandVarFree))  {
+        ret_code = GENERAL_FAILURE;
+      } else  {
+        isPure = isPure && isRandPure;
+        isVarFree = isVarFree && isRandVarFree;
+        key.append (L" " + flatNodes[randIdx].key);
+      }
+    }
+
+    key.append (L")");
+    flatNodes[myIdx].key = key;
+    // [;], [?] and [:] aren't stand-alone values worth saving off
+    flatNodes[myIdx].is_candidate = isPure && !isVarFree && op_code != STATEMENT_ENDER_OPR8R_OPCODE
+      && op_code != TERNARY_1ST_OPR8R_OPCODE && op_code != TERNARY_2ND_OPR8R_OPCODE;
+
+  } else  {
+    // Leaf node; the data type is part of the key so [5] and [5u] don't get mixed up
+    if (currTkn.tkn_type == USER_WORD_TKN)  {
+      isVarFree = false;
+      // A variable written to elsewhere in the expression could change in between uses
+      isPure = (writtenVars.count (currTkn._string) == 0);
+    }
+
+    flatNodes[myIdx].key = std::to_wstring(currTkn.tkn_type) + L":" + currTkn._string + L":" + currTkn.getValueStr();
+    ret_code = OK;
+  }
+
+  flatNodes[myIdx].sub_tree_end = flatNodes.size();
+  flatNodes[myIdx].num_nodes = flatNodes.size() - myIdx;
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * currNode -> [=tmp][tmp::N][currNode's sub-tree]
+ * ***************************************************************************/
+void CommonSubExprEliminator::makeTempStore (std::shared_ptr<ExprTreeNode> currNode, uint8_t slotNum)  {
+  std::shared_ptr<ExprTreeNode> valueNode = std::make_shared<ExprTreeNode> (currNode->originalTkn);
+  valueNode->_1stChild = currNode->_1stChild;
+  valueNode->_2ndChild = currNode->_2ndChild;
+  valueNode->parameter_list = currNode->parameter_list;
+  valueNode->resultTypes = currNode->resultTypes;
+  valueNode->treeParent = currNode;
+
+  if (valueNode->_1stChild != NULL)
+    valueNode->_1stChild->treeParent = valueNode;
+  if (valueNode->_2ndChild != NULL)
+    valueNode->_2ndChild->treeParent = valueNode;
+  for (auto param : valueNode->parameter_list)
+    param->treeParent = valueNode;
+
+  std::shared_ptr<Token> storeTkn = std::make_shared<Token> (EXEC_OPR8R_TKN, TEMP_STORE_OPR8R);
+  storeTkn->_unsigned = TEMP_STORE_OPR8R_OPCODE;
+  std::shared_ptr<Token> slotTkn = std::make_shared<Token> (TEMP_SLOT_TKN, L"");
+  slotTkn->_unsigned = slotNum;
+  std::shared_ptr<ExprTreeNode> slotNode = std::make_shared<ExprTreeNode> (slotTkn);
+  slotNode->resultTypes = currNode->resultTypes;
+  slotNode->treeParent = currNode;
+
+  currNode->originalTkn = storeTkn;
+  currNode->_1stChild = slotNode;
+  currNode->_2ndChild = valueNode;
+  currNode->parameter_list.clear();
+}
+
+/* ****************************************************************************
+ * currNode -> [tmp::N]
+ * ***************************************************************************/
+void CommonSubExprEliminator::makeTempLoad (std::shared_ptr<ExprTreeNode> currNode, uint8_t slotNum)  {
+  std::shared_ptr<Token> slotTkn = std::make_shared<Token> (TEMP_SLOT_TKN, L"");
+  slotTkn->_unsigned = slotNum;
+
+  currNode->originalTkn = slotTkn;
+  currNode->_1stChild.reset();
+  currNode->_2ndChild.reset();
+  currNode->parameter_list.clear();
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+bool CommonSubExprEliminator::isOpr8rNode (std::shared_ptr<ExprTreeNode> currNode, uint8_t & op_code) {
+  bool isOpr8r = false;
+  op_code = INVALID_OPCODE;
+
+  if (currNode->originalTkn->tkn_type == SRC_OPR8R_TKN) {
+    if (currNode->originalTkn->_string == execTerms.get_statement_ender())
+      op_code = STATEMENT_ENDER_OPR8R_OPCODE;
+    else
+      op_code = execTerms.getOpCodeFor (currNode->originalTkn->_string);
+    isOpr8r = true;
+
+  } else if (currNode->originalTkn->tkn_type == EXEC_OPR8R_TKN) {
+    op_code = currNode->originalTkn->_unsigned;
+    isOpr8r = true;
+  }
+
+  return isOpr8r;
+}
+
+/* ****************************************************************************
+ * Assignments and [pre|post]-fix OPR8Rs change the variable they operate on
+ * ***************************************************************************/
+bool CommonSubExprEliminator::isWritingOpr8r (uint8_t op_code) {
+  return ((op_code >= POST_INCR_OPR8R_OPCODE && op_code <= PRE_DECR_OPR8R_OPCODE)
+    || (op_code >= ASSIGNMENT_OPR8R_OPCODE && op_code <= BITWISE_OR_ASSIGN_OPR8R_OPCODE));
+}
@@ -0,0 +1,61 @@
+/*
+ * CommonSubExprEliminator.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ */
+
+#ifndef COMMONSUBEXPRELIMINATOR_H_
+#define COMMONSUBEXPRELIMINATOR_H_
+
+#include <string>
+#include <memory>
+#include <vector>
+#include <set>
+#include <cstdint>
+#include "CompileExecTerms.h"
+#include "ExprTreeNode.h"
+#include "Token.h"
+#include "Utilities.h"
+#include "UserMessages.h"
+
+// Temp slot # has to fit in TEMP_SLOT_OPCODE's 8-bit payload
+#define MAX_TEMP_SLOTS  256
+
+struct cse_node_info_struct {
+  std::shared_ptr<ExprTreeNode> node;
+  std::wstring key;                     // Structurally identical sub-trees get identical keys
+  int sub_tree_end;                     // Index just past this node's sub-tree, in flattened order
+  int num_nodes;
+  bool is_candidate;                    // Pure OPR8R|system call sub-tree that could be shared
+  bool is_conditional;                  // Might get short-circuited at run time
+};
+
+typedef cse_node_info_struct cseNodeInfo;
+
+class CommonSubExprEliminator {
+public:
+  CommonSubExprEliminator(const CompileExecTerms & inExecTerms, std::shared_ptr<UserMessages> userMessages);
+  virtual ~CommonSubExprEliminator();
+
+  int eliminateCommonSubExprs (std::shared_ptr<ExprTreeNode> rootOfExpr);
+
+private:
+  const CompileExecTerms & execTerms;
+  std::shared_ptr<UserMessages> userMessages;
+  std::wstring thisSrcFile;
+  Utilities util;
+  int failed_on_src_line;
+
+  int collectWrittenVars_OLR (std::shared_ptr<ExprTreeNode> currNode, std::set<std::wstring> & writtenVars);
+  int collectNodes_OLR (std::shared_ptr<ExprTreeNode> currNode, bool isConditional, std::set<std::wstring> & writtenVars
+    , std::vector<cseNodeInfo> & flatNodes, bool & isPure, bool & isVarFree);
+  void makeTempStore (std::shared_ptr<ExprTreeNode> currNode, uint8_t slotNum);
+  void makeTempLoad (std::shared_ptr<ExprTreeNode> currNode, uint8_t slotNum);
+
+  bool isOpr8rNode (std::shared_ptr<ExprTreeNode> currNode, uint8_t & op_code);
+  bool isWritingOpr8r (uint8_t op_code);
+
+};
+
+#endif /* COMMONSUBEXPRELIMINATOR_H_ */
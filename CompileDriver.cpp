@@ -26,11 +26,12 @@
  *
  * FUTURE:
  * Disassembler
- * Array support
+ * Multi-dimensional arrays; array initializer lists
  * Directory/index for fxn calls so Interpreter doesn't have to search through the object
  * file for the location. It can do a quick(er) lookup
  *
  * RECENTLY DONE:
+ * 1 dimensional arrays of a single data type, plus whole-array system calls
  * Make ILLUSTRATIVE a flag option
  * Illustrative - display a tree; make the formatting look nice
  * Illustrative mode - verbose output for instructional purposes
@@ -90,11 +91,39 @@
 #include "Token.h"
 #include "Utilities.h"
 #include "GeneralParser.h"
+#include "BlockProfile.h"
+#include <cctype>
 #include <iostream>
 #include <string>
 
 using namespace std;
 logLvlEnum logLevel = SILENT;
+exprParserEnum exprParserType = PRECEDENCE_LVL_PARSER;
+optimizeLvlEnum optimizeLevel = FULL_OPTIMIZATION;
+bool isOptimizeLvlSet = false;
+int maxUnrollTrips = DEFAULT_MAX_UNROLL_TRIPS;
+int unrollFactor = DEFAULT_UNROLL_FACTOR;
+std::string profileFileName;
+std::string programOutputFileName;
+flushPolicyEnum flushPolicy = FLUSH_EACH_LINE;
+bool isFlushPolicySet = false;
+
+/* ****************************************************************************
+ * Small, non-negative whole # for loop unrolling settings
+ * ***************************************************************************/
+bool getUnrollSetting (std::string value, int & setting)  {
+  bool isGood = !value.empty() && value.length() <= 2;
+
+  for (int idx = 0; isGood && idx < value.length(); idx++)
+    isGood = std::isdigit (value[idx]);
+
+  if (isGood)  {
+    setting = std::stoi (value);
+    isGood = (setting <= MAX_UNROLL_SETTING);
+  }
+
+  return (isGood);
+}
 
 /* ****************************************************************************
  *
@@ -139,6 +168,81 @@ bool isCmdLineArgsOK (int argc, const char * argv[])  {
           isFailed = true;
         }
       
+      } else if (nextArg.compare("-p") == 0 || nextArg.compare("--expr_parser") == 0)  {
+        // Pratt parser is opt-in until it has been proven out against the precedence level parser
+        if (nextValue.compare ("PRECEDENCE_LVL") == 0)  {
+          exprParserType = PRECEDENCE_LVL_PARSER;
+          completedArgCnt++;
+
+        } else if (nextValue.compare ("PRATT") == 0) {
+          exprParserType = PRATT_PARSER;
+          completedArgCnt++;
+
+        } else  {
+          isFailed = true;
+        }
+
+      } else if (nextArg.compare("-O") == 0 || nextArg.compare("--optimize") == 0)  {
+        if (nextValue.compare ("NONE") == 0)  {
+          optimizeLevel = NO_OPTIMIZATION;
+          isOptimizeLvlSet = true;
+          completedArgCnt++;
+
+        } else if (nextValue.compare ("FULL") == 0) {
+          optimizeLevel = FULL_OPTIMIZATION;
+          isOptimizeLvlSet = true;
+          completedArgCnt++;
+
+        } else  {
+          isFailed = true;
+        }
+
+      } else if (nextArg.compare("-u") == 0 || nextArg.compare("--unroll_trips") == 0)  {
+        // [for] loops with up to this many trips get fully unrolled; 0 turns unrolling off
+        if (getUnrollSetting (nextValue, maxUnrollTrips))
+          completedArgCnt++;
+        else
+          isFailed = true;
+
+      } else if (nextArg.compare("-f") == 0 || nextArg.compare("--unroll_factor") == 0)  {
+        // # of trips per unrolled block for longer [for] loops; 0 or 1 only does full unrolling
+        if (getUnrollSetting (nextValue, unrollFactor))
+          completedArgCnt++;
+        else
+          isFailed = true;
+
+      } else if (nextArg.compare("-P") == 0 || nextArg.compare("--profile") == 0)  {
+        // Block run counts from the last run get used to order [if] chains, then get replaced by this run's counts
+        profileFileName = nextValue;
+        completedArgCnt++;
+
+      } else if (nextArg.compare("-o") == 0 || nextArg.compare("--output") == 0)  {
+        // Where print_line output goes; STDOUT unless a file is given
+        if (nextValue.compare ("STDOUT") != 0)
+          programOutputFileName = nextValue;
+        completedArgCnt++;
+
+      } else if (nextArg.compare("-F") == 0 || nextArg.compare("--flush") == 0)  {
+        // Default is LINE when output goes to a terminal, SIZE otherwise
+        if (nextValue.compare ("LINE") == 0)  {
+          flushPolicy = FLUSH_EACH_LINE;
+          isFlushPolicySet = true;
+          completedArgCnt++;
+
+        } else if (nextValue.compare ("SIZE") == 0) {
+          flushPolicy = FLUSH_ON_SIZE;
+          isFlushPolicySet = true;
+          completedArgCnt++;
+
+        } else if (nextValue.compare ("EXIT") == 0) {
+          flushPolicy = FLUSH_AT_EXIT;
+          isFlushPolicySet = true;
+          completedArgCnt++;
+
+        } else  {
+          isFailed = true;
+        }
+
        } else {
         isFailed = true;
       }
@@ -181,8 +285,14 @@ int main(int argc, const char * argv[])
     else 
       isArgsOK = true;
 
+    if (isArgsOK && !isOptimizeLvlSet && logLevel >= ILLUSTRATIVE)
+      // ILLUSTRATIVE output is meant to show the user's own expressions being resolved step by step,
+      // so don't fold them away unless the user explicitly asked for optimization
+      optimizeLevel = NO_OPTIMIZATION;
+
     if (isArgsOK) {
       TokenPtrVector tokenStream;
+      // Language definition tables are built once and shared by const & with every stage
       CompileExecTerms srcExecTerms;
       FileParser fileParser (srcExecTerms, userSrcFileName);
       if (OK == fileParser.gnr8_token_stream(input_file_path, tokenStream)) {
@@ -195,7 +305,15 @@ int main(int argc, const char * argv[])
         std::shared_ptr<StackOfScopes> rootScope = std::make_shared <StackOfScopes> ();
         // TODO: Previously passing &, but it appeared to be behaving like a copy: UserMessages userMessages;
         std::shared_ptr<UserMessages> userMessages = std::make_shared <UserMessages> ();
-        GeneralParser generalParser (tokenStream, userSrcFileName, srcExecTerms, userMessages, output_file_name, rootScope, logLevel);
+        std::shared_ptr<BlockProfile> lastRunProfile;
+        if (!profileFileName.empty())  {
+          lastRunProfile = std::make_shared <BlockProfile> (profileFileName, userSrcFileName);
+          if (OK != lastRunProfile->load())
+            std::wcout << L"Ignoring malformed profile " << util.stringToWstring(profileFileName) << std::endl;
+        }
+
+        GeneralParser generalParser (tokenStream, userSrcFileName, srcExecTerms, userMessages, output_file_name, rootScope, logLevel, exprParserType
+          , optimizeLevel, maxUnrollTrips, unrollFactor, lastRunProfile);
 
         std::wcout << std::endl << L"/* *************** <COMPILATION STAGE> **************** */" << std::endl;
         int compileRetCode = generalParser.compileRootScope();
@@ -215,12 +333,32 @@ int main(int argc, const char * argv[])
           std::shared_ptr<UserMessages> execMessages = std::make_shared <UserMessages> ();
           std::shared_ptr<StackOfScopes> execVarScope = std::make_shared <StackOfScopes> ();
     
-          RunTimeInterpreter interpreter (interpretedFileName, userSrcFileName, execVarScope, execMessages, logLevel);
+          std::shared_ptr<BlockProfile> thisRunProfile;
+          if (!profileFileName.empty())
+            thisRunProfile = std::make_shared <BlockProfile> (profileFileName, userSrcFileName);
+
+          sinkDestEnum outputDest = programOutputFileName.empty() ? SINK_TO_STDOUT : SINK_TO_FILE;
+          if (logLevel >= ILLUSTRATIVE)
+            // Program output has to stay in step with the ILLUSTRATIVE output around it
+            flushPolicy = FLUSH_EACH_LINE;
+          else if (!isFlushPolicySet)
+            flushPolicy = OutputSink::getDefaultFlushPolicy (outputDest);
+          std::shared_ptr<OutputSink> programOutput = std::make_shared <OutputSink> (outputDest, flushPolicy, programOutputFileName);
+
+          RunTimeInterpreter interpreter (srcExecTerms, interpretedFileName, userSrcFileName, execVarScope, execMessages, logLevel
+            , thisRunProfile, programOutput);
 
           std::wcout << std::endl;
           std::wcout << L"/* *************** <INTERPRETER STAGE> **************** */" << std::endl;
-          ret_code = interpreter.execRootScope();
+          if (!programOutput->isOpen())
+            std::wcout << L"Failed to open output file " << util.stringToWstring(programOutputFileName) << std::endl;
+          else
+            ret_code = interpreter.execRootScope();
+          if (OK != programOutput->flush())
+            std::wcout << L"Failed writing out program output" << std::endl;
           std::wcout << L"Interpreter ret_code = " << ret_code << std::endl << std::endl;
+          if (ret_code == OK && thisRunProfile != NULL && OK != thisRunProfile->save())
+            std::wcout << L"Failed to save profile " << util.stringToWstring(profileFileName) << std::endl;
           // execMessages->showMessagesByInsertOrder(true);
           execMessages->showMessagesByGroup();
           execVarScope->displayVariables();
@@ -9,6 +9,7 @@
 
 #include "CompileExecTerms.h"
 #include "OpCodes.h"
+#include "RunTimeInterpreter.h"
 #include "Token.h"
 #include "common.h"
 #include "locale_strings.h"
@@ -27,6 +28,9 @@ CompileExecTerms::CompileExecTerms() {
   execToSrcOpr8rMap.insert (std::pair {POST_INCR_OPR8R, L"++"});
   grouped_opr8rs.back().opr8rs.push_back ( Operator (POST_DECR_OPR8R, POSTFIX, GNR8D_SRC, 1, 1, POST_DECR_OPR8R_OPCODE, L"-1 AFTER using"));   // NOTE: Pre-fix and post-fix precedence is different
   execToSrcOpr8rMap.insert (std::pair {POST_DECR_OPR8R, L"--"});
+  // Only generated by the compiler from [name][index]; the array name and the index are its operands
+  grouped_opr8rs.back().opr8rs.push_back ( Operator (ARRAY_ELEMENT_OPR8R, BINARY, GNR8D_SRC, 2, 2, ARRAY_ELEMENT_OPR8R_OPCODE, L"Array element"));
+  execToSrcOpr8rMap.insert (std::pair {ARRAY_ELEMENT_OPR8R, L"[]"});
 
   grouped_opr8rs.push_back(Opr8rPrecedenceLvl ());
   grouped_opr8rs.back().opr8rs.push_back ( Operator (L"++", PREFIX, USR_SRC, 1, 0, INVALID_OPCODE, L""));
@@ -47,7 +51,6 @@ CompileExecTerms::CompileExecTerms() {
   grouped_opr8rs.back().opr8rs.push_back ( Operator (L"~", UNARY, (USR_SRC|GNR8D_SRC), 1, 1, BITWISE_NOT_OPR8R_OPCODE, L"Bitwise NOT"));
 
   //  TODO: ()  Function call
-  //  TODO: []  Array subscripting
 
   // TODO: Unary plus and minus has precedence over binary
 
@@ -61,6 +64,8 @@ CompileExecTerms::CompileExecTerms() {
   grouped_opr8rs.back().opr8rs.push_back ( Operator (L"+", BINARY, USR_SRC, 2, 0, INVALID_OPCODE, L""));
   grouped_opr8rs.back().opr8rs.push_back ( Operator (BINARY_PLUS_OPR8R, BINARY, GNR8D_SRC, 2, 2, BINARY_PLUS_OPR8R_OPCODE, L"Add"));
   execToSrcOpr8rMap.insert (std::pair {BINARY_PLUS_OPR8R, L"+"});
+  // Only generated by the compiler from a chain of STRING [+] OPR8Rs; [# of pieces] + 3 pieces is the fewest operands it can have
+  grouped_opr8rs.back().opr8rs.push_back ( Operator (CONCAT_N_OPR8R, BINARY, GNR8D_SRC, 2, 4, CONCAT_N_OPR8R_OPCODE, L"Concatenate strings"));
 
   grouped_opr8rs.back().opr8rs.push_back ( Operator (L"-", BINARY, USR_SRC, 2, 0, INVALID_OPCODE, L""));
   grouped_opr8rs.back().opr8rs.push_back ( Operator (BINARY_MINUS_OPR8R, BINARY, GNR8D_SRC, 2, 2, BINARY_MINUS_OPR8R_OPCODE, L"Subtract"));
@@ -104,6 +109,8 @@ CompileExecTerms::CompileExecTerms() {
   //  opr8r is encountered.
   grouped_opr8rs.push_back(Opr8rPrecedenceLvl ());
   grouped_opr8rs.back().opr8rs.push_back ( Operator (L"?", (BINARY|TERNARY_1ST), (USR_SRC|GNR8D_SRC), 2, 3, TERNARY_1ST_OPR8R_OPCODE, L"Ternary (if-else)"));
+  // Only generated by the compiler from a chain of [?] OPR8Rs; 3 is the fewest operands it can have
+  grouped_opr8rs.back().opr8rs.push_back ( Operator (LOOKUP_SELECT_OPR8R, BINARY, GNR8D_SRC, 2, 3, LOOKUP_SELECT_OPR8R_OPCODE, L"Select by lookup table"));
 
   grouped_opr8rs.push_back(Opr8rPrecedenceLvl ());
   grouped_opr8rs.back().opr8rs.push_back ( Operator (L":", (BINARY|TERNARY_2ND), (USR_SRC|GNR8D_SRC), 2, 2, TERNARY_2ND_OPR8R_OPCODE, L"Ternary (divs TRUE|FALSE paths)"));
@@ -120,6 +127,8 @@ CompileExecTerms::CompileExecTerms() {
   grouped_opr8rs.back().opr8rs.push_back ( Operator (L"&=", BINARY, (USR_SRC|GNR8D_SRC), 2, 2, BITWISE_AND_ASSIGN_OPR8R_OPCODE, L"Bitwise AND & assign"));
   grouped_opr8rs.back().opr8rs.push_back ( Operator (L"^=", BINARY, (USR_SRC|GNR8D_SRC), 2, 2, BITWISE_XOR_ASSIGN_OPR8R_OPCODE, L"Bitwise XOR & assign"));
   grouped_opr8rs.back().opr8rs.push_back ( Operator (L"|=", BINARY, (USR_SRC|GNR8D_SRC), 2, 2, BITWISE_OR_ASSIGN_OPR8R_OPCODE, L"Bitwise OR & assign"));
+  // Only generated by the compiler; saves a common sub-expression's result so later uses in the same expression can reuse it
+  grouped_opr8rs.back().opr8rs.push_back ( Operator (TEMP_STORE_OPR8R, BINARY, GNR8D_SRC, 2, 2, TEMP_STORE_OPR8R_OPCODE, L"Save to temp slot"));
 
   grouped_opr8rs.push_back(Opr8rPrecedenceLvl ());
   // TODO: Not listed as an OPR8R on cppreference web page.  Does it matter?
@@ -151,23 +160,51 @@ CompileExecTerms::CompileExecTerms() {
   // Special usage case DATA_TYPE for using the internal str() fxn, since it can take ANY valid data type
   valid_data_types.insert (std::pair {DATA_TYPE_ANY, std::pair {INTERNAL_USE_TKN, INVALID_OPCODE}});
 
-  reserved_words.push_back (FALSE_RESERVED_WORD);
-  reserved_words.push_back (TRUE_RESERVED_WORD);
-  reserved_words.push_back (IF_RESERVED_WORD);
-  reserved_words.push_back (ELSE_RESERVED_WORD);  
-  reserved_words.push_back (WHILE_RESERVED_WORD);
-  reserved_words.push_back (FOR_RESERVED_WORD);
-  reserved_words.push_back (BREAK_RESERVED_WORD);
-  reserved_words.push_back (RETURN_RESERVED_WORD);
-  reserved_words.push_back (VOID_RESERVED_WORD);
-
-  std::vector <uint8_t> param_list {INVALID_OPCODE};
-  system_calls.insert (std::pair {SYS_CALL_STR, std::pair {param_list, STRING_TKN}});
-  param_list[0] = DATA_TYPE_STRING_OPCODE;
-  system_calls.insert (std::pair {SYS_CALL_PRINT_LINE, std::pair {param_list, VOID_TKN}});
+  reserved_words.insert (FALSE_RESERVED_WORD);
+  reserved_words.insert (TRUE_RESERVED_WORD);
+  reserved_words.insert (IF_RESERVED_WORD);
+  reserved_words.insert (ELSE_RESERVED_WORD);  
+  reserved_words.insert (WHILE_RESERVED_WORD);
+  reserved_words.insert (FOR_RESERVED_WORD);
+  reserved_words.insert (BREAK_RESERVED_WORD);
+  reserved_words.insert (RETURN_RESERVED_WORD);
+  reserved_words.insert (VOID_RESERVED_WORD);
+
+  // A system call's ID is its position in this table, and IDs end up in interpreted files, so only ever add to the end
+  //                       name                 parameters                 returns     is_pure  exec_fxn
+  system_calls.push_back ({SYS_CALL_STR,        {INVALID_OPCODE},          STRING_TKN, true,    &RunTimeInterpreter::exec_sys_call_str});
+  system_calls.push_back ({SYS_CALL_PRINT_LINE, {DATA_TYPE_STRING_OPCODE}, VOID_TKN,   false,   &RunTimeInterpreter::exec_sys_call_print_line});
+  system_calls.push_back ({SYS_CALL_MIN,        {SYS_CALL_NUMERIC_PARAM, SYS_CALL_NUMERIC_PARAM}, INTERNAL_USE_TKN, true, &RunTimeInterpreter::exec_sys_call_min});
+  system_calls.push_back ({SYS_CALL_MAX,        {SYS_CALL_NUMERIC_PARAM, SYS_CALL_NUMERIC_PARAM}, INTERNAL_USE_TKN, true, &RunTimeInterpreter::exec_sys_call_max});
+  system_calls.push_back ({SYS_CALL_ABS,        {SYS_CALL_NUMERIC_PARAM},  INTERNAL_USE_TKN, true, &RunTimeInterpreter::exec_sys_call_abs});
+  system_calls.push_back ({SYS_CALL_POW,        {SYS_CALL_NUMERIC_PARAM, SYS_CALL_NUMERIC_PARAM}, INTERNAL_USE_TKN, true, &RunTimeInterpreter::exec_sys_call_pow});
+  system_calls.push_back ({SYS_CALL_SQRT,       {SYS_CALL_NUMERIC_PARAM},  DOUBLE_TKN, true,    &RunTimeInterpreter::exec_sys_call_sqrt});
+  system_calls.push_back ({SYS_CALL_FLOOR,      {SYS_CALL_NUMERIC_PARAM},  INTERNAL_USE_TKN, true, &RunTimeInterpreter::exec_sys_call_floor});
+  system_calls.push_back ({SYS_CALL_LENGTH,     {DATA_TYPE_STRING_OPCODE}, UINT64_TKN, true,    &RunTimeInterpreter::exec_sys_call_length});
+  system_calls.push_back ({SYS_CALL_FIND,       {DATA_TYPE_STRING_OPCODE, DATA_TYPE_STRING_OPCODE}, INT64_TKN, true, &RunTimeInterpreter::exec_sys_call_find});
+  system_calls.push_back ({SYS_CALL_SUBSTR,     {DATA_TYPE_STRING_OPCODE, DATA_TYPE_INT64_OPCODE, DATA_TYPE_INT64_OPCODE}, STRING_TKN, true, &RunTimeInterpreter::exec_sys_call_substr});
+  system_calls.push_back ({SYS_CALL_REPLACE,    {DATA_TYPE_STRING_OPCODE, DATA_TYPE_STRING_OPCODE, DATA_TYPE_STRING_OPCODE}, STRING_TKN, true, &RunTimeInterpreter::exec_sys_call_replace});
+  system_calls.push_back ({SYS_CALL_SPLIT_COUNT, {DATA_TYPE_STRING_OPCODE, DATA_TYPE_STRING_OPCODE}, UINT64_TKN, true, &RunTimeInterpreter::exec_sys_call_split_count});
+  system_calls.push_back ({SYS_CALL_SPLIT_FIELD, {DATA_TYPE_STRING_OPCODE, DATA_TYPE_STRING_OPCODE, DATA_TYPE_INT64_OPCODE}, STRING_TKN, true, &RunTimeInterpreter::exec_sys_call_split_field});
+  system_calls.push_back ({SYS_CALL_COMPARE_IGNORE_CASE, {DATA_TYPE_STRING_OPCODE, DATA_TYPE_STRING_OPCODE}, INT32_TKN, true, &RunTimeInterpreter::exec_sys_call_compare_ignore_case});
+  system_calls.push_back ({SYS_CALL_OPEN_FILE,  {DATA_TYPE_STRING_OPCODE, DATA_TYPE_STRING_OPCODE}, INT64_TKN, false, &RunTimeInterpreter::exec_sys_call_open_file});
+  system_calls.push_back ({SYS_CALL_READ_LINE,  {DATA_TYPE_INT64_OPCODE},  STRING_TKN, false,   &RunTimeInterpreter::exec_sys_call_read_line});
+  system_calls.push_back ({SYS_CALL_READ_CHUNK, {DATA_TYPE_INT64_OPCODE, DATA_TYPE_INT64_OPCODE}, STRING_TKN, false, &RunTimeInterpreter::exec_sys_call_read_chunk});
+  system_calls.push_back ({SYS_CALL_WRITE_FILE, {DATA_TYPE_INT64_OPCODE, DATA_TYPE_STRING_OPCODE}, INT64_TKN, false, &RunTimeInterpreter::exec_sys_call_write_file});
+  system_calls.push_back ({SYS_CALL_WRITE_LINE, {DATA_TYPE_INT64_OPCODE, DATA_TYPE_STRING_OPCODE}, INT64_TKN, false, &RunTimeInterpreter::exec_sys_call_write_line});
+  system_calls.push_back ({SYS_CALL_IS_EOF,     {DATA_TYPE_INT64_OPCODE},  BOOL_TKN,   false,   &RunTimeInterpreter::exec_sys_call_is_eof});
+  system_calls.push_back ({SYS_CALL_CLOSE_FILE, {DATA_TYPE_INT64_OPCODE},  INT32_TKN,  false,   &RunTimeInterpreter::exec_sys_call_close_file});
+  system_calls.push_back ({SYS_CALL_ARRAY_FILL, {SYS_CALL_ARRAY_PARAM, SYS_CALL_ELEMENT_PARAM}, VOID_TKN, false, &RunTimeInterpreter::exec_sys_call_array_fill});
+  system_calls.push_back ({SYS_CALL_ARRAY_COPY, {SYS_CALL_ARRAY_PARAM, SYS_CALL_MATCHING_ARRAY_PARAM}, UINT64_TKN, false, &RunTimeInterpreter::exec_sys_call_array_copy});
+  system_calls.push_back ({SYS_CALL_ARRAY_SUM,  {SYS_CALL_NUMERIC_ARRAY_PARAM}, INTERNAL_USE_TKN, false, &RunTimeInterpreter::exec_sys_call_array_sum});
+  system_calls.push_back ({SYS_CALL_ARRAY_MIN,  {SYS_CALL_NUMERIC_ARRAY_PARAM}, INTERNAL_USE_TKN, false, &RunTimeInterpreter::exec_sys_call_array_min});
+  system_calls.push_back ({SYS_CALL_ARRAY_MAX,  {SYS_CALL_NUMERIC_ARRAY_PARAM}, INTERNAL_USE_TKN, false, &RunTimeInterpreter::exec_sys_call_array_max});
+  system_calls.push_back ({SYS_CALL_ARRAY_DOT,  {SYS_CALL_NUMERIC_ARRAY_PARAM, SYS_CALL_MATCHING_ARRAY_PARAM}, INTERNAL_USE_TKN, false, &RunTimeInterpreter::exec_sys_call_array_dot});
+  system_calls.push_back ({SYS_CALL_ARRAY_SIZE, {SYS_CALL_ARRAY_PARAM}, UINT64_TKN, true, &RunTimeInterpreter::exec_sys_call_array_size});
 
   // TODO: What is the right way to do this?
   validityCheck();
+  buildLookupTables();
 }
 
 CompileExecTerms::~CompileExecTerms() {
@@ -19,9 +19,45 @@
 #define UNARY_MINUS_OPR8R   L"-U"
 #define BINARY_PLUS_OPR8R   L"B+"
 #define BINARY_MINUS_OPR8R  L"B-"
+#define TEMP_STORE_OPR8R    L"=tmp"
+#define LOOKUP_SELECT_OPR8R L"?sel"
+#define CONCAT_N_OPR8R      L"+cat"
+#define ARRAY_ELEMENT_OPR8R L"@elm"
 
 #define SYS_CALL_STR        L"str"
 #define SYS_CALL_PRINT_LINE L"print_line"
+#define SYS_CALL_MIN        L"min"
+#define SYS_CALL_MAX        L"max"
+#define SYS_CALL_ABS        L"abs"
+#define SYS_CALL_POW        L"pow"
+#define SYS_CALL_SQRT       L"sqrt"
+#define SYS_CALL_FLOOR      L"floor"
+#define SYS_CALL_LENGTH     L"length"
+#define SYS_CALL_FIND       L"find"
+#define SYS_CALL_SUBSTR     L"substr"
+#define SYS_CALL_REPLACE    L"replace"
+#define SYS_CALL_SPLIT_COUNT  L"split_count"
+#define SYS_CALL_SPLIT_FIELD  L"split_field"
+#define SYS_CALL_COMPARE_IGNORE_CASE  L"compare_ignore_case"
+#define SYS_CALL_OPEN_FILE  L"open_file"
+#define SYS_CALL_READ_LINE  L"read_line"
+#define SYS_CALL_READ_CHUNK L"read_chunk"
+#define SYS_CALL_WRITE_FILE L"write_file"
+#define SYS_CALL_WRITE_LINE L"write_line"
+#define SYS_CALL_IS_EOF     L"is_eof"
+#define SYS_CALL_CLOSE_FILE L"close_file"
+#define SYS_CALL_ARRAY_FILL L"array_fill"
+#define SYS_CALL_ARRAY_COPY L"array_copy"
+#define SYS_CALL_ARRAY_SUM  L"array_sum"
+#define SYS_CALL_ARRAY_MIN  L"array_min"
+#define SYS_CALL_ARRAY_MAX  L"array_max"
+#define SYS_CALL_ARRAY_DOT  L"array_dot"
+#define SYS_CALL_ARRAY_SIZE L"array_size"
+
+// Modes open_file() takes
+#define FILE_MODE_READ      L"r"
+#define FILE_MODE_WRITE     L"w"
+#define FILE_MODE_APPEND    L"a"
 
 class CompileExecTerms: public BaseLanguageTerms {
 public:
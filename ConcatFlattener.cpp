@@ -0,0 +1,175 @@
+/*
+ * ConcatFlattener.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ *
+ * Compile time pass over a type checked ExprTreeNode tree that joins a chain of
+ * [+] OPR8Rs working on STRINGs into a single [+cat] OPR8R.
+ *
+ * greeting + ", " + name + "!"
+ * [B+][B+][B+][greeting][", "][name]["!"]  ->  [+cat][4][greeting][", "][name]["!"]
+ *
+ * [+cat][# of pieces][piece]+
+ *
+ * Run as nested [+] OPR8Rs, every [+] but the last builds a string that only
+ * lives long enough to get copied into the next one.  The RunTimeInterpreter
+ * adds up the lengths of all the pieces, sizes the result once and appends each
+ * piece to it.  Pieces stay in the same left to right order, so they still get
+ * evaluated in the same order.
+ */
+
+#include "ConcatFlattener.h"
+#include <iostream>
+#include "InfoWarnError.h"
+#include "OpCodes.h"
+#include "TypeChecker.h"
+#include "common.h"
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+ConcatFlattener::ConcatFlattener(const CompileExecTerms & inExecTerms, std::shared_ptr<UserMessages> userMessages)
+  : execTerms (inExecTerms)  {
+
+  this->userMessages = userMessages;
+  thisSrcFile = util.getLastSegment(util.stringToWstring(__FILE__), L"/");
+  failed_on_src_line = 0;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+ConcatFlattener::~ConcatFlattener() {
+  if (failed_on_src_line > 0 && !userMessages->isExistsInternalError(thisSrcFile, failed_on_src_line))  {
+    // Dump out a debugging hint
+    std::wcout << L"FAILURE on " << thisSrcFile << L":" << failed_on_src_line << std::endl;
+  }
+}
+
+/* ****************************************************************************
+ * Join every chain of STRING [+] OPR8Rs under rootOfExpr in place.  Not finding
+ * any is not a failure.
+ * ***************************************************************************/
+int ConcatFlattener::flattenConcats (std::shared_ptr<ExprTreeNode> rootOfExpr, std::vector<flattenedConcat> & flattened) {
+  int ret_code = GENERAL_FAILURE;
+
+  flattened.clear();
+
+  if (OK != flattenNode_OLR (rootOfExpr, flattened))
+    SET_FAILED_ON_SRC_LINE;
+  else
+    ret_code = OK;
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * Outermost [+] of a chain gets looked at 1st; joining an inner one 1st would
+ * break up the chain.
+ * ***************************************************************************/
+int ConcatFlattener::flattenNode_OLR (std::shared_ptr<ExprTreeNode> currNode, std::vector<flattenedConcat> & flattened) {
+  int ret_code = GENERAL_FAILURE;
+
+  if (currNode == NULL || currNode->originalTkn == NULL)  {
+    ret_code = OK;
+
+  } else  {
+    std::vector<std::shared_ptr<ExprTreeNode>> pieces;
+
+    if (isStringPlus (currNode))  {
+      collectPieces_OLR (currNode, pieces);
+
+      if (pieces.size() >= MIN_CONCAT_PIECES)  {
+        flattened.push_back ({currNode->originalTkn->get_line_number(), (int)pieces.size()});
+        makeConcat (currNode, pieces);
+      }
+    }
+
+    ret_code = OK;
+    if (OK != flattenNode_OLR (currNode->_1stChild, flattened) || OK != flattenNode_OLR (currNode->_2ndChild, flattened))
+      ret_code = GENERAL_FAILURE;
+
+    for (int idx = 0; idx < currNode->parameter_list.size() && OK == ret_code; idx++)
+      ret_code = flattenNode_OLR (currNode->parameter_list[idx], flattened);
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * TypeChecker only comes up with a STRING result for [+] when both sides are
+ * STRINGs
+ * ***************************************************************************/
+bool ConcatFlattener::isStringPlus (std::shared_ptr<ExprTreeNode> currNode)  {
+  uint8_t op_code;
+
+  return (currNode != NULL && currNode->originalTkn != NULL && isOpr8rNode (currNode, op_code)
+    && op_code == BINARY_PLUS_OPR8R_OPCODE && currNode->resultTypes == STRING_DATA_TYPE
+    && currNode->_1stChild != NULL && currNode->_2ndChild != NULL);
+}
+
+/* ****************************************************************************
+ * Pieces in left to right order, whichever side of a [+] the rest of the chain
+ * hangs off of
+ * ***************************************************************************/
+void ConcatFlattener::collectPieces_OLR (std::shared_ptr<ExprTreeNode> currNode, std::vector<std::shared_ptr<ExprTreeNode>> & pieces)  {
+
+  if (isStringPlus (currNode))  {
+    collectPieces_OLR (currNode->_1stChild, pieces);
+    collectPieces_OLR (currNode->_2ndChild, pieces);
+
+  } else  {
+    pieces.push_back (currNode);
+  }
+}
+
+/* ****************************************************************************
+ * currNode -> [+cat][# of pieces][piece]+
+ * ***************************************************************************/
+void ConcatFlattener::makeConcat (std::shared_ptr<ExprTreeNode> currNode, std::vector<std::shared_ptr<ExprTreeNode>> & pieces)  {
+
+  std::shared_ptr<Token> concatTkn = std::make_shared<Token> (EXEC_OPR8R_TKN, CONCAT_N_OPR8R);
+  concatTkn->_unsigned = CONCAT_N_OPR8R_OPCODE;
+  concatTkn->src = currNode->originalTkn->src;
+  std::shared_ptr<Token> countTkn = std::make_shared<Token> (UINT32_TKN, std::to_wstring (pieces.size()));
+  countTkn->_unsigned = pieces.size();
+  countTkn->isInitialized = true;
+
+  std::vector<std::shared_ptr<ExprTreeNode>> concatParams;
+  concatParams.push_back (std::make_shared<ExprTreeNode> (countTkn));
+  concatParams.back()->resultTypes = UNSIGNED_DATA_TYPE;
+
+  for (auto piece : pieces)
+    concatParams.push_back (piece);
+
+  for (auto param : concatParams)
+    param->treeParent = currNode;
+
+  currNode->originalTkn = concatTkn;
+  currNode->_1stChild.reset();
+  currNode->_2ndChild.reset();
+  currNode->parameter_list = concatParams;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+bool ConcatFlattener::isOpr8rNode (std::shared_ptr<ExprTreeNode> currNode, uint8_t & op_code) {
+  bool isOpr8r = false;
+  op_code = INVALID_OPCODE;
+
+  if (currNode->originalTkn->tkn_type == SRC_OPR8R_TKN) {
+    if (currNode->originalTkn->_string == execTerms.get_statement_ender())
+      op_code = STATEMENT_ENDER_OPR8R_OPCODE;
+    else
+      op_code = execTerms.getOpCodeFor (currNode->originalTkn->_string);
+    isOpr8r = true;
+
+  } else if (currNode->originalTkn->tkn_type == EXEC_OPR8R_TKN) {
+    op_code = currNode->originalTkn->_unsigned;
+    isOpr8r = true;
+  }
+
+  return isOpr8r;
+}
@@ -0,0 +1,55 @@
+/*
+ * ConcatFlattener.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ */
+
+#ifndef CONCATFLATTENER_H_
+#define CONCATFLATTENER_H_
+
+#include <string>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include "CompileExecTerms.h"
+#include "ExprTreeNode.h"
+#include "Token.h"
+#include "Utilities.h"
+#include "UserMessages.h"
+
+// [a + b] is already a single [+]
+#define MIN_CONCAT_PIECES   3
+
+// Where a chain of STRING [+] OPR8Rs got joined into 1 OPR8R, for VERBOSE output
+struct flattened_concat_struct {
+  int line_num;
+  int num_pieces;
+};
+
+typedef flattened_concat_struct flattenedConcat;
+
+class ConcatFlattener {
+public:
+  ConcatFlattener(const CompileExecTerms & inExecTerms, std::shared_ptr<UserMessages> userMessages);
+  virtual ~ConcatFlattener();
+
+  int flattenConcats (std::shared_ptr<ExprTreeNode> rootOfExpr, std::vector<flattenedConcat> & flattened);
+
+private:
+  const CompileExecTerms & execTerms;
+  std::shared_ptr<UserMessages> userMessages;
+  std::wstring thisSrcFile;
+  Utilities util;
+  int failed_on_src_line;
+
+  int flattenNode_OLR (std::shared_ptr<ExprTreeNode> currNode, std::vector<flattenedConcat> & flattened);
+  bool isStringPlus (std::shared_ptr<ExprTreeNode> currNode);
+  void collectPieces_OLR (std::shared_ptr<ExprTreeNode> currNode, std::vector<std::shared_ptr<ExprTreeNode>> & pieces);
+  void makeConcat (std::shared_ptr<ExprTreeNode> currNode, std::vector<std::shared_ptr<ExprTreeNode>> & pieces);
+
+  bool isOpr8rNode (std::shared_ptr<ExprTreeNode> currNode, uint8_t & op_code);
+
+};
+
+#endif /* CONCATFLATTENER_H_ */
@@ -0,0 +1,349 @@
+/*
+ * ConstantFolder.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ *
+ * Compile time pass over a type checked ExprTreeNode tree that resolves any
+ * sub-tree made up entirely of literals down to a single literal, so it gets
+ * written to the interpreted file once instead of being recomputed every time
+ * it's executed.
+ *
+ * The arithmetic isn't re-implemented here.  Each constant OPR8R along with its
+ * literal operands gets handed to an expression only RunTimeInterpreter, so the
+ * folded result has the identical data type, overflow behavior and promotion
+ * rules (e.g. [/] going to a DOUBLE) it would have had at run time.  If the
+ * RunTimeInterpreter won't resolve it (divide by zero, etc.) the sub-tree is
+ * left alone and the user hears about it at run time, same as before.
+ */
+
+#include "ConstantFolder.h"
+#include <iostream>
+#include "InfoWarnError.h"
+#include "OpCodes.h"
+#include "TypeChecker.h"
+#include "common.h"
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+ConstantFolder::ConstantFolder(const CompileExecTerms & inExecTerms, std::shared_ptr<UserMessages> userMessages)
+  : execTerms (inExecTerms)
+  , scratchMessages (std::make_shared<UserMessages> ())
+  , scratchScope (std::make_shared<StackOfScopes> ())
+  , interpreter (inExecTerms, L"", scratchScope, scratchMessages) {
+
+  this->userMessages = userMessages;
+  thisSrcFile = util.getLastSegment(util.stringToWstring(__FILE__), L"/");
+  failed_on_src_line = 0;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+ConstantFolder::~ConstantFolder() {
+  if (failed_on_src_line > 0 && !userMessages->isExistsInternalError(thisSrcFile, failed_on_src_line))  {
+    // Dump out a debugging hint
+    std::wcout << L"FAILURE on " << thisSrcFile << L":" << failed_on_src_line << std::endl;
+  }
+}
+
+/* ****************************************************************************
+ * Fold every constant sub-tree under rootOfExpr in place.  Not being able to
+ * fold something is not a failure; a malformed tree is.
+ * ***************************************************************************/
+int ConstantFolder::foldExprTree (std::shared_ptr<ExprTreeNode> rootOfExpr) {
+  bool isConstant;
+
+  return foldNode_OLR (rootOfExpr, isConstant);
+}
+
+/* ****************************************************************************
+ * Post-order walk; operands get folded before the OPR8R that uses them.
+ * isConstant tells the caller whether currNode is now a literal.
+ * ***************************************************************************/
+int ConstantFolder::foldNode_OLR (std::shared_ptr<ExprTreeNode> currNode, bool & isConstant)  {
+  int ret_code = GENERAL_FAILURE;
+  uint8_t op_code;
+  bool is1stConstant = false;
+  bool is2ndConstant = true;
+
+  isConstant = false;
+
+  if (currNode == NULL || currNode->originalTkn == NULL)  {
+    userMessages->logMsg (INTERNAL_ERROR, L"Unexpected NULL expression tree node", thisSrcFile, __LINE__, 0);
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (currNode->originalTkn->tkn_type == SYSTEM_CALL_TKN)  {
+    std::vector<Token> flatExpr {*currNode->originalTkn};
+    bool isAllConstant = true;
+    int idx;
+
+    for (idx = 0; idx < currNode->parameter_list.size() && !failed_on_src_line; idx++)  {
+      bool isParamConstant;
+      if (OK != foldNode_OLR (currNode->parameter_list[idx], isParamConstant))
+        SET_FAILED_ON_SRC_LINE;
+      else if (!isParamConstant)
+        isAllConstant = false;
+      else
+        flatExpr.push_back (*currNode->parameter_list[idx]->originalTkn);
+    }
+
+    if (!failed_on_src_line)  {
+      if (isAllConstant && execTerms.is_pure_system_call (currNode->originalTkn->_string))
+        isConstant = resolveNode (currNode, flatExpr);
+      ret_code = OK;
+    }
+
+  } else if (!isOpr8rNode (currNode, op_code)) {
+    // Leaf node; either a literal or a variable
+    isConstant = isLiteral (*currNode->originalTkn);
+    ret_code = OK;
+
+  } else  {
+    switch (op_code)  {
+      case STATEMENT_ENDER_OPR8R_OPCODE :
+        // Syntactic sugar, but whatever hangs off of it could still fold
+        if (currNode->_1stChild != NULL && OK != foldNode_OLR (currNode->_1stChild, is1stConstant))
+          SET_FAILED_ON_SRC_LINE;
+        else if (currNode->_1stChild != NULL && currNode->_2ndChild != NULL && OK != foldNode_OLR (currNode->_2ndChild, is2ndConstant))
+          SET_FAILED_ON_SRC_LINE;
+        else
+          ret_code = OK;
+        break;
+      case POST_INCR_OPR8R_OPCODE :
+      case POST_DECR_OPR8R_OPCODE :
+      case PRE_INCR_OPR8R_OPCODE :
+      case PRE_DECR_OPR8R_OPCODE :
+        // Operand has to be a variable, so nothing to fold
+        ret_code = OK;
+        break;
+      case ASSIGNMENT_OPR8R_OPCODE :
+      case PLUS_ASSIGN_OPR8R_OPCODE :
+      case MINUS_ASSIGN_OPR8R_OPCODE :
+      case MULTIPLY_ASSIGN_OPR8R_OPCODE :
+      case DIV_ASSIGN_OPR8R_OPCODE :
+      case MOD_ASSIGN_OPR8R_OPCODE :
+      case LEFT_SHIFT_ASSIGN_OPR8R_OPCODE :
+      case RIGHT_SHIFT_ASSIGN_OPR8R_OPCODE :
+      case BITWISE_AND_ASSIGN_OPR8R_OPCODE :
+      case BITWISE_XOR_ASSIGN_OPR8R_OPCODE :
+      case BITWISE_OR_ASSIGN_OPR8R_OPCODE :
+        // Left operand is the variable getting written to; only the right side can fold
+        if (OK != foldNode_OLR (currNode->_2ndChild, is2ndConstant))
+          SET_FAILED_ON_SRC_LINE;
+        else
+          ret_code = OK;
+        break;
+      case LOGICAL_AND_OPR8R_OPCODE :
+      case LOGICAL_OR_OPR8R_OPCODE :
+        ret_code = foldShortCircuit (currNode, op_code, isConstant);
+        break;
+      case TERNARY_1ST_OPR8R_OPCODE :
+        ret_code = foldTernary (currNode, isConstant);
+        break;
+      case INVALID_OPCODE :
+      case TERNARY_2ND_OPR8R_OPCODE :
+      case BREAK_OPR8R_OPCODE :
+        userMessages->logMsg (INTERNAL_ERROR, L"Unexpected OPR8R " + currNode->originalTkn->descr_sans_line_num_col()
+          , thisSrcFile, __LINE__, 0);
+        SET_FAILED_ON_SRC_LINE;
+        break;
+      default:
+        // UNARY or BINARY OPR8R; resolvable once all of its operands are literals
+        if (OK != foldNode_OLR (currNode->_1stChild, is1stConstant))
+          SET_FAILED_ON_SRC_LINE;
+
+        else if (currNode->_2ndChild != NULL && OK != foldNode_OLR (currNode->_2ndChild, is2ndConstant))
+          SET_FAILED_ON_SRC_LINE;
+
+        else  {
+          if (is1stConstant && is2ndConstant) {
+            Token opr8rTkn;
+            opr8rTkn.tkn_type = EXEC_OPR8R_TKN;
+            opr8rTkn._unsigned = op_code;
+
+            std::vector<Token> flatExpr {opr8rTkn, *currNode->_1stChild->originalTkn};
+            if (currNode->_2ndChild != NULL)
+              flatExpr.push_back (*currNode->_2ndChild->originalTkn);
+
+            isConstant = resolveNode (currNode, flatExpr);
+          }
+          ret_code = OK;
+        }
+        break;
+    }
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * [?] with a literal conditional gets replaced by whichever path would have
+ * been taken at run time.  Either path can still have constant sub-trees.
+ * ***************************************************************************/
+int ConstantFolder::foldTernary (std::shared_ptr<ExprTreeNode> opr8rNode, bool & isConstant) {
+  int ret_code = GENERAL_FAILURE;
+  std::shared_ptr<ExprTreeNode> colonNode = opr8rNode->_2ndChild;
+  bool isCondConstant, isTruePathConstant, isFalsePathConstant;
+  uint8_t colon_op_code;
+
+  isConstant = false;
+
+  if (colonNode == NULL || !isOpr8rNode (colonNode, colon_op_code) || colon_op_code != TERNARY_2ND_OPR8R_OPCODE) {
+    userMessages->logMsg (INTERNAL_ERROR, L"Expected [:] after " + opr8rNode->originalTkn->descr_sans_line_num_col()
+      , thisSrcFile, __LINE__, 0);
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (OK != foldNode_OLR (opr8rNode->_1stChild, isCondConstant)) {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (OK != foldNode_OLR (colonNode->_1stChild, isTruePathConstant)) {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (OK != foldNode_OLR (colonNode->_2ndChild, isFalsePathConstant)) {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    if (isCondConstant && opr8rNode->_1stChild->originalTkn->tkn_type != DATETIME_TKN) {
+      // Same test RunTimeInterpreter::execTernary1stOp uses
+      if (opr8rNode->_1stChild->originalTkn->evalResolvedTokenAsIf())  {
+        isConstant = isTruePathConstant;
+        replaceWithSubTree (opr8rNode, colonNode->_1stChild);
+      } else  {
+        isConstant = isFalsePathConstant;
+        replaceWithSubTree (opr8rNode, colonNode->_2ndChild);
+      }
+    }
+    ret_code = OK;
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * [&&] [||] resolve to an UINT64 1 or 0 at run time.  A literal left operand
+ * that short-circuits decides the result no matter what the right side is;
+ * otherwise both sides have to be literals.
+ * ***************************************************************************/
+int ConstantFolder::foldShortCircuit (std::shared_ptr<ExprTreeNode> opr8rNode, uint8_t op_code, bool & isConstant) {
+  int ret_code = GENERAL_FAILURE;
+  bool is1stConstant, is2ndConstant;
+
+  isConstant = false;
+
+  if (OK != foldNode_OLR (opr8rNode->_1stChild, is1stConstant)) {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (OK != foldNode_OLR (opr8rNode->_2ndChild, is2ndConstant)) {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    Token & _1stTkn = *opr8rNode->_1stChild->originalTkn;
+
+    if (is1stConstant && _1stTkn.tkn_type != DATETIME_TKN)  {
+      bool isLeftTrue = _1stTkn.evalResolvedTokenAsIf();
+
+      if ((op_code == LOGICAL_AND_OPR8R_OPCODE && !isLeftTrue) || (op_code == LOGICAL_OR_OPR8R_OPCODE && isLeftTrue)) {
+        // Same as RunTimeInterpreter's zero_tkn|one_tkn
+        Token resultTkn (UINT64_TKN, isLeftTrue ? L"1" : L"0");
+        resultTkn._unsigned = isLeftTrue ? 1 : 0;
+        resultTkn.isInitialized = true;
+        replaceWithLiteral (opr8rNode, resultTkn);
+        isConstant = true;
+
+      } else if (is2ndConstant) {
+        Token opr8rTkn;
+        opr8rTkn.tkn_type = EXEC_OPR8R_TKN;
+        opr8rTkn._unsigned = op_code;
+
+        std::vector<Token> flatExpr {opr8rTkn, _1stTkn, *opr8rNode->_2ndChild->originalTkn};
+        isConstant = resolveNode (opr8rNode, flatExpr);
+      }
+    }
+    ret_code = OK;
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * Have the RunTimeInterpreter resolve the flattened [OPR8R|system call][literal(s)]
+ * and put the result in currNode's place.  Returns true if currNode got folded.
+ * ***************************************************************************/
+bool ConstantFolder::resolveNode (std::shared_ptr<ExprTreeNode> currNode, std::vector<Token> & flatExpr) {
+  bool isFolded = false;
+
+  if (OK != interpreter.resolveConstExpr (flatExpr))  {
+    // Leave it for run time, which will report the problem to the user
+    scratchMessages->reset();
+
+  } else if (flatExpr[0].tkn_type != DOUBLE_TKN)  {
+    // TODO: A DOUBLE's value doesn't survive the trip through the interpreted file yet
+    replaceWithLiteral (currNode, flatExpr[0]);
+    isFolded = true;
+  }
+
+  return isFolded;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+void ConstantFolder::replaceWithLiteral (std::shared_ptr<ExprTreeNode> currNode, Token & literalTkn) {
+  std::shared_ptr<Token> foldedTkn = std::make_shared<Token> (literalTkn);
+  foldedTkn->isInitialized = true;
+
+  currNode->originalTkn = foldedTkn;
+  currNode->_1stChild.reset();
+  currNode->_2ndChild.reset();
+  currNode->parameter_list.clear();
+  currNode->resultTypes = TypeChecker::getDataTypeMask (foldedTkn->tkn_type);
+}
+
+/* ****************************************************************************
+ * Pull subTree up into currNode's spot, so whatever points at currNode now
+ * gets subTree instead
+ * ***************************************************************************/
+void ConstantFolder::replaceWithSubTree (std::shared_ptr<ExprTreeNode> currNode, std::shared_ptr<ExprTreeNode> subTree) {
+  currNode->originalTkn = subTree->originalTkn;
+  currNode->_1stChild = subTree->_1stChild;
+  currNode->_2ndChild = subTree->_2ndChild;
+  currNode->parameter_list = subTree->parameter_list;
+  currNode->resultTypes = subTree->resultTypes;
+
+  if (currNode->_1stChild != NULL)
+    currNode->_1stChild->treeParent = currNode;
+  if (currNode->_2ndChild != NULL)
+    currNode->_2ndChild->treeParent = currNode;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+bool ConstantFolder::isOpr8rNode (std::shared_ptr<ExprTreeNode> currNode, uint8_t & op_code) {
+  bool isOpr8r = false;
+  op_code = INVALID_OPCODE;
+
+  if (currNode->originalTkn->tkn_type == SRC_OPR8R_TKN) {
+    if (currNode->originalTkn->_string == execTerms.get_statement_ender())
+      op_code = STATEMENT_ENDER_OPR8R_OPCODE;
+    else
+      op_code = execTerms.getOpCodeFor (currNode->originalTkn->_string);
+    isOpr8r = true;
+
+  } else if (currNode->originalTkn->tkn_type == EXEC_OPR8R_TKN) {
+    op_code = currNode->originalTkn->_unsigned;
+    isOpr8r = true;
+  }
+
+  return isOpr8r;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+bool ConstantFolder::isLiteral (Token & tkn) {
+  return (tkn.isUnsigned() || tkn.isSigned() || tkn.tkn_type == STRING_TKN || tkn.tkn_type == BOOL_TKN
+    || tkn.tkn_type == DOUBLE_TKN || tkn.tkn_type == DATETIME_TKN);
+}
@@ -0,0 +1,53 @@
+/*
+ * ConstantFolder.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ */
+
+#ifndef CONSTANTFOLDER_H_
+#define CONSTANTFOLDER_H_
+
+#include <string>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include "CompileExecTerms.h"
+#include "ExprTreeNode.h"
+#include "Token.h"
+#include "Utilities.h"
+#include "StackOfScopes.h"
+#include "UserMessages.h"
+#include "RunTimeInterpreter.h"
+
+class ConstantFolder {
+public:
+  ConstantFolder(const CompileExecTerms & inExecTerms, std::shared_ptr<UserMessages> userMessages);
+  virtual ~ConstantFolder();
+
+  int foldExprTree (std::shared_ptr<ExprTreeNode> rootOfExpr);
+  bool isLiteral (Token & tkn);
+
+private:
+  const CompileExecTerms & execTerms;
+  std::shared_ptr<UserMessages> userMessages;
+  // Fold attempts that fail get left for run time, so keep their messages away from the user's
+  std::shared_ptr<UserMessages> scratchMessages;
+  std::shared_ptr<StackOfScopes> scratchScope;
+  RunTimeInterpreter interpreter;
+  std::wstring thisSrcFile;
+  Utilities util;
+  int failed_on_src_line;
+
+  int foldNode_OLR (std::shared_ptr<ExprTreeNode> currNode, bool & isConstant);
+  int foldTernary (std::shared_ptr<ExprTreeNode> opr8rNode, bool & isConstant);
+  int foldShortCircuit (std::shared_ptr<ExprTreeNode> opr8rNode, uint8_t op_code, bool & isConstant);
+  bool resolveNode (std::shared_ptr<ExprTreeNode> currNode, std::vector<Token> & flatExpr);
+  void replaceWithLiteral (std::shared_ptr<ExprTreeNode> currNode, Token & literalTkn);
+  void replaceWithSubTree (std::shared_ptr<ExprTreeNode> currNode, std::shared_ptr<ExprTreeNode> subTree);
+
+  bool isOpr8rNode (std::shared_ptr<ExprTreeNode> currNode, uint8_t & op_code);
+
+};
+
+#endif /* CONSTANTFOLDER_H_ */
@@ -0,0 +1,262 @@
+/*
+ * ConstantPropagator.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ *
+ * Compile time pass that carries the values of variables from one statement to
+ * the next, so they can be constant folded in later expressions.
+ *
+ * uint8 a = 3;
+ * uint8 b = a * 2;     ->  uint8 b = 0x6;
+ *
+ * Every variable assigned a literal, in its declaration or in a stand-alone
+ * [x = literal;] statement, gets its value noted at the top scope.  Variables
+ * in later expressions are swapped for that literal before constant folding.
+ * The source is compiled in a single pass, so what's known flows from top to
+ * bottom:
+ * - Anything else that writes to a variable forgets its value, at every scope
+ *   up to the one that declared it
+ * - Values noted inside of a block are forgotten when it closes, since the
+ *   block might not have run
+ * - Variables written anywhere in a loop are forgotten before the loop's
+ *   conditional, since that runs again after the body
+ *
+ * The RunTimeInterpreter's copy of an integer variable can end up with a wider
+ * data type than it was declared with, and [~] cares about the width.  So a
+ * store is only noted if the Token the variable would hold afterwards is known
+ * exactly: from its declaration on, or from a store to a variable whose Token
+ * was already known.  STRING, BOOL and DOUBLE variables always keep their type.
+ */
+
+#include "ConstantPropagator.h"
+#include <iostream>
+#include "InfoWarnError.h"
+#include "OpCodes.h"
+#include "common.h"
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+ConstantPropagator::ConstantPropagator(const CompileExecTerms & inExecTerms, std::shared_ptr<UserMessages> userMessages
+  , std::shared_ptr<StackOfScopes> inVarScopeStack)
+  : execTerms (inExecTerms)  {
+
+  this->userMessages = userMessages;
+  scopedNameSpace = inVarScopeStack;
+  thisSrcFile = util.getLastSegment(util.stringToWstring(__FILE__), L"/");
+  failed_on_src_line = 0;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+ConstantPropagator::~ConstantPropagator() {
+  if (failed_on_src_line > 0 && !userMessages->isExistsInternalError(thisSrcFile, failed_on_src_line))  {
+    // Dump out a debugging hint
+    std::wcout << L"FAILURE on " << thisSrcFile << L":" << failed_on_src_line << std::endl;
+  }
+}
+
+/* ****************************************************************************
+ * Swap every variable under rootOfExpr whose value is known for a copy of that
+ * value.  Variables the expression writes to are left alone, except for the
+ * target of a top level [=]: its value side gets resolved before the store.
+ * ***************************************************************************/
+int ConstantPropagator::propagateConstants (std::shared_ptr<ExprTreeNode> rootOfExpr, std::vector<propagatedVar> & propagated) {
+  int ret_code = GENERAL_FAILURE;
+  std::set<std::wstring> writtenVars;
+  std::shared_ptr<ExprTreeNode> readNode = rootOfExpr;
+  uint8_t op_code;
+
+  propagated.clear();
+
+  if (readNode != NULL && readNode->originalTkn != NULL && isOpr8rNode (readNode, op_code)
+    && op_code == STATEMENT_ENDER_OPR8R_OPCODE && readNode->_1stChild != NULL && readNode->_2ndChild == NULL)
+    readNode = readNode->_1stChild;
+
+  if (readNode != NULL && readNode->originalTkn != NULL && isOpr8rNode (readNode, op_code) && op_code == ASSIGNMENT_OPR8R_OPCODE
+    && readNode->_1stChild != NULL && readNode->_1stChild->originalTkn->tkn_type == USER_WORD_TKN && readNode->_2ndChild != NULL)
+    readNode = readNode->_2ndChild;
+  else
+    readNode = rootOfExpr;
+
+  if (OK != collectWrittenVars_OLR (readNode, writtenVars))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    substituteVars_OLR (readNode, writtenVars, propagated);
+    ret_code = OK;
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * Expression has been written out; forget the value of everything it wrote to
+ * ***************************************************************************/
+int ConstantPropagator::killWrittenVars (std::shared_ptr<ExprTreeNode> rootOfExpr) {
+  int ret_code = GENERAL_FAILURE;
+  std::set<std::wstring> writtenVars;
+
+  if (OK != collectWrittenVars_OLR (rootOfExpr, writtenVars))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    killVars (writtenVars);
+    ret_code = OK;
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+void ConstantPropagator::killVars (std::set<std::wstring> & varNames) {
+  for (auto & varName : varNames)
+    scopedNameSpace->killKnownValue (varName);
+}
+
+/* ****************************************************************************
+ * varName was just assigned valueNode, either in its declaration or in a
+ * stand-alone statement. Note its value if the Token the interpreter will be
+ * holding for it afterwards is known exactly; otherwise forget it.
+ * ***************************************************************************/
+void ConstantPropagator::noteStore (std::wstring varName, std::shared_ptr<ExprTreeNode> valueNode, bool isDeclaration) {
+  bool isKnown = false;
+  std::wstring errMsg;
+  Token varTkn;
+  Token knownTkn;
+
+  if (isKnowableLiteral (valueNode) && OK == scopedNameSpace->findVar (varName, 0, varTkn, READ_ONLY, errMsg))  {
+    Token & valueTkn = *valueNode->originalTkn;
+
+    if (isDeclaration || varTkn.tkn_type == STRING_TKN || varTkn.tkn_type == BOOL_TKN || varTkn.tkn_type == DOUBLE_TKN)  {
+      // Freshly declared, or a data type that never changes
+      knownTkn = Token (varTkn.tkn_type, L"");
+      isKnown = true;
+
+    } else  {
+      isKnown = (OK == scopedNameSpace->getKnownValue (varName, knownTkn));
+    }
+
+    // DOUBLEs get written out from their string; a converted one wouldn't have it
+    if (isKnown && knownTkn.tkn_type == DOUBLE_TKN && valueTkn.tkn_type != DOUBLE_TKN)
+      isKnown = false;
+
+    if (isKnown)
+      isKnown = (OK == knownTkn.convertTo (valueTkn, varName, errMsg));
+  }
+
+  if (isKnown)  {
+    knownTkn.isInitialized = true;
+    scopedNameSpace->setKnownValue (varName, knownTkn);
+
+  } else  {
+    scopedNameSpace->killKnownValue (varName);
+  }
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+int ConstantPropagator::collectWrittenVars_OLR (std::shared_ptr<ExprTreeNode> currNode, std::set<std::wstring> & writtenVars) {
+  int ret_code = GENERAL_FAILURE;
+  uint8_t op_code;
+
+  if (currNode == NULL || currNode->originalTkn == NULL)  {
+    userMessages->logMsg (INTERNAL_ERROR, L"Unexpected NULL expression tree node", thisSrcFile, __LINE__, 0);
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    if (isOpr8rNode (currNode, op_code) && isWritingOpr8r (op_code) && currNode->_1stChild != NULL
+      && currNode->_1stChild->originalTkn->tkn_type == USER_WORD_TKN)
+      writtenVars.insert (currNode->_1stChild->originalTkn->_string);
+
+    ret_code = OK;
+    if (currNode->_1stChild != NULL && OK != collectWrittenVars_OLR (currNode->_1stChild, writtenVars))
+      ret_code = GENERAL_FAILURE;
+    else if (currNode->_2ndChild != NULL && OK != collectWrittenVars_OLR (currNode->_2ndChild, writtenVars))
+      ret_code = GENERAL_FAILURE;
+
+    for (int idx = 0; idx < currNode->parameter_list.size() && OK == ret_code; idx++)
+      ret_code = collectWrittenVars_OLR (currNode->parameter_list[idx], writtenVars);
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+void ConstantPropagator::substituteVars_OLR (std::shared_ptr<ExprTreeNode> currNode, std::set<std::wstring> & writtenVars
+  , std::vector<propagatedVar> & propagated) {
+  Token knownTkn;
+
+  if (currNode != NULL && currNode->originalTkn != NULL)  {
+    Token & currTkn = *currNode->originalTkn;
+
+    if (currTkn.tkn_type == USER_WORD_TKN && currNode->_1stChild == NULL && currNode->_2ndChild == NULL
+      && writtenVars.count (currTkn._string) == 0 && OK == scopedNameSpace->getKnownValue (currTkn._string, knownTkn))  {
+      // Keep the variable's spot in the source for any messages about the folded result
+      knownTkn.src = currTkn.src;
+      propagated.push_back ({currTkn._string, knownTkn.getValueStr(), currTkn.get_line_number()});
+      currNode->originalTkn = std::make_shared<Token> (knownTkn);
+
+    } else  {
+      substituteVars_OLR (currNode->_1stChild, writtenVars, propagated);
+      substituteVars_OLR (currNode->_2ndChild, writtenVars, propagated);
+
+      for (auto param : currNode->parameter_list)
+        substituteVars_OLR (param, writtenVars, propagated);
+    }
+  }
+}
+
+/* ****************************************************************************
+ * What's left of the value after constant folding is a literal that can be
+ * written back out as is
+ * ***************************************************************************/
+bool ConstantPropagator::isKnowableLiteral (std::shared_ptr<ExprTreeNode> valueNode)  {
+  bool isKnowable = false;
+
+  if (valueNode != NULL && valueNode->originalTkn != NULL && valueNode->_1stChild == NULL && valueNode->_2ndChild == NULL
+    && valueNode->parameter_list.empty())  {
+    Token & valueTkn = *valueNode->originalTkn;
+    isKnowable = (valueTkn.isUnsigned() || valueTkn.isSigned() || valueTkn.tkn_type == STRING_TKN
+      || valueTkn.tkn_type == BOOL_TKN || valueTkn.tkn_type == DOUBLE_TKN);
+  }
+
+  return isKnowable;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+bool ConstantPropagator::isOpr8rNode (std::shared_ptr<ExprTreeNode> currNode, uint8_t & op_code) {
+  bool isOpr8r = false;
+  op_code = INVALID_OPCODE;
+
+  if (currNode->originalTkn->tkn_type == SRC_OPR8R_TKN) {
+    if (currNode->originalTkn->_string == execTerms.get_statement_ender())
+      op_code = STATEMENT_ENDER_OPR8R_OPCODE;
+    else
+      op_code = execTerms.getOpCodeFor (currNode->originalTkn->_string);
+    isOpr8r = true;
+
+  } else if (currNode->originalTkn->tkn_type == EXEC_OPR8R_TKN) {
+    op_code = currNode->originalTkn->_unsigned;
+    isOpr8r = true;
+  }
+
+  return isOpr8r;
+}
+
+/* ****************************************************************************
+ * Assignments and [pre|post]-fix OPR8Rs change the variable they operate on
+ * ***************************************************************************/
+bool ConstantPropagator::isWritingOpr8r (uint8_t op_code) {
+  return ((op_code >= POST_INCR_OPR8R_OPCODE && op_code <= PRE_DECR_OPR8R_OPCODE)
+    || (op_code >= ASSIGNMENT_OPR8R_OPCODE && op_code <= BITWISE_OR_ASSIGN_OPR8R_OPCODE));
+}
@@ -0,0 +1,61 @@
+/*
+ * ConstantPropagator.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ */
+
+#ifndef CONSTANTPROPAGATOR_H_
+#define CONSTANTPROPAGATOR_H_
+
+#include <string>
+#include <memory>
+#include <vector>
+#include <set>
+#include <cstdint>
+#include "CompileExecTerms.h"
+#include "ExprTreeNode.h"
+#include "Token.h"
+#include "Utilities.h"
+#include "StackOfScopes.h"
+#include "UserMessages.h"
+
+// Where a variable got swapped for its known value, for VERBOSE output
+struct propagated_var_struct {
+  std::wstring var_name;
+  std::wstring value_str;
+  int line_num;
+};
+
+typedef propagated_var_struct propagatedVar;
+
+class ConstantPropagator {
+public:
+  ConstantPropagator(const CompileExecTerms & inExecTerms, std::shared_ptr<UserMessages> userMessages
+    , std::shared_ptr<StackOfScopes> inVarScopeStack);
+  virtual ~ConstantPropagator();
+
+  int propagateConstants (std::shared_ptr<ExprTreeNode> rootOfExpr, std::vector<propagatedVar> & propagated);
+  int killWrittenVars (std::shared_ptr<ExprTreeNode> rootOfExpr);
+  void killVars (std::set<std::wstring> & varNames);
+  void noteStore (std::wstring varName, std::shared_ptr<ExprTreeNode> valueNode, bool isDeclaration);
+
+private:
+  const CompileExecTerms & execTerms;
+  std::shared_ptr<UserMessages> userMessages;
+  std::shared_ptr<StackOfScopes> scopedNameSpace;
+  std::wstring thisSrcFile;
+  Utilities util;
+  int failed_on_src_line;
+
+  int collectWrittenVars_OLR (std::shared_ptr<ExprTreeNode> currNode, std::set<std::wstring> & writtenVars);
+  void substituteVars_OLR (std::shared_ptr<ExprTreeNode> currNode, std::set<std::wstring> & writtenVars
+    , std::vector<propagatedVar> & propagated);
+  bool isKnowableLiteral (std::shared_ptr<ExprTreeNode> valueNode);
+
+  bool isOpr8rNode (std::shared_ptr<ExprTreeNode> currNode, uint8_t & op_code);
+  bool isWritingOpr8r (uint8_t op_code);
+
+};
+
+#endif /* CONSTANTPROPAGATOR_H_ */
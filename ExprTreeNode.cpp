@@ -17,6 +17,7 @@ ExprTreeNode::ExprTreeNode(std::shared_ptr<Token> startOpr8rTkn) {
   _1stChild = NULL;
   _2ndChild = NULL;
   treeParent = NULL;
+  resultTypes = 0;
 
   initDisplaySettings();
 
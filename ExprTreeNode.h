@@ -11,6 +11,7 @@
 #include "Token.h"
 #include <memory>
 #include <iostream>
+#include <cstdint>
 
 enum branch_tuple_type_enum {
   UNKNOWN_NODE_TYPE
@@ -41,6 +42,9 @@ public:
   int displayCol;
   branchNodeDisplayType nodePos;
 
+  // Mask of the data type categories this node could resolve to; filled in by TypeChecker (see TypeChecker.h)
+  uint8_t resultTypes;
+
   // TODO: Make this private?
   // For system_call or user defined fxn call, parameter_list will encapsulate the call's parameters at compile time
   std::vector <std::shared_ptr<ExprTreeNode>> parameter_list;
@@ -92,17 +92,16 @@
 #include "OpCodes.h"
 #include "Operator.h"
 #include "Opr8rPrecedenceLvl.h"
-#include "RunTimeInterpreter.h"
 #include "Token.h"
 #include "UserMessages.h"
 #include "StackOfScopes.h"
 #include "common.h"
 
-ExpressionParser::ExpressionParser(CompileExecTerms & inUsrSrcTerms, std::shared_ptr<StackOfScopes> inVarScopeStack
-    , std::wstring userSrcFileName, std::shared_ptr<UserMessages> userMessages, logLvlEnum logLvl) {
+ExpressionParser::ExpressionParser(const CompileExecTerms & inUsrSrcTerms, std::shared_ptr<StackOfScopes> inVarScopeStack
+    , std::wstring userSrcFileName, std::shared_ptr<UserMessages> userMessages, logLvlEnum logLvl, exprParserEnum exprParserType)
+  : usrSrcTerms (inUsrSrcTerms) {
 
   thisSrcFile = util.getLastSegment(util.stringToWstring(__FILE__), L"/");
-  usrSrcTerms = inUsrSrcTerms;
   scopedNameSpace = inVarScopeStack;
   this->userSrcFileName = userSrcFileName;
   this->userMessages = userMessages;
@@ -110,6 +109,23 @@ ExpressionParser::ExpressionParser(CompileExecTerms & inUsrSrcTerms, std::shared
   isExprVarDeclaration = false;
   failed_on_src_line = 0;
   num_var_leaf_nodes = 0;
+  this->exprParserType = exprParserType;
+
+  // Flatten grouped_opr8rs into op_code indexed tables so the Pratt parser gets an OPR8R's precedence with a
+  // single lookup. Precedence levels are spaced 2 apart, leaving room for [:] to drop below [=] inside a [?] scope
+  opr8rBindingPwr.assign (ATOMIC_OPCODE_RANGE_END + 1, 0);
+  opr8rTypeMask.assign (ATOMIC_OPCODE_RANGE_END + 1, 0);
+  int bindingPwr = 2 * usrSrcTerms.grouped_opr8rs.size();
+
+  for (auto lvlR8r = usrSrcTerms.grouped_opr8rs.begin(); lvlR8r != usrSrcTerms.grouped_opr8rs.end(); lvlR8r++)  {
+    for (auto opr8rR8r = lvlR8r->opr8rs.begin(); opr8rR8r != lvlR8r->opr8rs.end(); opr8rR8r++)  {
+      if ((opr8rR8r->valid_usage & GNR8D_SRC) && opr8rR8r->op_code <= ATOMIC_OPCODE_RANGE_END) {
+        opr8rBindingPwr[opr8rR8r->op_code] = bindingPwr;
+        opr8rTypeMask[opr8rR8r->op_code] = opr8rR8r->type_mask;
+      }
+    }
+    bindingPwr -= 2;
+  }
 }
 
 
@@ -247,6 +263,17 @@ int ExpressionParser::makeExprTree (TokenPtrVector & tknStream, std::shared_ptr<
                 , userSrcFileName, currTkn->get_line_number(), currTkn->get_column_pos());
             isStopFail = true;
 
+          } else if (currTkn->tkn_type == USER_WORD_TKN && tknStream.size() > 1 
+              && tknStream[1]->tkn_type == SPR8R_TKN && tknStream[1]->_string == L"[")  {
+            // Array element; name and [index expression] get encapsulated into a single [@elm] node
+            tknStream.erase(tknStream.begin());
+            std::shared_ptr<ExprTreeNode> element_node;
+
+            if (OK != compile_array_element(tknStream, currTkn, element_node))
+              isStopFail = true;
+            else
+              exprScopeStack[exprScopeStack.size() - 1]->scopedKids.push_back(element_node);
+
           } else if ((currTkn->tkn_type == SRC_OPR8R_TKN && (TERNARY_2ND & usrSrcTerms.get_type_mask(currTkn->_string)))
               && !isTernaryOpen(exprScopeStack))  {
             // Unexpected TERNARY_2ND
@@ -673,7 +700,7 @@ int ExpressionParser::moveNeighborsIntoTree (ExprTreeNodePtrVector & currScope
             // > 0 variable leaf nodes means that this expression isn't fixed|static
             num_var_leaf_nodes++;
 
-          if ((opr8r.type_mask & PREFIX) && (rightNbr->originalTkn->tkn_type != USER_WORD_TKN 
+          if ((opr8r.type_mask & PREFIX) && !isArrayElement (rightNbr) && (rightNbr->originalTkn->tkn_type != USER_WORD_TKN 
               || !usrSrcTerms.is_viable_var_name(rightNbr->originalTkn->_string)
               || OK != scopedNameSpace->findVar(rightNbr->originalTkn->_string, 0, tmpTkn, READ_ONLY, lookUpMsg)))  {
             // Make sure our right neighbor is a variable name before moving
@@ -715,7 +742,7 @@ int ExpressionParser::moveNeighborsIntoTree (ExprTreeNodePtrVector & currScope
             // > 0 variable leaf nodes means that this expression isn't fixed|static
             num_var_leaf_nodes++;
 
-          if ((opr8r.type_mask & POSTFIX) && (leftNbr->originalTkn->tkn_type != USER_WORD_TKN 
+          if ((opr8r.type_mask & POSTFIX) && !isArrayElement (leftNbr) && (leftNbr->originalTkn->tkn_type != USER_WORD_TKN 
               || !usrSrcTerms.is_viable_var_name(leftNbr->originalTkn->_string)
               || OK != scopedNameSpace->findVar(leftNbr->originalTkn->_string, 0, tmpTkn, READ_ONLY, lookUpMsg))) {
             // Make sure our left neighbor is a variable name before moving
@@ -841,7 +868,7 @@ int ExpressionParser::moveNeighborsIntoTree (ExprTreeNodePtrVector & currScope
 
 /* ****************************************************************************
  * ***************************************************************************/
- int ExpressionParser::exec_prec_lvl_opr8rs (ExprTreeNodePtrVector & currScope,  Opr8rPrecedenceLvl & precedenceLvl
+ int ExpressionParser::exec_prec_lvl_opr8rs (ExprTreeNodePtrVector & currScope,  const Opr8rPrecedenceLvl & precedenceLvl
   , bool & is_skip_tern2nd, std::vector<std::shared_ptr<NestedScopeExpr>> & exprScopeStack) {
 
 
@@ -886,7 +913,7 @@ int ExpressionParser::moveNeighborsIntoTree (ExprTreeNodePtrVector & currScope
         if (currTkn->tkn_type == SRC_OPR8R_TKN) {
           // Check if this operator is contained in our current precedence level, and needs to get executed
           bool isPrecLvlSrchDone = false;
-          std::list<Operator>::iterator precItr8r = precedenceLvl.opr8rs.begin(); 
+          std::vector<Operator>::const_iterator precItr8r = precedenceLvl.opr8rs.begin(); 
 
           Operator node_opr8r;
           usrSrcTerms.getExecOpr8rDetails(usrSrcTerms.getOpCodeFor(currTkn->_string), node_opr8r);
@@ -1003,9 +1030,7 @@ int ExpressionParser::turnClosedScopeIntoTree (ExprTreeNodePtrVector & currScope
 
   ExprTreeNodePtrVector::iterator currNodeR8r;
   std::shared_ptr<ExprTreeNode> currNode = NULL;
-  std::list<Opr8rPrecedenceLvl>::iterator outr8r;
-  std::list<Operator>::iterator innr8r;
-  Opr8rPrecedenceLvl precedenceLvl;
+  std::vector<Opr8rPrecedenceLvl>::const_iterator outr8r;
   Operator tern2ndOpr8r;
 
   // [?]._1stChild is the conditional and should be the resolved expression directly to the left
@@ -1017,13 +1042,20 @@ int ExpressionParser::turnClosedScopeIntoTree (ExprTreeNodePtrVector & currScope
   }
 
   bool is_tern2nd_pending = false, is_tern2nd_skipped = false;
+
+  if (exprParserType == PRATT_PARSER)  {
+    // Single pass over currScope; the precedence level loop below gets skipped either way
+    if (OK != prattScopeIntoTree (currScope, exprScopeStack))
+      isStopFail = true;
+    else
+      ret_code = OK;
+  }
+
   // TODO: Code inspect, comment, simplify if you can
   for (outr8r = usrSrcTerms.grouped_opr8rs.begin(); outr8r != usrSrcTerms.grouped_opr8rs.end() && !isStopFail && ret_code != OK; outr8r++){
     // Move through each precedence level of OPR8Rs. Note that some precedence levels will have multiple OPR8Rs and they must be
     // treated as having the same precedence, and therefore we can't rely on an ABSOUTE ordering of OPR8R precedence
-    precedenceLvl = *outr8r;
-
-    if (OK != exec_prec_lvl_opr8rs (currScope, precedenceLvl, is_tern2nd_skipped, exprScopeStack))  {
+    if (OK != exec_prec_lvl_opr8rs (currScope, *outr8r, is_tern2nd_skipped, exprScopeStack))  {
       isStopFail = true;
 
     } else if (currScope.size() == 1) {
@@ -1049,6 +1081,209 @@ int ExpressionParser::turnClosedScopeIntoTree (ExprTreeNodePtrVector & currScope
   return (ret_code);
 }
 
+/* ****************************************************************************
+ * Alternative to iterating over every precedence level in grouped_opr8rs. 
+ * Turns the flat list of a closed scope into a tree in a single left-to-right
+ * pass using precedence climbing (a Pratt parser).  The tree is the same shape
+ * the precedence level iteration produces:
+ * OPR8Rs at the same precedence level group left-to-right, a resolved [?]
+ * grabs the operand to its left like a POSTFIX OPR8R, and inside a scope
+ * opened by [?] the [:] OPR8R binds looser than anything else.
+ * ***************************************************************************/
+int ExpressionParser::prattScopeIntoTree (ExprTreeNodePtrVector & currScope, std::vector<std::shared_ptr<NestedScopeExpr>> & exprScopeStack)  {
+  int ret_code = GENERAL_FAILURE;
+  bool isOpenedByTernary = false;
+  int nodeIdx = 0;
+  std::shared_ptr<ExprTreeNode> subExprRoot = NULL;
+
+  int topIdx = exprScopeStack.size() - 1;
+  if (topIdx >= 0 && exprScopeStack[topIdx]->myParentScopener != NULL)  {
+    auto myParent = exprScopeStack[topIdx]->myParentScopener;
+    if (myParent->originalTkn->tkn_type == SRC_OPR8R_TKN && myParent->originalTkn->_string == usrSrcTerms.get_ternary_1st())
+      isOpenedByTernary = true;
+  }
+
+  if (currScope.empty())  {
+    SET_FAILED_ON_SRC_LINE;
+  
+  } else if (OK != prattParseSubExpr (currScope, nodeIdx, 0, isOpenedByTernary, subExprRoot))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (nodeIdx != currScope.size() || subExprRoot == NULL) {
+    // Something was left over that couldn't be attached to the tree
+    SET_FAILED_ON_SRC_LINE;
+
+  } else {
+    currScope.clear();
+    currScope.push_back (subExprRoot);
+    ret_code = OK;
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * Consume an operand, along with any PREFIX|UNARY OPR8R in front of it, then
+ * keep folding in following OPR8Rs as long as they bind tighter than 
+ * minBindingPwr.  An OPR8R that binds equally tight is left for the caller, 
+ * which gives left-to-right grouping within a precedence level.
+ * ***************************************************************************/
+int ExpressionParser::prattParseSubExpr (ExprTreeNodePtrVector & currScope, int & nodeIdx, int minBindingPwr
+  , bool isOpenedByTernary, std::shared_ptr<ExprTreeNode> & subExprRoot)  {
+  int ret_code = GENERAL_FAILURE;
+  bool isDone = false;
+  std::shared_ptr<ExprTreeNode> leftNode = NULL;
+  std::shared_ptr<ExprTreeNode> rightNode = NULL;
+  uint8_t op_code;
+  
+  subExprRoot = NULL;
+
+  if (nodeIdx < 0 || nodeIdx >= currScope.size())  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (!isPendingOpr8r (currScope[nodeIdx])) {
+    // Literal, variable, system call or a sub-expression already resolved into a tree
+    leftNode = currScope[nodeIdx++];
+
+  } else {
+    std::shared_ptr<ExprTreeNode> opr8rNode = currScope[nodeIdx++];
+    op_code = usrSrcTerms.getOpCodeFor(opr8rNode->originalTkn->_string);
+
+    if (0 == (opr8rTypeMask[op_code] & (UNARY|PREFIX)))  {
+      SET_FAILED_ON_SRC_LINE;
+    
+    } else if (OK != prattParseSubExpr (currScope, nodeIdx, opr8rBindingPwr[op_code], isOpenedByTernary, rightNode))  {
+      SET_FAILED_ON_SRC_LINE;
+
+    } else if (OK != prattAttachChild (opr8rNode, rightNode, true, opr8rTypeMask[op_code]))  {
+      SET_FAILED_ON_SRC_LINE;
+
+    } else  {
+      leftNode = opr8rNode;
+    }
+  }
+
+  while (!failed_on_src_line && !isDone) {
+    if (nodeIdx >= currScope.size()) {
+      isDone = true;
+
+    } else if (!isPendingOpr8r (currScope[nodeIdx])) {
+      // 2 operands next to each other
+      SET_FAILED_ON_SRC_LINE;
+
+    } else  {
+      std::shared_ptr<ExprTreeNode> opr8rNode = currScope[nodeIdx];
+      op_code = usrSrcTerms.getOpCodeFor(opr8rNode->originalTkn->_string);
+      uint8_t typeMsk = opr8rTypeMask[op_code];
+      int bindingPwr = opr8rBindingPwr[op_code];
+
+      if (op_code == TERNARY_2ND_OPR8R_OPCODE && isOpenedByTernary)
+        // Any contained assignment OPR8Rs need to be pushed deeper into the tree than [:]
+        bindingPwr = 1;
+
+      if (bindingPwr <= minBindingPwr)  {
+        // Belongs to a caller further up
+        isDone = true;
+
+      } else if (typeMsk & TERNARY_1ST)  {
+        // TRUE|FALSE paths were resolved when the [?] scope closed; conditional to the left is our _1stChild
+        nodeIdx++;
+        if (opr8rNode->_2ndChild == NULL || OK != prattAttachChild (opr8rNode, leftNode, true, typeMsk))
+          SET_FAILED_ON_SRC_LINE;
+        else
+          leftNode = opr8rNode;
+
+      } else if (typeMsk & POSTFIX)  {
+        nodeIdx++;
+        if (OK != prattAttachChild (opr8rNode, leftNode, true, typeMsk))
+          SET_FAILED_ON_SRC_LINE;
+        else
+          leftNode = opr8rNode;
+
+      } else if (typeMsk & BINARY)  {
+        nodeIdx++;
+        if (OK != prattParseSubExpr (currScope, nodeIdx, bindingPwr, isOpenedByTernary, rightNode))
+          SET_FAILED_ON_SRC_LINE;
+        else if (OK != prattAttachChild (opr8rNode, leftNode, true, typeMsk))
+          SET_FAILED_ON_SRC_LINE;
+        else if (OK != prattAttachChild (opr8rNode, rightNode, false, typeMsk))
+          SET_FAILED_ON_SRC_LINE;
+        else
+          leftNode = opr8rNode;
+
+      } else  {
+        // PREFIX|UNARY OPR8R where an operand was expected
+        SET_FAILED_ON_SRC_LINE;
+      }
+    }
+  }
+
+  if (!failed_on_src_line)  {
+    subExprRoot = leftNode;
+    ret_code = OK;
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * An OPR8R node that hasn't had its operands attached yet.  A [?] that has 
+ * its [:] attached is still pending until it gets its conditional.
+ * ***************************************************************************/
+bool ExpressionParser::isPendingOpr8r (std::shared_ptr<ExprTreeNode> treeNode) {
+  return (treeNode->originalTkn->tkn_type == SRC_OPR8R_TKN && treeNode->_1stChild == NULL);
+}
+
+/* ****************************************************************************
+ * An array element can be written to, so it's as good as a variable for a
+ * [PRE|POST]FIX OPR8R
+ * ***************************************************************************/
+bool ExpressionParser::isArrayElement (std::shared_ptr<ExprTreeNode> treeNode) {
+  return (treeNode->originalTkn->tkn_type == SRC_OPR8R_TKN && treeNode->originalTkn->_string == ARRAY_ELEMENT_OPR8R);
+}
+
+/* ****************************************************************************
+ * Pratt parser equivalent of moveNeighborsIntoTree.  Applies the same checks
+ * on [PRE|POST]FIX OPR8R operands and keeps num_var_leaf_nodes in step.
+ * ***************************************************************************/
+int ExpressionParser::prattAttachChild (std::shared_ptr<ExprTreeNode> opr8rNode, std::shared_ptr<ExprTreeNode> childNode
+  , bool isAttach1st, uint8_t opr8rTypeMsk) {
+  int ret_code = GENERAL_FAILURE;
+  Token tmpTkn;
+  std::wstring lookUpMsg;
+
+  if (opr8rNode == NULL || childNode == NULL) {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else {
+    if (usrSrcTerms.is_viable_var_name(childNode->originalTkn->_string))
+      // > 0 variable leaf nodes means that this expression isn't fixed|static
+      num_var_leaf_nodes++;
+
+    if ((opr8rTypeMsk & (PREFIX|POSTFIX)) && !isArrayElement (childNode) && (childNode->originalTkn->tkn_type != USER_WORD_TKN 
+        || !usrSrcTerms.is_viable_var_name(childNode->originalTkn->_string)
+        || OK != scopedNameSpace->findVar(childNode->originalTkn->_string, 0, tmpTkn, READ_ONLY, lookUpMsg)))  {
+      // [PRE|POST]FIX OPR8R must operate on a variable
+      SET_FAILED_ON_SRC_LINE;
+    
+    } else if (isAttach1st && opr8rNode->_1stChild == NULL)  {
+      opr8rNode->_1stChild = childNode;
+      childNode->treeParent = opr8rNode;
+      ret_code = OK;
+
+    } else if (!isAttach1st && opr8rNode->_2ndChild == NULL)  {
+      opr8rNode->_2ndChild = childNode;
+      childNode->treeParent = opr8rNode;
+      ret_code = OK;
+    
+    } else {
+      SET_FAILED_ON_SRC_LINE;
+    }
+  }
+
+  return ret_code;
+}
+
 /* ****************************************************************************
  * When an unexpected Token type is encountered in an expression, this proc will
  * create a user friendly string that indicates what type of Token(s) would have
@@ -2372,10 +2607,14 @@ int ExpressionParser::setHalfTreeDisplayPos (bool isLeftTree, int halfTreeLevel,
 
     TokenTypeEnum call_ret_type;
     std::vector <uint8_t> parameters;
+    uint8_t sys_call_id;
 
     if (OK != usrSrcTerms.get_system_call_details (sys_call_node->originalTkn->_string, parameters, call_ret_type))  {
       SET_FAILED_ON_SRC_LINE;
     
+    } else if (OK != usrSrcTerms.get_system_call_id (sys_call_node->originalTkn->_string, sys_call_id))  {
+      SET_FAILED_ON_SRC_LINE;
+
     } else if (OK != check_for_expected_token(tknStream, *sys_call_node->originalTkn, L"(", false))  {
       SET_FAILED_ON_SRC_LINE;
 
@@ -2387,10 +2626,11 @@ int ExpressionParser::setHalfTreeDisplayPos (bool isLeftTree, int halfTreeLevel,
       // Still need to do better with VOID data type
       // sys_call_node->originalTkn->tkn_type = call_ret_type;
       sys_call_node->originalTkn->tkn_type = SYSTEM_CALL_TKN;
+      // What actually gets written out and looked up at run time
+      sys_call_node->originalTkn->_unsigned = sys_call_id;
 
       Token expr_ended_by;
       bool is_expr_closed, is_expr_static;
-      int expected_ret_tkn_cnt;
 
       if (0 == parameters.size()) {
         if (OK != check_for_expected_token(tknStream, *sys_call_node->originalTkn, L"(", true))
@@ -2401,12 +2641,9 @@ int ExpressionParser::setHalfTreeDisplayPos (bool isLeftTree, int halfTreeLevel,
           ret_code = OK;
 
       } else {
-        /* TODO
-        RunTimeInterpreter interpreter (usrSrcTerms, scopedNameSpace, userSrcFileName, userMessages, logLevel);
-        std::vector<Token> flatExprTkns;
-        */
         int idx = 0;
-        std::wstring type_conversion_msg;
+        // A lone parameter gets parsed as a parenthesized expression, "(" and all
+        std::shared_ptr<Token> open_paren_tkn = tknStream.front();
 
         if (parameters.size() > 1 && OK != check_for_expected_token(tknStream, *sys_call_node->originalTkn, L"(", true))
           SET_FAILED_ON_SRC_LINE;
@@ -2414,6 +2651,10 @@ int ExpressionParser::setHalfTreeDisplayPos (bool isLeftTree, int halfTreeLevel,
         for (; idx < parameters.size() && !failed_on_src_line; idx++) {
           std::shared_ptr<Token> empty_tkn = std::make_shared<Token>();
           std::shared_ptr<ExprTreeNode> param_expr_tree = std::make_shared<ExprTreeNode> (empty_tkn);
+
+          if (idx > 0 && idx + 1 == parameters.size())
+            // Last of several parameters gets the "(" back, so it parses like a lone one through the closing ")"
+            tknStream.insert (tknStream.begin(), open_paren_tkn);
     
           if (OK != makeExprTree (tknStream, param_expr_tree, expr_ended_by
             , idx + 1 < parameters.size() ? ENDS_IN_COMMA : ENDS_IN_PARENTHESES
@@ -2421,44 +2662,9 @@ int ExpressionParser::setHalfTreeDisplayPos (bool isLeftTree, int halfTreeLevel,
             SET_FAILED_ON_SRC_LINE;
 
           else
-            // Data type checking will be done after the COMPLETE expression has been compiled
+            // TypeChecker checks parameter data types after the COMPLETE expression has been compiled
             sys_call_node->parameter_list.push_back(param_expr_tree);
 
-/*  TODO:
-          } else if (OK != usrSrcTerms.flattenExprTree(param_expr_tree, flatExprTkns))  {
-            // (3 + 4) -> [3][4][+]
-            SET_FAILED_ON_SRC_LINE;
-
-          } else {
-            
-          }
-          
-          } else if (OK != interpreter.resolveFlatExpr(flatExprTkns, expected_ret_tkn_cnt)
-              || expected_ret_tkn_cnt != 1) {
-            // TODO: Using this interpreter means using an EMPTY namespace that doesn't have the variables stuffed into 
-            // the original namespace that came with GeneralParser's interpreter.  Might need to share the GP interpreter
-            // back with ExpressionParser
-            // TODO: Pass it in through the constructor
-            SET_FAILED_ON_SRC_LINE;
-      
-          } else if (flatExprTkns.size() != 1)  {
-            // flattenedExpr should have 1 Token left - the result of the expression
-            userMessages->logMsg(INTERNAL_ERROR, L"Failed to resolve expression starting with " + sys_call_node->originalTkn->descr_sans_line_num_col()
-                  , thisSrcFile, __LINE__, 0);
-            SET_FAILED_ON_SRC_LINE;
-            
-          } else if (parameters[idx] != INVALID_OPCODE && OK != usrSrcTerms.tkn_type_converts_to_opcode(parameters[idx], flatExprTkns[0], L"parameter " + std::to_wstring(idx), type_conversion_msg)) {
-            // INVALID_OPCODE is a special case 
-            userMessages->logMsg(USER_ERROR, type_conversion_msg + L" for system call " + sys_call_node->originalTkn->_string
-                  , userSrcFileName, sys_call_node->originalTkn->get_line_number(), sys_call_node->originalTkn->get_column_pos());
-            SET_FAILED_ON_SRC_LINE;
-
-          } else {
-            sys_call_node->parameter_list.push_back(param_expr_tree);
-          }
-
-          flatExprTkns.clear();
-*/
         }          
         if (idx == parameters.size() && failed_on_src_line == 0)  {
           ret_code = OK;
@@ -2470,4 +2676,79 @@ int ExpressionParser::setHalfTreeDisplayPos (bool isLeftTree, int halfTreeLevel,
   return ret_code;
 }
 
+/* ****************************************************************************
+ * Encountered an array name followed by a [[].  The index expression gets
+ * parsed like a parenthesized one, and the resulting [@elm] node has the array
+ * name as its _1stChild and the index expression as its _2ndChild. Since the
+ * node already has its operands, the rest of the expression treats it like a
+ * variable.
+ * ***************************************************************************/
+int ExpressionParser::compile_array_element (TokenPtrVector & tknStream, std::shared_ptr<Token> arrayNameTkn
+  , std::shared_ptr<ExprTreeNode> & elementNode) {
+  int ret_code = GENERAL_FAILURE;
+  scopeVar * var_handle = NULL;
+  int depth = 0;
+  int close_idx = 0;
+
+  elementNode = NULL;
+
+  for (int idx = 0; idx < tknStream.size() && close_idx == 0; idx++)  {
+    // Index expressions can hold array elements of their own
+    if (tknStream[idx]->tkn_type == SPR8R_TKN && tknStream[idx]->_string == L"[")
+      depth++;
+    else if (tknStream[idx]->tkn_type == SPR8R_TKN && tknStream[idx]->_string == L"]" && --depth == 0)
+      close_idx = idx;
+  }
+
+  if (OK != scopedNameSpace->getVarHandle(arrayNameTkn->_string, 0, var_handle) || var_handle->num_elements == 0)  {
+    userMessages->logMsg (USER_ERROR, L"Variable " + arrayNameTkn->_string + L" is not an array and can't be indexed"
+      , userSrcFileName, arrayNameTkn->get_line_number(), arrayNameTkn->get_column_pos());
+    SET_FAILED_ON_SRC_LINE;
 
+  } else if (close_idx < 2)  {
+    userMessages->logMsg (USER_ERROR, L"Index into array " + arrayNameTkn->_string + L" is empty or missing its closing []]"
+      , userSrcFileName, arrayNameTkn->get_line_number(), arrayNameTkn->get_column_pos());
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    // Index expression gets parsed like a lone system call parameter, "(" through ")"
+    std::shared_ptr<Token> open_tkn = std::make_shared<Token> (*tknStream[0]);
+    std::shared_ptr<Token> close_tkn = std::make_shared<Token> (*tknStream[close_idx]);
+    open_tkn->_string = L"(";
+    close_tkn->_string = L")";
+    tknStream[0] = open_tkn;
+    tknStream[close_idx] = close_tkn;
+
+    std::shared_ptr<Token> empty_tkn = std::make_shared<Token>();
+    std::shared_ptr<ExprTreeNode> index_tree = std::make_shared<ExprTreeNode> (empty_tkn);
+    Token index_ended_by;
+    bool is_index_closed, is_index_static;
+    // Nested call starts these over
+    int saved_var_leaf_nodes = num_var_leaf_nodes;
+    bool saved_is_var_dec = isExprVarDeclaration;
+
+    int index_ret = makeExprTree (tknStream, index_tree, index_ended_by, ENDS_IN_PARENTHESES, is_index_closed, false, is_index_static, true);
+
+    // Array name counts as a variable leaf node
+    num_var_leaf_nodes = saved_var_leaf_nodes + 1;
+    isExprVarDeclaration = saved_is_var_dec;
+
+    if (OK != index_ret)  {
+      SET_FAILED_ON_SRC_LINE;
+
+    } else  {
+      std::shared_ptr<Token> element_tkn = std::make_shared<Token> (*arrayNameTkn);
+      element_tkn->tkn_type = SRC_OPR8R_TKN;
+      element_tkn->_string = ARRAY_ELEMENT_OPR8R;
+
+      elementNode = std::make_shared<ExprTreeNode> (element_tkn);
+      elementNode->_1stChild = std::make_shared<ExprTreeNode> (arrayNameTkn);
+      elementNode->_1stChild->treeParent = elementNode;
+      elementNode->_2ndChild = index_tree;
+      index_tree->treeParent = elementNode;
+      ret_code = OK;
+    }
+  }
+
+  return ret_code;
+}
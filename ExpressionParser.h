@@ -24,7 +24,6 @@
 #include "InterpretedFileWriter.h"
 #include "StackOfScopes.h"
 #include "UserMessages.h"
-#include "RunTimeInterpreter.h"
 
 // Values below used in a bit mask variable that indicates
 // allowable next states.
@@ -67,8 +66,8 @@ typedef expr_ender_enum expr_ender_type;
 
 class ExpressionParser {
 public:
-  ExpressionParser(CompileExecTerms & inUsrSrcTerms, std::shared_ptr<StackOfScopes> inVarScopeStack, std::wstring userSrcFileName
-    , std::shared_ptr<UserMessages> userMessages, logLvlEnum logLvl);
+  ExpressionParser(const CompileExecTerms & inUsrSrcTerms, std::shared_ptr<StackOfScopes> inVarScopeStack, std::wstring userSrcFileName
+    , std::shared_ptr<UserMessages> userMessages, logLvlEnum logLvl, exprParserEnum exprParserType);
   virtual ~ExpressionParser();
   int makeExprTree (TokenPtrVector & tknStream, std::shared_ptr<ExprTreeNode> & expressionTree, Token & enderTkn
       , expr_ender_type ended_by, bool & isCallerExprClosed, bool isInVarDec, bool & is_expr_static);
@@ -77,11 +76,12 @@ public:
   int displayParseTree (std::shared_ptr<ExprTreeNode> startBranch, std::wstring callersSrcFile, int srcLineNum);
   int check_for_expected_token (TokenPtrVector & tknStream, Token & curr_tkn, std::wstring pattern_str, bool is_consume_tkn);
   int compile_system_call (TokenPtrVector & tknStream, std::shared_ptr<ExprTreeNode> sys_call_node);
+  int compile_array_element (TokenPtrVector & tknStream, std::shared_ptr<Token> arrayNameTkn, std::shared_ptr<ExprTreeNode> & elementNode);
 
 private:
   std::wstring userSrcFileName;
   std::wstring thisSrcFile;
-  CompileExecTerms usrSrcTerms;
+  const CompileExecTerms & usrSrcTerms;
   Utilities util;
   std::shared_ptr<StackOfScopes> scopedNameSpace;
   Token scratchTkn;
@@ -90,6 +90,10 @@ private:
   bool isExprVarDeclaration;
   int failed_on_src_line;
   int num_var_leaf_nodes;
+  exprParserEnum exprParserType;
+  // Indexed by exec OPR8R op_code; higher binding power binds tighter. Used by the Pratt parser
+  std::vector<int> opr8rBindingPwr;
+  std::vector<uint8_t> opr8rTypeMask;
 
   std::vector<int> leftTreeMaxCol;
   std::vector<int> rightTreeMaxCol;
@@ -109,10 +113,17 @@ private:
     , bool isMoveRightNbr, std::vector<std::shared_ptr<NestedScopeExpr>> & exprScopeStack);
   int exec_delayed_ternary_2nd (ExprTreeNodePtrVector & currScope, std::vector<std::shared_ptr<NestedScopeExpr>> & exprScopeStack);
   bool is_delay_tern2nd (ExprTreeNodePtrVector & currScope);
-  int exec_prec_lvl_opr8rs (ExprTreeNodePtrVector & currScope,  Opr8rPrecedenceLvl & precedenceLvl, bool & is_skip_tern2nd, std::vector<std::shared_ptr<NestedScopeExpr>> & exprScopeStack);
+  int exec_prec_lvl_opr8rs (ExprTreeNodePtrVector & currScope,  const Opr8rPrecedenceLvl & precedenceLvl, bool & is_skip_tern2nd, std::vector<std::shared_ptr<NestedScopeExpr>> & exprScopeStack);
     
   int turnClosedScopeIntoTree (ExprTreeNodePtrVector & currScope, bool isExprClosed, std::vector<std::shared_ptr<NestedScopeExpr>> & exprScopeStack);
   int turnClosedScopeIntoTree (ExprTreeNodePtrVector & currScope, bool isOpenedByTernary, bool isExprClosed, std::vector<std::shared_ptr<NestedScopeExpr>> & exprScopeStack);
+  int prattScopeIntoTree (ExprTreeNodePtrVector & currScope, std::vector<std::shared_ptr<NestedScopeExpr>> & exprScopeStack);
+  int prattParseSubExpr (ExprTreeNodePtrVector & currScope, int & nodeIdx, int minBindingPwr, bool isOpenedByTernary
+    , std::shared_ptr<ExprTreeNode> & subExprRoot);
+  bool isPendingOpr8r (std::shared_ptr<ExprTreeNode> treeNode);
+  bool isArrayElement (std::shared_ptr<ExprTreeNode> treeNode);
+  int prattAttachChild (std::shared_ptr<ExprTreeNode> opr8rNode, std::shared_ptr<ExprTreeNode> childNode, bool isAttach1st
+    , uint8_t opr8rTypeMsk);
   int getExpectedEndToken (std::shared_ptr<Token> startTkn, uint32_t & _1stTknTypMsk, Token & expectedEndTkn, expr_ender_type ended_by);
   
   // Debug helper procs
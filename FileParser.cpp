@@ -24,7 +24,8 @@ using namespace std;
 /* ****************************************************************************
  * file_parser constructor
  * ***************************************************************************/
-FileParser::FileParser (BaseLanguageTerms & inCompilerTerms, std::wstring fileName) {
+FileParser::FileParser (const BaseLanguageTerms & inCompilerTerms, std::wstring fileName)
+  : compilerTerms (inCompilerTerms) {
   curr_file_pos = 0;
   line_num = 1;
   curr_line_start_pos = 0;
@@ -32,7 +33,6 @@ FileParser::FileParser (BaseLanguageTerms & inCompilerTerms, std::wstring fileNa
   curr_tkn_starts_on_col_pos = 1;
   num_chars_chomped_this_line = 0;
   num_lines_parsed = 0;
-  compilerTerms = inCompilerTerms;
   this->fileName = fileName;
 }
 
@@ -435,7 +435,7 @@ void FileParser::cnvrt_tkn_if_datetime (std::shared_ptr<Token> pssbl_datetime_tk
  * ***************************************************************************/
 void FileParser::resolve_final_tkn_type (std::shared_ptr<Token>  tkn_of_ambiguity)  {
 
-  std::wstring::iterator str_r8r;
+  std::wstring::const_iterator str_r8r;
   int idx;
   int64_t cnvrtd_signed;
   uint64_t cnvrtd_unsigned;
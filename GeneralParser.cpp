@@ -16,6 +16,7 @@
 #include "Token.h"
 #include "StackOfScopes.h"
 #include "common.h"
+#include <algorithm>
 #include <cstdint>
 #include <iostream>
 #include <memory>
@@ -23,22 +24,34 @@
 
 using namespace std;
 
-GeneralParser::GeneralParser(TokenPtrVector & inTknStream, std::wstring userSrcFileName, CompileExecTerms & inUsrSrcTerms
+GeneralParser::GeneralParser(TokenPtrVector & inTknStream, std::wstring userSrcFileName, const CompileExecTerms & inUsrSrcTerms
     , std::shared_ptr<UserMessages> userMessages, std::string object_file_name, std::shared_ptr<StackOfScopes> inVarScopeStack
-    , logLvlEnum logLvl)
-  : interpretedFileWriter (object_file_name, inUsrSrcTerms, userMessages)
-  , interpreter (inUsrSrcTerms, inVarScopeStack, userSrcFileName, userMessages, logLvl)
-  , exprParser (inUsrSrcTerms, inVarScopeStack, userSrcFileName, userMessages, logLvl)
+    , logLvlEnum logLvl, exprParserEnum exprParserType, optimizeLvlEnum optimizeLvl, int maxUnrollTrips, int unrollFactor
+    , std::shared_ptr<BlockProfile> blockProfile)
+  : usrSrcTerms (inUsrSrcTerms)
+  , interpretedFileWriter (object_file_name, inUsrSrcTerms, userMessages)
+  , typeChecker (inUsrSrcTerms, inVarScopeStack, userSrcFileName, userMessages)
+  , constantPropagator (inUsrSrcTerms, userMessages, inVarScopeStack)
+  , constantFolder (inUsrSrcTerms, userMessages)
+  , algebraicSimplifier (inUsrSrcTerms, userMessages)
+  , loopInvariantHoister (inUsrSrcTerms, userMessages, inVarScopeStack)
+  , commonSubExprEliminator (inUsrSrcTerms, userMessages)
+  , ternaryLookupBuilder (inUsrSrcTerms, userMessages)
+  , concatFlattener (inUsrSrcTerms, userMessages)
+  , exprParser (inUsrSrcTerms, inVarScopeStack, userSrcFileName, userMessages, logLvl, exprParserType)
 
 {
   tkn_stream = inTknStream;
   this->userSrcFileName = userSrcFileName;
-  usrSrcTerms = inUsrSrcTerms;
   this->userMessages = userMessages;
   scopedNameSpace = inVarScopeStack;
   thisSrcFile = util.getLastSegment(util.stringToWstring(__FILE__), L"/");
   userErrorLimit = 30;
   logLevel = logLvl;
+  optimizeLevel = optimizeLvl;
+  this->maxUnrollTrips = maxUnrollTrips;
+  this->unrollFactor = unrollFactor;
+  this->blockProfile = blockProfile;
 
   ender_and_comma_list.push_back (usrSrcTerms.get_statement_ender());
   ender_and_comma_list.push_back (L",");
@@ -190,8 +203,13 @@ int GeneralParser::compileCurrScope ()  {
 
         std::pair<TokenTypeEnum, uint8_t> enum_opCode = usrSrcTerms.getDataType_tknEnum_opCode (currTkn->_string);
         std::shared_ptr<Token> emptyTkn = std::make_shared<Token>();
+        // Anything other than [else] ends the [if] chain at this scope
+        bool isIfChainEnded = (currTkn->tkn_type != RESERVED_WORD_TKN || currTkn->_string != L"else");
 
-        if (currTkn->tkn_type == END_OF_STREAM_TKN) {
+        if (isIfChainEnded && OK != reorderIfChain())  {
+          SET_FAILED_ON_SRC_LINE;
+
+        } else if (currTkn->tkn_type == END_OF_STREAM_TKN) {
           isEOF = true;
 
         } else if (currTkn->tkn_type == SPR8R_TKN && currTkn->_string == L"}")  {
@@ -201,6 +219,9 @@ int GeneralParser::compileCurrScope ()  {
           if (OK != validate_closed_for_loop())  {
             SET_FAILED_ON_SRC_LINE;
           
+          } else if (optimizeLevel != NO_OPTIMIZATION && OK != eliminateDeadStores())  {
+            SET_FAILED_ON_SRC_LINE;
+
           } else if (OK != scopedNameSpace->srcCloseTopScope(interpretedFileWriter, prevScopeObject, closeErr)) {
             SET_FAILED_ON_SRC_LINE;
 
@@ -210,6 +231,9 @@ int GeneralParser::compileCurrScope ()  {
 
             else if (closeErr == SCOPE_CLOSE_UKNOWN_ERROR || NO_SCOPES_OPEN)
               userMessages->logMsg (INTERNAL_ERROR, L"Failure closing scope with: " + currTkn->descr_line_num_col(), thisSrcFile, __LINE__, 0);
+
+          } else if (OK != finishClosedLoop (prevScopeObject))  {
+            SET_FAILED_ON_SRC_LINE;
           }
 
         } else if (currTkn->tkn_type == SPR8R_TKN && currTkn->_string == L"{")  {
@@ -303,8 +327,9 @@ int GeneralParser::compileCurrScope ()  {
           // Put the current Token back; exprParser will need it!
           tkn_stream.insert(tkn_stream.begin(), currTkn);
           bool isStopFail;
+          std::shared_ptr<ExprTreeNode> exprTree;
           
-          if (OK != handleExpression(isStopFail, is_expr_static, ENDS_IN_STATEMENT_ENDER))
+          if (OK != handleExpression(isStopFail, is_expr_static, ENDS_IN_STATEMENT_ENDER, true, exprTree))
             SET_FAILED_ON_SRC_LINE;
           else
             prevScopeObject = EXPRESSION_OPCODE;
@@ -396,6 +421,13 @@ int GeneralParser::openFloatyScope(Token openScopeTkn)  {
  * Otherwise, only 1 expression is expected and the scope for this block is immediately 
  * closed by this proc in the eyes of both the compiler and the interpreter.
  * [op_code][total_length][conditional EXPRESSION][code block]
+ * When optimizing, a block whose condition is statically false or that follows
+ * a statically true block can never run. It still gets compiled so the user
+ * hears about any errors in it, but it's cut back out of the interpreted file.
+ * If every block in front of a kept [else if]|[else] got cut, the kept block
+ * has to start the chain, so it's written out as an [if] instead.
+ * When profiling, each code block starts with a BLOCK_PROFILE object that
+ * counts how many times the block runs.
  * ***************************************************************************/
 int GeneralParser::compile_if_type_block (uint8_t op_code, Token & openingTkn, bool & isClosedByCurly)  {
   int ret_code = GENERAL_FAILURE;
@@ -408,6 +440,25 @@ int GeneralParser::compile_if_type_block (uint8_t op_code, Token & openingTkn, b
   isClosedByCurly = false;
   bool is_expr_static;
 
+  bool isOptimizing = (optimizeLevel != NO_OPTIMIZATION);
+  uint8_t written_op_code = op_code;
+  ifChainState chainState = NO_IF_CHAIN;
+  bool isUnreachable = false;
+  bool isCondStatic = false;
+  bool isCondTrue = false;
+  std::shared_ptr<ExprTreeNode> condTree;
+
+  if (isOptimizing) {
+    // The chain's state lives in the enclosing scope, which is still the top scope here
+    scopedNameSpace->get_top_if_chain_state (chainState);
+    if (op_code == IF_SCOPE_OPCODE)
+      chainState = NO_IF_CHAIN;
+    else if (chainState == IF_CHAIN_TAKEN)
+      isUnreachable = true;
+    else if (chainState == IF_CHAIN_ALL_REMOVED)
+      written_op_code = IF_SCOPE_OPCODE;
+  }
+
   if ((op_code == IF_SCOPE_OPCODE || op_code == ELSE_IF_SCOPE_OPCODE) && currTkn->tkn_type != SPR8R_TKN && currTkn->_string != L"(")  {
     SET_FAILED_ON_SRC_LINE;
     userMessages->logMsg (USER_ERROR, L"Expected \"(\" after [if] or [else if] but instead got " + currTkn->descr_sans_line_num_col()
@@ -417,7 +468,7 @@ int GeneralParser::compile_if_type_block (uint8_t op_code, Token & openingTkn, b
     // Write out the if block structure to interpreted file
 
     startFilePos = interpretedFileWriter.getWriteFilePos();
-    length_pos = interpretedFileWriter.writeFlexLenOpCode (op_code);
+    length_pos = interpretedFileWriter.writeFlexLenOpCode (written_op_code);
 
     if (0 == length_pos)
       SET_FAILED_ON_SRC_LINE;
@@ -426,9 +477,47 @@ int GeneralParser::compile_if_type_block (uint8_t op_code, Token & openingTkn, b
   if (!isFailed && (op_code == IF_SCOPE_OPCODE || op_code == ELSE_IF_SCOPE_OPCODE)) {
     // Resolve the conditional expression and write it out
     bool isStopFail;
-    if (OK != handleExpression(isStopFail, is_expr_static, ENDS_IN_PARENTHESES))
+    if (OK != handleExpression(isStopFail, is_expr_static, ENDS_IN_PARENTHESES, false, condTree))
       // TODO: How to determine if we should go on if return from handleExpression != OK?
       SET_FAILED_ON_SRC_LINE;
+    else if (isOptimizing)
+      isCondStatic = isStaticCondition (condTree, isCondTrue);
+  
+  } else if (!isFailed && written_op_code != op_code)  {
+    // Surviving [else] promoted to [if]; give it a condition that's always true
+    std::shared_ptr<Token> trueTkn = std::make_shared<Token> (BOOL_TKN, L"true");
+    trueTkn->_unsigned = 1;
+    std::shared_ptr<ExprTreeNode> trueCond = std::make_shared<ExprTreeNode> (trueTkn);
+    if (OK != interpretedFileWriter.writeExprTreeToFile (trueCond, false))
+      SET_FAILED_ON_SRC_LINE;
+  }
+
+  if (!isFailed && isOptimizing)  {
+    if (op_code != ELSE_SCOPE_OPCODE && isCondStatic && !isCondTrue)
+      isUnreachable = true;
+
+    if (isUnreachable)  {
+      // TAKEN, LIVE and ALL_REMOVED chains stay that way
+      if (chainState == NO_IF_CHAIN)
+        chainState = IF_CHAIN_ALL_REMOVED;
+    } else if (op_code == ELSE_SCOPE_OPCODE || isCondTrue)  {
+      chainState = IF_CHAIN_TAKEN;
+    } else  {
+      chainState = IF_CHAIN_LIVE;
+    }
+    scopedNameSpace->set_top_if_chain_state (chainState);
+
+    if (isUnreachable && logLevel >= VERBOSE)
+      std::wcout << L"// OPTIMIZATION: Removed unreachable [" << (op_code == ELSE_IF_SCOPE_OPCODE ? L"else if" : openingTkn._string)
+        << L"] block on line " << openingTkn.get_line_number() << std::endl;
+  }
+
+  if (!isFailed && blockProfile != NULL)  {
+    if (OK != writeBlockProfile (openingTkn))
+      SET_FAILED_ON_SRC_LINE;
+    else if (isOptimizing
+      && OK != noteIfChainBlock (op_code, written_op_code, openingTkn, startFilePos, isUnreachable, isCondStatic, condTree))
+      SET_FAILED_ON_SRC_LINE;
   }
 
   if (!isFailed && !tkn_stream.empty()) {
@@ -439,6 +528,9 @@ int GeneralParser::compile_if_type_block (uint8_t op_code, Token & openingTkn, b
       tkn_stream.erase(tkn_stream.begin());
       isClosedByCurly = true;
       ret_code = scopedNameSpace->openNewScope(op_code, openingTkn, startFilePos, 0);
+      if (OK == ret_code && isUnreachable)
+        // Block gets cut when its closing [}] is reached
+        ret_code = scopedNameSpace->set_top_is_unreachable (true);
 
     } else {
       // No opening [{]. Handle single expression
@@ -461,6 +553,9 @@ int GeneralParser::compile_if_type_block (uint8_t op_code, Token & openingTkn, b
         else if (OK == handleExpression(isStopFail, is_expr_static, ENDS_IN_STATEMENT_ENDER)) {
           ret_code = interpretedFileWriter.writeObjectLen (startFilePos);
         }
+
+        if (OK == ret_code && isUnreachable)
+          ret_code = interpretedFileWriter.truncateTo (startFilePos);
       }
     }
   }
@@ -487,6 +582,8 @@ int GeneralParser::parseVarDeclaration (std::wstring dataTypeStr, std::pair<Toke
 
   uint32_t startFilePos = interpretedFileWriter.getWriteFilePos();
   uint32_t length_pos = interpretedFileWriter.writeFlexLenOpCode (VARIABLES_DECLARATION_OPCODE);
+  // [var_name][init_expression] segments; candidates for removal if the variable never gets read
+  std::vector<std::pair<std::wstring, storeSpan>> declSpans;
 
   if (0 != length_pos)  {
     // Save off the position where the expression's total length is stored and
@@ -509,6 +606,7 @@ int GeneralParser::parseVarDeclaration (std::wstring dataTypeStr, std::pair<Toke
       std::shared_ptr <Token> currTkn;
       Token currVarNameTkn;
       std::wstring lookUpMsg;
+      uint64_t numElements = 0;
 
       while (!isStopFail && !isDeclarationEnded)  {
         if (!tkn_stream.empty())  {
@@ -523,13 +621,18 @@ int GeneralParser::parseVarDeclaration (std::wstring dataTypeStr, std::pair<Toke
           if (parserState == GET_VAR_NAME)  {
             // bool isBobYerUncle, isFailed = false, isDeclarationEnded = false;
             //      ^              ^                 ^
+            uint32_t segmentStartPos = interpretedFileWriter.getWriteFilePos();
+
             if (currTkn->tkn_type != USER_WORD_TKN || currTkn->_string.empty()) {
               userMessages->logMsg (USER_ERROR, L"Expected a USER_WORD for a variable name, but got " + currTkn->descr_sans_line_num_col()
                   , userSrcFileName, currTkn->get_line_number(), currTkn->get_column_pos());
               // TODO: Is it possible to recover from this and keep compiling?
               isStopFail = true;
 
-            } else if (OK != interpretedFileWriter.write_user_var(currTkn->_string, false)) {
+            } else if (OK != parseArraySize (*currTkn, numElements))  {
+              isStopFail = true;
+
+            } else if (OK != interpretedFileWriter.write_user_var(currTkn->_string, numElements > 0, numElements)) {
               // [op_code][total_length][datatype op_code][[string var_name][init_expression]]+
               //                                            ^ Written out
               userMessages->logMsg (INTERNAL_ERROR
@@ -549,6 +652,22 @@ int GeneralParser::parseVarDeclaration (std::wstring dataTypeStr, std::pair<Toke
                   parserState = CHECK_FOR_INIT_EXPR;
                 }
 
+            } else if (numElements > 0)  {
+              // Only the shape matters until run time
+              Token elementTkn (tknType_opCode.first, L"");
+              if (OK != scopedNameSpace->insertNewArrayAtCurrScope(currTkn->_string, elementTkn, numElements, false)) {
+                userMessages->logMsg (INTERNAL_ERROR, L"Failed to insert array " + currTkn->_string + L" into NameSpace AFTER existence check!"
+                    , thisSrcFile, __LINE__, 0);
+
+                isStopFail = true;
+
+              } else  {
+                // Elements get written to 1 at a time, so the declaration never counts as a dead store
+                currVarNameTkn = *currTkn;
+                parserState = CHECK_FOR_INIT_EXPR;
+                numVarsAdded++;
+              }
+
             } else  {
               // Put an uninitialized variable name & Token in the NameSpace
               Token starterTkn (tknType_opCode.first, L"");
@@ -562,6 +681,7 @@ int GeneralParser::parseVarDeclaration (std::wstring dataTypeStr, std::pair<Toke
                 currVarNameTkn = *currTkn;
                 parserState = CHECK_FOR_INIT_EXPR;
                 numVarsAdded++;
+                declSpans.push_back ({currTkn->_string, {segmentStartPos, 0, startFilePos, 0, 0, currTkn->get_line_number()}});
               }
             }
 
@@ -571,6 +691,11 @@ int GeneralParser::parseVarDeclaration (std::wstring dataTypeStr, std::pair<Toke
             if (currTkn->tkn_type == SPR8R_TKN && currTkn->_string == L",") {
               parserState = GET_VAR_NAME;
             
+            } else if (currTkn->tkn_type == SRC_OPR8R_TKN && currTkn->_string == assignOpr8r && numElements > 0) {
+              userMessages->logMsg (USER_ERROR, L"Array " + currVarNameTkn._string + L" cannot be initialized in its declaration; use "
+                  + SYS_CALL_ARRAY_FILL + L"() instead", userSrcFileName, currTkn->get_line_number(), currTkn->get_column_pos());
+              isStopFail = true;
+
             } else if (currTkn->tkn_type == SRC_OPR8R_TKN && currTkn->_string == assignOpr8r) {
               parserState = PARSE_INIT_EXPR;
             
@@ -633,6 +758,19 @@ int GeneralParser::parseVarDeclaration (std::wstring dataTypeStr, std::pair<Toke
 
     if (!isStopFail)
       ret_code = interpretedFileWriter.writeObjectLen (startFilePos);
+
+    if (OK == ret_code && optimizeLevel != NO_OPTIMIZATION && isStoreTrackedScope())  {
+      uint32_t endFilePos = interpretedFileWriter.getWriteFilePos();
+      int idx;
+
+      for (idx = 0; idx < declSpans.size() && OK == ret_code; idx++) {
+        storeSpan & span = declSpans[idx].second;
+        span.end_pos = (idx + 1 < declSpans.size()) ? declSpans[idx + 1].second.start_pos : endFilePos;
+        span.decl_end_pos = endFilePos;
+        span.num_decl_vars = declSpans.size();
+        ret_code = scopedNameSpace->add_top_store_span (declSpans[idx].first, span);
+      }
+    }
   }
 
 
@@ -640,11 +778,62 @@ int GeneralParser::parseVarDeclaration (std::wstring dataTypeStr, std::pair<Toke
 
 }
 
+/* ****************************************************************************
+ * int32 counts[16], total;
+ *             ^ An array name can be followed by its # of elements, which has to
+ * be an integer literal. numElements comes back 0 for a scalar variable.
+ * ***************************************************************************/
+int GeneralParser::parseArraySize (Token & arrayNameTkn, uint64_t & numElements) {
+  int ret_code = GENERAL_FAILURE;
+  numElements = 0;
+
+  if (tkn_stream.empty() || tkn_stream.front()->tkn_type != SPR8R_TKN || tkn_stream.front()->_string != L"[")  {
+    ret_code = OK;
+
+  } else if (tkn_stream.size() < 3)  {
+    userMessages->logMsg (USER_ERROR, L"Incomplete size for array " + arrayNameTkn._string
+        , userSrcFileName, arrayNameTkn.get_line_number(), arrayNameTkn.get_column_pos());
+
+  } else  {
+    Token & sizeTkn = *tkn_stream[1];
+    Token & closerTkn = *tkn_stream[2];
+
+    if ((!sizeTkn.isUnsigned() && !sizeTkn.isSigned()) || (sizeTkn.isUnsigned() && sizeTkn._unsigned == 0)
+      || (sizeTkn.isSigned() && sizeTkn._signed <= 0))  {
+      userMessages->logMsg (USER_ERROR, L"Size of array " + arrayNameTkn._string + L" must be an integer literal > 0 but got "
+          + sizeTkn.descr_sans_line_num_col(), userSrcFileName, sizeTkn.get_line_number(), sizeTkn.get_column_pos());
+
+    } else if (closerTkn.tkn_type != SPR8R_TKN || closerTkn._string != L"]")  {
+      userMessages->logMsg (USER_ERROR, L"Expected []] after size of array " + arrayNameTkn._string + L" but got "
+          + closerTkn.descr_sans_line_num_col(), userSrcFileName, closerTkn.get_line_number(), closerTkn.get_column_pos());
+
+    } else  {
+      numElements = (sizeTkn.isUnsigned() ? sizeTkn._unsigned : (uint64_t) sizeTkn._signed);
+      tkn_stream.erase (tkn_stream.begin(), tkn_stream.begin() + 3);
+      ret_code = OK;
+    }
+  }
+
+  return (ret_code);
+}
+
 /* ****************************************************************************
  * All the logic to parse & compile an expression and write it out to the
  * interpreted file is in this proc.
  * ***************************************************************************/
 int GeneralParser::handleExpression (bool & isStopFail, bool & is_expr_static, expr_ender_type expr_ended_by) {
+  std::shared_ptr<ExprTreeNode> exprTree;
+
+  return (handleExpression (isStopFail, is_expr_static, expr_ended_by, false, exprTree));
+}
+
+/* ****************************************************************************
+ * isStandAloneStmt indicates the expression is a statement directly inside the
+ * current scope, so a store it makes can be cut back out if the variable never
+ * gets read. exprTree is handed back as written, after any constant folding.
+ * ***************************************************************************/
+int GeneralParser::handleExpression (bool & isStopFail, bool & is_expr_static, expr_ender_type expr_ended_by, bool isStandAloneStmt
+  , std::shared_ptr<ExprTreeNode> & exprTree) {
   int ret_code = GENERAL_FAILURE;
 
   if (tkn_stream.empty()) {
@@ -655,12 +844,12 @@ int GeneralParser::handleExpression (bool & isStopFail, bool & is_expr_static, e
     std::shared_ptr <Token> currTkn = tkn_stream.front();
 
     std::shared_ptr<Token> emptyTkn = std::make_shared<Token>();
-    std::shared_ptr<ExprTreeNode> exprTree = std::make_shared<ExprTreeNode> (emptyTkn);
-    int expected_ret_tkn_cnt;
+    exprTree = std::make_shared<ExprTreeNode> (emptyTkn);
     Token exprEnder;
     Token tmpTkn;
-    std::vector<Token> flatExprTkns;
     bool isExprClosed;
+    uint8_t exprTypes;
+    uint32_t exprStartPos = interpretedFileWriter.getWriteFilePos();
     int makeTreeRetCode = exprParser.makeExprTree (tkn_stream, exprTree, exprEnder, expr_ended_by, isExprClosed, false, is_expr_static);
 
     if (OK != makeTreeRetCode && isProgressBlocked()) {
@@ -675,27 +864,41 @@ int GeneralParser::handleExpression (bool & isStopFail, bool & is_expr_static, e
       if (OK != chompUntil_infoMsgAfter (ender_list, tmpTkn))
         isStopFail = true;
 
-    } else if (OK != usrSrcTerms.flattenExprTree(exprTree, flatExprTkns)) {
-      // (3 + 4) -> [3][4][+]
+    } else if (OK != typeChecker.checkExprTree(exprTree, exprTypes))  {
+      // Data type contention; TypeChecker has already told the user about it
       isStopFail = true;
-    
-    } else if (OK != interpretedFileWriter.writeFlatExprToFile(flatExprTkns, logLevel >= ILLUSTRATIVE)) {
-      // Write out to interpreted file BEFORE we destructively resolve the flat stream of Tokens that make up the expression
+
+    } else if (optimizeLevel != NO_OPTIMIZATION && OK != propagateConstants(exprTree)) {
       isStopFail = true;
 
-    } else if (OK != interpreter.resolveFlatExpr(flatExprTkns, expected_ret_tkn_cnt)) {
+    } else if (optimizeLevel != NO_OPTIMIZATION && OK != constantFolder.foldExprTree(exprTree)) {
+      isStopFail = true;
+
+    } else if (optimizeLevel != NO_OPTIMIZATION && OK != algebraicSimplifier.simplifyExprTree(exprTree)) {
+      isStopFail = true;
+
+    } else if (optimizeLevel != NO_OPTIMIZATION && OK != loopInvariantHoister.hoistInvariants(exprTree)) {
+      isStopFail = true;
+
+    } else if (optimizeLevel != NO_OPTIMIZATION && OK != commonSubExprEliminator.eliminateCommonSubExprs(exprTree)) {
+      isStopFail = true;
+
+    } else if (optimizeLevel != NO_OPTIMIZATION && OK != buildLookupTables(exprTree)) {
+      isStopFail = true;
+
+    } else if (optimizeLevel != NO_OPTIMIZATION && OK != flattenConcats(exprTree)) {
+      isStopFail = true;
+
+    } else if (OK != interpretedFileWriter.writeExprTreeToFile(exprTree, logLevel >= ILLUSTRATIVE)) {
+      // (3 + 4) -> [+][3][4]
       isStopFail = true;
 
     } else  {
-      // flattenedExpr should have 1 Token left - the result of the expression
-      if (flatExprTkns.size() != expected_ret_tkn_cnt)  {
-        userMessages->logMsg(INTERNAL_ERROR, L"Failed to resolve expression starting with " + currTkn->descr_sans_line_num_col()
-            , thisSrcFile, __LINE__, 0);
-        isStopFail = true;
-      
-      } else {
-        ret_code = OK;
+      if (optimizeLevel != NO_OPTIMIZATION)  {
+        trackVarUsage (exprTree, isStandAloneStmt, exprStartPos);
+        noteKnownValues (exprTree, isStandAloneStmt);
       }
+      ret_code = OK;
     }
   }
 
@@ -703,8 +906,8 @@ int GeneralParser::handleExpression (bool & isStopFail, bool & is_expr_static, e
 }
 
 /* ****************************************************************************
- * Found the beginning of an initialization expression. Resolve the expression
- * and update the variable that was placed in the NameSpace earlier.
+ * Found the beginning of an initialization expression. Type check the expression
+ * against the variable that was placed in the NameSpace earlier, then write it out.
  * ***************************************************************************/
 int GeneralParser::resolveVarInitExpr (Token & varTkn, Token currTkn, Token & closerTkn, bool & isDeclarationEnded) {
   int ret_code = GENERAL_FAILURE;
@@ -714,14 +917,11 @@ int GeneralParser::resolveVarInitExpr (Token & varTkn, Token currTkn, Token & cl
   std::shared_ptr<ExprTreeNode> exprTree = std::make_shared<ExprTreeNode> (emptyTkn);
 
   Token exprEnder;
-  std::vector<Token> flatExprTkns;
   closerTkn.resetToken();
   bool is_expr_static;
-  int expected_ret_tkn_cnt;
 
   int makeTreeRetCode = exprParser.makeExprTree (tkn_stream, exprTree, exprEnder, ENDS_IN_COMMA, isExprClosed, true, is_expr_static);
   closerTkn = exprEnder;
-  std::wstring lookUpMsg;
 
   if (OK != makeTreeRetCode)  {
     SET_FAILED_ON_SRC_LINE;
@@ -732,34 +932,41 @@ int GeneralParser::resolveVarInitExpr (Token & varTkn, Token currTkn, Token & cl
       userMessages->logMsg (INTERNAL_ERROR
           , L"Expected expression to close on [,] or " + usrSrcTerms.get_statement_ender() + L" but got " + closerTkn.descr_sans_line_num_col(), thisSrcFile, __LINE__, 0);
 
-  } else if (OK != usrSrcTerms.flattenExprTree(exprTree, flatExprTkns)) {
-    // (3 + 4) -> [3][4][+]
+  } else if (OK != typeChecker.checkVarInitExpr(varTkn._string, exprTree))  {
+    // Init expression must be assignable to the declared data type; marks the variable as initialized if it is
     SET_FAILED_ON_SRC_LINE;
-  
-  } else if (OK != interpretedFileWriter.writeFlatExprToFile(flatExprTkns, false))  {
-    // Write out the expression BEFORE we destructively resolve it
+
+  } else if (optimizeLevel != NO_OPTIMIZATION && OK != propagateConstants(exprTree))  {
     SET_FAILED_ON_SRC_LINE;
 
-  } else if (OK != interpreter.resolveFlatExpr(flatExprTkns, expected_ret_tkn_cnt)) {
+  } else if (optimizeLevel != NO_OPTIMIZATION && OK != constantFolder.foldExprTree(exprTree))  {
     SET_FAILED_ON_SRC_LINE;
 
-  } else if (!failed_on_src_line) {
-    // flattenedExpr should have 1 Token left - the result of the expression
-    if (flatExprTkns.size() != expected_ret_tkn_cnt)  {
-      userMessages->logMsg (INTERNAL_ERROR, L"Failed to resolve variable initialization expression for " + varTkn.descr_sans_line_num_col()
-          , thisSrcFile, __LINE__, 0);
-      SET_FAILED_ON_SRC_LINE;
+  } else if (optimizeLevel != NO_OPTIMIZATION && OK != algebraicSimplifier.simplifyExprTree(exprTree))  {
+    SET_FAILED_ON_SRC_LINE;
 
-    } else if (OK != scopedNameSpace->findVar(varTkn._string, 0, flatExprTkns[0], COMMIT_WRITE, lookUpMsg)) {
-      // Don't limit search to current scope
-      userMessages->logMsg (INTERNAL_ERROR
-          , lookUpMsg + L" in " + userSrcFileName + L" on|near " + currTkn.descr_line_num_col(), thisSrcFile, __LINE__, 0);
-      SET_FAILED_ON_SRC_LINE;
-    }
-  }
+  } else if (optimizeLevel != NO_OPTIMIZATION && OK != loopInvariantHoister.hoistInvariants(exprTree))  {
+    SET_FAILED_ON_SRC_LINE;
 
-  if (!failed_on_src_line)  {
-    ret_code = OK;
+  } else if (optimizeLevel != NO_OPTIMIZATION && OK != commonSubExprEliminator.eliminateCommonSubExprs(exprTree))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (optimizeLevel != NO_OPTIMIZATION && OK != buildLookupTables(exprTree))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (optimizeLevel != NO_OPTIMIZATION && OK != flattenConcats(exprTree))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (OK != interpretedFileWriter.writeExprTreeToFile(exprTree, false))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (optimizeLevel != NO_OPTIMIZATION)  {
+    markVarsRead_OLR (exprTree);
+    if (!isRemovableStore (varTkn._string, skipStatementEnder (exprTree)))
+      // Initializer has to stay, and so does the variable it initializes
+      scopedNameSpace->markVarRead (varTkn._string);
+    constantPropagator.killWrittenVars (exprTree);
+    constantPropagator.noteStore (varTkn._string, skipStatementEnder (exprTree), true);
   }
 
   return (ret_code);
@@ -783,6 +990,9 @@ int GeneralParser::resolveVarInitExpr (Token & varTkn, Token currTkn, Token & cl
   bool is_init_expr_filled = false, is_cond_expr_filled = false, is_last_expr_filled = false;
   bool is_init_expr_static, is_cond_expr_static, is_last_expr_static;
   bool is_expr_static;
+  std::shared_ptr<ExprTreeNode> init_expr_tree, cond_expr_tree, last_expr_tree;
+  std::wstring init_var_name;
+  Token init_val_tkn;
 
   startFilePos = interpretedFileWriter.getWriteFilePos();
   length_pos = interpretedFileWriter.writeFlexLenOpCode (FOR_SCOPE_OPCODE);
@@ -791,24 +1001,37 @@ int GeneralParser::resolveVarInitExpr (Token & varTkn, Token currTkn, Token & cl
     SET_FAILED_ON_SRC_LINE;
   else if (OK != exprParser.check_for_expected_token(tkn_stream, openingTkn, L"(", true))
     SET_FAILED_ON_SRC_LINE;
+  else if (optimizeLevel != NO_OPTIMIZATION && OK != loopInvariantHoister.openLoop (FOR_SCOPE_OPCODE, openingTkn, tkn_stream, 1, startFilePos))
+    SET_FAILED_ON_SRC_LINE;
   
   if (!failed_on_src_line) {
+    if (optimizeLevel != NO_OPTIMIZATION)
+      peekForLoopInit (init_var_name, init_val_tkn);
+
     if (OK != scopedNameSpace->openNewScope(FOR_SCOPE_OPCODE, openingTkn, startFilePos, 0)) {
       // Open up the scope 1st because we could have some variables to insert when compiling the control block
       SET_FAILED_ON_SRC_LINE;
     
-    } else if (OK != compile_for_loop_ctrl_expr(0, is_init_expr_filled, is_init_expr_static)) {
+    } else if (OK != compile_for_loop_ctrl_expr(0, is_init_expr_filled, is_init_expr_static, init_expr_tree)) {
       // Init expression can be empty, but closes with ;
       SET_FAILED_ON_SRC_LINE;
+
+    } else if (optimizeLevel != NO_OPTIMIZATION && OK != forgetLoopWrittenVars ())  {
+      // Init expression only runs once, so it can still use what was known going into the loop
+      SET_FAILED_ON_SRC_LINE;
     
-    } else if (OK != compile_for_loop_ctrl_expr(1, is_cond_expr_filled, is_cond_expr_static))  {
+    } else if (OK != compile_for_loop_ctrl_expr(1, is_cond_expr_filled, is_cond_expr_static, cond_expr_tree))  {
       // Can conditional expression can be empty? Closes with ;
       SET_FAILED_ON_SRC_LINE;
 
-    } else if (OK != compile_for_loop_ctrl_expr(2, is_last_expr_filled, is_last_expr_static))  {
+    } else if (OK != compile_for_loop_ctrl_expr(2, is_last_expr_filled, is_last_expr_static, last_expr_tree))  {
       // Can be empty; closes with [)]
       SET_FAILED_ON_SRC_LINE;
 
+    } else if (optimizeLevel != NO_OPTIMIZATION && OK != markCountedForLoop (openingTkn, startFilePos, init_var_name, init_val_tkn
+      , cond_expr_tree, last_expr_tree)) {
+      SET_FAILED_ON_SRC_LINE;
+
     } else {
       // Setting referred in check AFTER entire loop compiled 
       scopedNameSpace->set_top_is_exists_for_loop_cond(is_cond_expr_filled);
@@ -856,6 +1079,9 @@ int GeneralParser::resolveVarInitExpr (Token & varTkn, Token currTkn, Token & cl
             else if (closeErr == SCOPE_CLOSE_UKNOWN_ERROR || NO_SCOPES_OPEN)
               userMessages->logMsg (INTERNAL_ERROR, L"Failure closing scope with: " + currTkn->descr_line_num_col(), thisSrcFile, __LINE__, 0);
           
+          } else if (OK != finishClosedLoop (scopeOpCode))  {
+            SET_FAILED_ON_SRC_LINE;
+
           } else  {
             ret_code = OK;
           }
@@ -880,10 +1106,12 @@ int GeneralParser::resolveVarInitExpr (Token & varTkn, Token currTkn, Token & cl
  * 1 if there's a "normal" expression instead?
  * FOR_INIT_IDX: Should I check the # of vars that have been initialized? Min of 1?  
  * ***************************************************************************/
- int GeneralParser::compile_for_loop_ctrl_expr (int exprIdx, bool & is_expr_full, bool & is_expr_static) {
+ int GeneralParser::compile_for_loop_ctrl_expr (int exprIdx, bool & is_expr_full, bool & is_expr_static
+  , std::shared_ptr<ExprTreeNode> & exprTree) {
   int ret_code = GENERAL_FAILURE;
 
   is_expr_full = false;
+  exprTree = NULL;
 
   uint32_t startFilePos;
   uint32_t length_pos;
@@ -960,7 +1188,7 @@ int GeneralParser::resolveVarInitExpr (Token & varTkn, Token currTkn, Token & cl
         expr_ended_by = ENDS_IN_PARENTHESES;
       }
       is_expr_full = true;
-      ret_code = handleExpression(isStopFail, is_expr_static, expr_ended_by);
+      ret_code = handleExpression(isStopFail, is_expr_static, expr_ended_by, false, exprTree);
       if (ret_code != OK)      
         SET_FAILED_ON_SRC_LINE;
     }
@@ -1031,6 +1259,12 @@ int GeneralParser::resolveVarInitExpr (Token & varTkn, Token currTkn, Token & cl
   if (0 == length_pos)  {
     SET_FAILED_ON_SRC_LINE;
   
+  } else if (optimizeLevel != NO_OPTIMIZATION && OK != loopInvariantHoister.openLoop (WHILE_SCOPE_OPCODE, openingTkn, tkn_stream, 0, startFilePos))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (optimizeLevel != NO_OPTIMIZATION && OK != forgetLoopWrittenVars ())  {
+    SET_FAILED_ON_SRC_LINE;
+
   } else if (OK != handleExpression(isFailed, is_expr_static, ENDS_IN_PARENTHESES))  {
     SET_FAILED_ON_SRC_LINE;
 
@@ -1078,6 +1312,9 @@ int GeneralParser::resolveVarInitExpr (Token & varTkn, Token currTkn, Token & cl
           else if (closeErr == SCOPE_CLOSE_UKNOWN_ERROR || NO_SCOPES_OPEN)
             userMessages->logMsg (INTERNAL_ERROR, L"Failure closing scope with: " + currTkn->descr_line_num_col(), thisSrcFile, __LINE__, 0);
         
+        } else if (OK != finishClosedLoop (scopeOpCode))  {
+          SET_FAILED_ON_SRC_LINE;
+
         } else  {
           ret_code = OK;
         }
@@ -1090,6 +1327,217 @@ int GeneralParser::resolveVarInitExpr (Token & varTkn, Token currTkn, Token & cl
   return ret_code;
 }
 
+/* ****************************************************************************
+ * A [while]|[for] loop just closed, so whatever the loop optimizations worked
+ * out while it was being compiled can be applied to what got written out
+ * ***************************************************************************/
+int GeneralParser::finishClosedLoop (uint8_t closedScopeOpCode)  {
+  int ret_code = GENERAL_FAILURE;
+  loopContext closedLoop;
+
+  if (optimizeLevel == NO_OPTIMIZATION || (closedScopeOpCode != WHILE_SCOPE_OPCODE && closedScopeOpCode != FOR_SCOPE_OPCODE))  {
+    ret_code = OK;
+
+  } else if (OK != loopInvariantHoister.closeLoop (closedScopeOpCode, closedLoop))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (interpretedFileWriter.getWriteFilePos() <= closedLoop.loop_start_pos)  {
+    // The whole loop was unreachable and got cut
+    ret_code = OK;
+
+  } else if (OK != unrollForLoop (closedLoop))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (OK != writeLoopPreHeader (closedLoop))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    ret_code = OK;
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * Anything hoisted out of the loop gets written as [=tmp][inv::N][sub-expression]
+ * EXPRESSIONs and then moved in front of the loop, so they're done once before
+ * the loop starts.
+ * ***************************************************************************/
+int GeneralParser::writeLoopPreHeader (loopContext & closedLoop)  {
+  int ret_code = GENERAL_FAILURE;
+  uint32_t preHeaderPos = interpretedFileWriter.getWriteFilePos();
+
+  if (closedLoop.hoisted.empty())  {
+    ret_code = OK;
+
+  } else  {
+    ret_code = OK;
+    for (auto hoisted8r = closedLoop.hoisted.begin(); hoisted8r != closedLoop.hoisted.end() && OK == ret_code; hoisted8r++) {
+      // Variables only read by the pre-header still count as read
+      markVarsRead_OLR (hoisted8r->store_tree);
+      ret_code = interpretedFileWriter.writeExprTreeToFile (hoisted8r->store_tree, logLevel >= ILLUSTRATIVE);
+
+      if (OK == ret_code && logLevel >= VERBOSE)
+        std::wcout << L"// OPTIMIZATION: Hoisted loop invariant into [inv::" << hoisted8r->slot_num << L"] in front of ["
+          << (closedLoop.opener_opcode == WHILE_SCOPE_OPCODE ? L"while" : L"for") << L"] loop on line " << closedLoop.line_num << std::endl;
+    }
+
+    if (OK == ret_code)
+      ret_code = interpretedFileWriter.moveTailTo (preHeaderPos, closedLoop.loop_start_pos);
+
+    if (OK != ret_code)
+      SET_FAILED_ON_SRC_LINE;
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * A [for] loop with a trip count known at compile time gets rewritten as
+ * [UNROLLED_FOR][total_length][init_expression][last_expression][repeat count]
+ *   [trips per block][code_block length][unrolled block: [code_block] x N][remainder block]
+ * so the Interpreter doesn't check the conditional at all. Loops with few
+ * enough trips get fully unrolled into a block that runs once. Otherwise the
+ * unrolled block holds unrollFactor trips and gets repeated; the leftover trips
+ * go in the remainder block. The last expression stays a single object so the
+ * Interpreter can cache it rather than decode it again after every trip. Bodies
+ * with a [break] or a variable declaration are left alone.
+ * ***************************************************************************/
+int GeneralParser::unrollForLoop (loopContext & closedLoop)  {
+  int ret_code = GENERAL_FAILURE;
+  uint32_t loopEndPos = interpretedFileWriter.getWriteFilePos();
+  std::string loopBytes;
+
+  if (closedLoop.opener_opcode != FOR_SCOPE_OPCODE || closedLoop.const_trip_cnt <= 0 || closedLoop.is_body_breaking
+    || closedLoop.is_body_declaring || maxUnrollTrips <= 0)  {
+    ret_code = OK;
+
+  } else if (OK != interpretedFileWriter.readBytes (closedLoop.loop_start_pos, loopEndPos - closedLoop.loop_start_pos, loopBytes))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    // [op_code][total_length][init_expression][conditional_expression][last_expression][code_block]
+    uint32_t initPos = OPCODE_NUM_BYTES + NUM_BYTES_IN_DWORD;
+    uint32_t condPos = initPos + interpretedFileWriter.getRawObjectLen (loopBytes, initPos);
+    uint32_t lastPos = condPos + interpretedFileWriter.getRawObjectLen (loopBytes, condPos);
+    uint32_t bodyPos = lastPos + interpretedFileWriter.getRawObjectLen (loopBytes, lastPos);
+    uint64_t numTrips = closedLoop.const_trip_cnt;
+    uint64_t tripsPerBlock = 0, numRepeats = 0, numLeftOver = 0;
+
+    if (condPos <= initPos || lastPos <= condPos || bodyPos <= lastPos || bodyPos > loopBytes.size())  {
+      userMessages->logMsg (INTERNAL_ERROR, L"Malformed [for] loop object at " + std::to_wstring(closedLoop.loop_start_pos)
+        , thisSrcFile, __LINE__, 0);
+      SET_FAILED_ON_SRC_LINE;
+
+    } else  {
+      std::string oneTrip = loopBytes.substr (bodyPos);
+
+      if (oneTrip.empty())  {
+        // Nothing to lay out back to back
+
+      } else if (numTrips <= maxUnrollTrips && numTrips * oneTrip.size() <= MAX_UNROLLED_LOOP_BYTES)  {
+        tripsPerBlock = numTrips;
+        numRepeats = 1;
+
+      } else if (unrollFactor > 1 && numTrips >= 2 * unrollFactor && (2 * unrollFactor - 1) * oneTrip.size() <= MAX_UNROLLED_LOOP_BYTES)  {
+        tripsPerBlock = unrollFactor;
+        numRepeats = numTrips / unrollFactor;
+        numLeftOver = numTrips % unrollFactor;
+      }
+
+      if (tripsPerBlock == 0)  {
+        ret_code = OK;
+
+      } else if (OK != interpretedFileWriter.truncateTo (closedLoop.loop_start_pos)
+        || 0 == interpretedFileWriter.writeFlexLenOpCode (UNROLLED_FOR_SCOPE_OPCODE)
+        || OK != interpretedFileWriter.writeRawBytes (loopBytes.substr (initPos, condPos - initPos))
+        || OK != interpretedFileWriter.writeRawBytes (loopBytes.substr (lastPos, bodyPos - lastPos))
+        || OK != interpretedFileWriter.writeRawUnsigned (numRepeats, NUM_BITS_IN_DWORD)
+        || OK != interpretedFileWriter.writeRawUnsigned (tripsPerBlock, NUM_BITS_IN_DWORD)
+        || OK != interpretedFileWriter.writeRawUnsigned (oneTrip.size(), NUM_BITS_IN_DWORD))  {
+        SET_FAILED_ON_SRC_LINE;
+
+      } else  {
+        ret_code = OK;
+        for (uint64_t tripNum = 0; tripNum < tripsPerBlock + numLeftOver && OK == ret_code; tripNum++)
+          ret_code = interpretedFileWriter.writeRawBytes (oneTrip);
+
+        if (OK == ret_code)
+          ret_code = interpretedFileWriter.writeObjectLen (closedLoop.loop_start_pos);
+
+        if (OK != ret_code)
+          SET_FAILED_ON_SRC_LINE;
+        else if (logLevel >= VERBOSE)
+          std::wcout << L"// OPTIMIZATION: Unrolled [for] loop on line " << closedLoop.line_num << L"; " << numTrips << L" trips as "
+            << numRepeats << L" x " << tripsPerBlock << L" + " << numLeftOver << std::endl;
+      }
+    }
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * Before the [for] loop's init expression gets compiled, see if it's a plain
+ * [data type] var = literal; or var = literal;
+ * ***************************************************************************/
+void GeneralParser::peekForLoopInit (std::wstring & initVarName, Token & initValTkn)  {
+  int idx = 0;
+
+  initVarName.clear();
+
+  if (!tkn_stream.empty() && usrSrcTerms.getDataType_tknEnum_opCode (tkn_stream[0]->_string).second != INVALID_OPCODE)
+    idx++;
+
+  if (tkn_stream.size() > idx + 3 && tkn_stream[idx]->tkn_type == USER_WORD_TKN
+    && tkn_stream[idx + 1]->tkn_type == SRC_OPR8R_TKN && tkn_stream[idx + 1]->_string == usrSrcTerms.getSrcOpr8rStrFor (ASSIGNMENT_OPR8R_OPCODE)
+    && (tkn_stream[idx + 2]->isSigned() || tkn_stream[idx + 2]->isUnsigned())
+    && tkn_stream[idx + 3]->tkn_type == SRC_OPR8R_TKN && tkn_stream[idx + 3]->_string == usrSrcTerms.get_statement_ender())  {
+    initVarName = tkn_stream[idx]->_string;
+    initValTkn = *tkn_stream[idx + 2];
+  }
+}
+
+/* ****************************************************************************
+ * All 3 [for] loop control expressions have been compiled. If the loop turns out
+ * to be counted, its op_code gets swapped so the Interpreter works out the trip
+ * count at loop entry rather than checking the conditional on every trip. If
+ * the trip count can be worked out right now, the loop can get unrolled once
+ * it closes.
+ * ***************************************************************************/
+int GeneralParser::markCountedForLoop (Token & openingTkn, uint32_t loopStartPos, std::wstring initVarName, Token & initValTkn
+  , std::shared_ptr<ExprTreeNode> condTree, std::shared_ptr<ExprTreeNode> lastTree)  {
+  int ret_code = GENERAL_FAILURE;
+  inductionVar indVar;
+
+  if (!loopInvariantHoister.isCountedLoop (condTree, lastTree, indVar))  {
+    ret_code = OK;
+
+  } else if (OK != interpretedFileWriter.rewriteOpCode (loopStartPos, COUNTED_FOR_SCOPE_OPCODE))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    Token varTkn;
+    std::wstring lookUpMsg;
+    int64_t start, limit, numTrips;
+
+    if (logLevel >= VERBOSE)
+      std::wcout << L"// OPTIMIZATION: [for] loop on line " << openingTkn.get_line_number()
+        << L" is counted; trip count gets computed at loop entry" << std::endl;
+
+    if (indVar.var_name == initVarName && util.getCountedLoopValue (initValTkn, start) && util.getCountedLoopValue (indVar.limit_tkn, limit)
+      && OK == scopedNameSpace->findVar (indVar.var_name, 0, varTkn, READ_ONLY, lookUpMsg)
+      && util.calcLoopTripCount (indVar.cond_op_code, start, limit, indVar.step, numTrips)
+      // An unsigned variable can't go negative without wrapping around, and then the conditional would see something else
+      && (!(varTkn.isUnsigned() || indVar.limit_tkn.isUnsigned()) || (start >= 0 && limit >= 0 && start + numTrips * indVar.step >= 0)))
+      loopInvariantHoister.setConstTripCount (numTrips);
+
+    ret_code = OK;
+  }
+
+  return ret_code;
+}
+
 /* ****************************************************************************
  * Encounted a stand-alone system call, so call the right ExpressionParser call
  * to do the heavy lifting and then write the expression out to the interpreted
@@ -1100,7 +1548,7 @@ int GeneralParser::resolveVarInitExpr (Token & varTkn, Token currTkn, Token & cl
 
   std::shared_ptr<Token> sys_call_def_tkn = std::make_shared<Token>(sys_call_name_tkn);
   std::shared_ptr<ExprTreeNode> sys_call_node = std::make_shared<ExprTreeNode> (sys_call_def_tkn);
-  std::vector<Token> sys_call_tkn_list;
+  uint8_t sys_call_types;
 
   if (OK == exprParser.compile_system_call(tkn_stream, sys_call_node)) {
     // TODO:
@@ -1109,22 +1557,470 @@ int GeneralParser::resolveVarInitExpr (Token & varTkn, Token currTkn, Token & cl
       std::wcout << L"Compiler's Parse Tree for stand-alone system call" << std::endl;
       exprParser.displayParseTree(sys_call_node, 0);
     }
-    if (OK != usrSrcTerms.flatten_system_call(sys_call_node, sys_call_tkn_list))  {
-      // Turn this system call into a flat expression
+    if (OK != typeChecker.checkSystemCall(sys_call_node, sys_call_types))  {
+      // Parameter data type contention
       SET_FAILED_ON_SRC_LINE;
-    
-    // TODO: Exercise expression to test for data type contention
+
+    } else if (optimizeLevel != NO_OPTIMIZATION && OK != propagateConstants(sys_call_node))  {
+      SET_FAILED_ON_SRC_LINE;
+
+    } else if (optimizeLevel != NO_OPTIMIZATION && OK != constantFolder.foldExprTree(sys_call_node))  {
+      SET_FAILED_ON_SRC_LINE;
+
+    } else if (optimizeLevel != NO_OPTIMIZATION && OK != algebraicSimplifier.simplifyExprTree(sys_call_node))  {
+      SET_FAILED_ON_SRC_LINE;
+
+    } else if (optimizeLevel != NO_OPTIMIZATION && OK != loopInvariantHoister.hoistInvariants(sys_call_node))  {
+      SET_FAILED_ON_SRC_LINE;
+
+    } else if (optimizeLevel != NO_OPTIMIZATION && OK != commonSubExprEliminator.eliminateCommonSubExprs(sys_call_node))  {
+      SET_FAILED_ON_SRC_LINE;
+
+    } else if (optimizeLevel != NO_OPTIMIZATION && OK != buildLookupTables(sys_call_node))  {
+      SET_FAILED_ON_SRC_LINE;
+
+    } else if (optimizeLevel != NO_OPTIMIZATION && OK != flattenConcats(sys_call_node))  {
+      SET_FAILED_ON_SRC_LINE;
+
     } else {
-      // Write the Token stream out to the interpreted file
+      // Write the system call and its parameter expressions out to the interpreted file
       Token tmp_tkn;
-      if (OK != interpretedFileWriter.writeFlatExprToFile (sys_call_tkn_list, false))
+      if (OK != interpretedFileWriter.writeExprTreeToFile (sys_call_node, false))
         SET_FAILED_ON_SRC_LINE;
       else if (OK != exprParser.check_for_expected_token (tkn_stream, tmp_tkn, L";", true))
         SET_FAILED_ON_SRC_LINE;
       else
         ret_code = OK;
+
+      if (OK == ret_code && optimizeLevel != NO_OPTIMIZATION)  {
+        markVarsRead_OLR (sys_call_node);
+        constantPropagator.killWrittenVars (sys_call_node);
+      }
     }
   }
 
   return ret_code;
  }
+
+/* ****************************************************************************
+ * A condition is static if constant folding left nothing but a literal behind.
+ * DATETIME gets left alone; it has no truthiness.
+ * ***************************************************************************/
+bool GeneralParser::isStaticCondition (std::shared_ptr<ExprTreeNode> condTree, bool & isCondTrue)  {
+  bool isStatic = false;
+  isCondTrue = false;
+
+  std::shared_ptr<ExprTreeNode> condNode = skipStatementEnder (condTree);
+
+  if (condNode != NULL && condNode->originalTkn != NULL && condNode->_1stChild == NULL && condNode->_2ndChild == NULL
+    && constantFolder.isLiteral (*condNode->originalTkn) && condNode->originalTkn->tkn_type != DATETIME_TKN)  {
+    isStatic = true;
+    isCondTrue = condNode->originalTkn->evalResolvedTokenAsIf();
+  }
+
+  return isStatic;
+}
+
+/* ****************************************************************************
+ * Stores are only tracked inside [if] type and [while] blocks. Variables at the
+ * root scope get displayed after the run, and the [for] control header lives
+ * in the same scope as its block, so both are left alone.
+ * ***************************************************************************/
+bool GeneralParser::isStoreTrackedScope ()  {
+  uint8_t scopener_op_code;
+
+  return (OK == scopedNameSpace->get_top_opener_opcode(scopener_op_code)
+    && (scopener_op_code == IF_SCOPE_OPCODE || scopener_op_code == ELSE_IF_SCOPE_OPCODE
+      || scopener_op_code == ELSE_SCOPE_OPCODE || scopener_op_code == WHILE_SCOPE_OPCODE));
+}
+
+/* ****************************************************************************
+ * Storing valueNode into varName can be cut if the value is a literal that the
+ * interpreter would accept for the variable, and the variable lives in the
+ * current scope. Anything else could fail or have side effects at run time.
+ * ***************************************************************************/
+bool GeneralParser::isRemovableStore (std::wstring varName, std::shared_ptr<ExprTreeNode> valueNode)  {
+  bool isRemovable = false;
+  std::wstring errMsg;
+  Token varTkn;
+
+  if (isStoreTrackedScope() && valueNode != NULL && valueNode->originalTkn != NULL && valueNode->_1stChild == NULL
+    && valueNode->_2ndChild == NULL && constantFolder.isLiteral (*valueNode->originalTkn)
+    && OK == scopedNameSpace->findVar (varName, 1, varTkn, READ_ONLY, errMsg))  {
+    // Try the conversion on a copy, so the compile time NameSpace entry doesn't change
+    isRemovable = (OK == varTkn.convertTo (*valueNode->originalTkn, varName, errMsg));
+  }
+
+  return isRemovable;
+}
+
+/* ****************************************************************************
+ * [;] is syntactic sugar; hand back whatever hangs off of it
+ * ***************************************************************************/
+std::shared_ptr<ExprTreeNode> GeneralParser::skipStatementEnder (std::shared_ptr<ExprTreeNode> exprTree)  {
+  std::shared_ptr<ExprTreeNode> stmtNode = exprTree;
+
+  if (stmtNode != NULL && stmtNode->originalTkn != NULL && stmtNode->originalTkn->tkn_type == SRC_OPR8R_TKN
+    && stmtNode->originalTkn->_string == usrSrcTerms.get_statement_ender() && stmtNode->_2ndChild == NULL)
+    stmtNode = stmtNode->_1stChild;
+
+  return stmtNode;
+}
+
+/* ****************************************************************************
+ * Dead store bookkeeping for an expression that was just written out. A
+ * stand-alone [x = literal;] gets recorded so it can be cut if x is never
+ * read; every other variable that shows up counts as read.
+ * ***************************************************************************/
+void GeneralParser::trackVarUsage (std::shared_ptr<ExprTreeNode> exprTree, bool isStandAloneStmt, uint32_t exprStartPos)  {
+  bool isRecorded = false;
+  std::shared_ptr<ExprTreeNode> stmtNode = skipStatementEnder (exprTree);
+
+  if (isStandAloneStmt && stmtNode != NULL && stmtNode->originalTkn != NULL
+    && stmtNode->originalTkn->tkn_type == SRC_OPR8R_TKN
+    && usrSrcTerms.getOpCodeFor (stmtNode->originalTkn->_string) == ASSIGNMENT_OPR8R_OPCODE
+    && stmtNode->_1stChild != NULL && stmtNode->_1stChild->originalTkn->tkn_type == USER_WORD_TKN
+    && isRemovableStore (stmtNode->_1stChild->originalTkn->_string, stmtNode->_2ndChild))  {
+
+    Token & varTkn = *stmtNode->_1stChild->originalTkn;
+    storeSpan span {exprStartPos, interpretedFileWriter.getWriteFilePos(), 0, 0, 0, varTkn.get_line_number()};
+    isRecorded = (OK == scopedNameSpace->add_top_store_span (varTkn._string, span));
+  }
+
+  if (!isRecorded)
+    markVarsRead_OLR (exprTree);
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+void GeneralParser::markVarsRead_OLR (std::shared_ptr<ExprTreeNode> currNode)  {
+  if (currNode != NULL)  {
+    if (currNode->originalTkn != NULL && currNode->originalTkn->tkn_type == USER_WORD_TKN)
+      scopedNameSpace->markVarRead (currNode->originalTkn->_string);
+
+    markVarsRead_OLR (currNode->_1stChild);
+    markVarsRead_OLR (currNode->_2ndChild);
+
+    for (auto param : currNode->parameter_list)
+      markVarsRead_OLR (param);
+  }
+}
+
+/* ****************************************************************************
+ * Variables with a value known at this point in the source get swapped for it,
+ * ahead of constant folding
+ * ***************************************************************************/
+int GeneralParser::propagateConstants (std::shared_ptr<ExprTreeNode> exprTree)  {
+  int ret_code = GENERAL_FAILURE;
+  std::vector<propagatedVar> propagated;
+
+  if (OK != constantPropagator.propagateConstants (exprTree, propagated))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    if (logLevel >= VERBOSE)  {
+      for (auto & swapped : propagated)
+        std::wcout << L"// OPTIMIZATION: Replaced [" << swapped.var_name << L"] on line " << swapped.line_num
+          << L" with its known value " << swapped.value_str << std::endl;
+    }
+    ret_code = OK;
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * Expression was just written out. Anything it wrote to has an unknown value
+ * now, unless it's a stand-alone [x = literal;] statement.
+ * ***************************************************************************/
+void GeneralParser::noteKnownValues (std::shared_ptr<ExprTreeNode> exprTree, bool isStandAloneStmt)  {
+  std::shared_ptr<ExprTreeNode> stmtNode = skipStatementEnder (exprTree);
+
+  if (isStandAloneStmt && stmtNode != NULL && stmtNode->originalTkn != NULL
+    && stmtNode->originalTkn->tkn_type == SRC_OPR8R_TKN
+    && usrSrcTerms.getOpCodeFor (stmtNode->originalTkn->_string) == ASSIGNMENT_OPR8R_OPCODE
+    && stmtNode->_1stChild != NULL && stmtNode->_1stChild->originalTkn->tkn_type == USER_WORD_TKN
+    && stmtNode->_2ndChild != NULL && stmtNode->_2ndChild->_1stChild == NULL && stmtNode->_2ndChild->_2ndChild == NULL)
+    // Nothing else gets written; the value the variable had going in might be needed to work out its new one
+    constantPropagator.noteStore (stmtNode->_1stChild->originalTkn->_string, stmtNode->_2ndChild, false);
+  else
+    constantPropagator.killWrittenVars (exprTree);
+}
+
+/* ****************************************************************************
+ * A loop's conditional and body run again after its body has, so nothing the
+ * loop writes to can be counted on to still have the value it had going in
+ * ***************************************************************************/
+int GeneralParser::forgetLoopWrittenVars ()  {
+  int ret_code = GENERAL_FAILURE;
+  std::set<std::wstring> writtenVars;
+
+  if (OK != loopInvariantHoister.getWrittenVars (writtenVars))  {
+    userMessages->logMsg (INTERNAL_ERROR, L"No loop open to get written variables from", thisSrcFile, __LINE__, 0);
+
+  } else  {
+    constantPropagator.killVars (writtenVars);
+    ret_code = OK;
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * Chains of [?] OPR8Rs that pick a value based on what an integer variable is
+ * equal to get turned into a single lookup table OPR8R
+ * ***************************************************************************/
+int GeneralParser::buildLookupTables (std::shared_ptr<ExprTreeNode> exprTree)  {
+  int ret_code = GENERAL_FAILURE;
+  std::vector<builtLookup> builtTables;
+
+  if (OK != ternaryLookupBuilder.buildLookupTables (exprTree, builtTables))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    if (logLevel >= VERBOSE)  {
+      for (auto & built : builtTables)
+        std::wcout << L"// OPTIMIZATION: Turned chain of " << built.num_arms << L" [?] OPR8Rs on line " << built.line_num
+          << L" into a lookup table" << std::endl;
+    }
+    ret_code = OK;
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * Chains of [+] OPR8Rs that glue STRINGs together get turned into a single
+ * OPR8R that sizes the result once
+ * ***************************************************************************/
+int GeneralParser::flattenConcats (std::shared_ptr<ExprTreeNode> exprTree)  {
+  int ret_code = GENERAL_FAILURE;
+  std::vector<flattenedConcat> flattened;
+
+  if (OK != concatFlattener.flattenConcats (exprTree, flattened))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    if (logLevel >= VERBOSE)  {
+      for (auto & joined : flattened)
+        std::wcout << L"// OPTIMIZATION: Joined " << joined.num_pieces << L" STRING pieces on line " << joined.line_num
+          << L" into 1 [" << CONCAT_N_OPR8R << L"]" << std::endl;
+    }
+    ret_code = OK;
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * [op_code][total_length][line #][column #]
+ * ***************************************************************************/
+int GeneralParser::writeBlockProfile (Token & openingTkn)  {
+  int ret_code = GENERAL_FAILURE;
+  uint32_t startFilePos = interpretedFileWriter.getWriteFilePos();
+
+  if (0 == interpretedFileWriter.writeFlexLenOpCode (BLOCK_PROFILE_OPCODE))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (OK != interpretedFileWriter.writeRawUnsigned (openingTkn.get_line_number(), NUM_BITS_IN_DWORD)
+    || OK != interpretedFileWriter.writeRawUnsigned (openingTkn.get_column_pos(), NUM_BITS_IN_DWORD))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    ret_code = interpretedFileWriter.writeObjectLen (startFilePos);
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * Remember where this block of the [if] chain starts, and whether it can trade
+ * places with the rest of the chain. Only chains of [x == key] conditionals on
+ * the same integer variable with different keys qualify: none of them have side
+ * effects and at most 1 of them can be TRUE, so checking them in a different
+ * order can't change which block runs. A trailing [else] stays put.
+ * ***************************************************************************/
+int GeneralParser::noteIfChainBlock (uint8_t op_code, uint8_t written_op_code, Token & openingTkn, uint32_t startFilePos
+  , bool isUnreachable, bool isCondStatic, std::shared_ptr<ExprTreeNode> condTree)  {
+  int ret_code = GENERAL_FAILURE;
+  ifChainBlock chainBlock {startFilePos, written_op_code, (uint32_t)openingTkn.get_line_number(), (uint32_t)openingTkn.get_column_pos()
+    , false, L"", 0};
+
+  if (op_code == IF_SCOPE_OPCODE && OK != scopedNameSpace->clear_top_if_chain_blocks())  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    if (isUnreachable || written_op_code != op_code)
+      // Chain got cut up by dead branch elimination; leave it alone
+      chainBlock.is_reorderable = false;
+    else if (op_code == ELSE_SCOPE_OPCODE)
+      chainBlock.is_reorderable = true;
+    else if (!isCondStatic)
+      chainBlock.is_reorderable
+        = ternaryLookupBuilder.isSelectorKeyCompare (skipStatementEnder (condTree), chainBlock.selector_name, chainBlock.key);
+
+    ret_code = scopedNameSpace->add_top_if_chain_block (chainBlock);
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * The [if] chain at the top scope has been written out in full. Order its
+ * [if] [else if] blocks by how many times each one ran in the profile, most
+ * runs 1st, and make whichever block ends up in front the [if]. Ties keep
+ * their source order. Not finding anything to reorder is not a failure.
+ * ***************************************************************************/
+int GeneralParser::reorderIfChain ()  {
+  int ret_code = GENERAL_FAILURE;
+  std::vector<ifChainBlock> chainBlocks;
+  std::vector<uint32_t> blockEndPositions;
+  std::vector<int> newOrder;
+  uint32_t chainEndPos;
+  int numCondBlocks = 0;
+  bool isReorderable = true;
+
+  if (OK != scopedNameSpace->get_top_if_chain_blocks (chainBlocks))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (chainBlocks.empty())  {
+    ret_code = OK;
+
+  } else if (OK != scopedNameSpace->clear_top_if_chain_blocks())  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    ret_code = OK;
+    chainEndPos = interpretedFileWriter.getWriteFilePos();
+
+    for (int idx = 0; idx < chainBlocks.size() && isReorderable; idx++)  {
+      ifChainBlock & currBlock = chainBlocks[idx];
+      blockEndPositions.push_back (idx + 1 < chainBlocks.size() ? chainBlocks[idx + 1].start_pos : chainEndPos);
+
+      if (!currBlock.is_reorderable)
+        isReorderable = false;
+
+      else if (currBlock.op_code != ELSE_SCOPE_OPCODE)  {
+        numCondBlocks++;
+        for (int prevIdx = 0; prevIdx < idx && isReorderable; prevIdx++)  {
+          if (chainBlocks[prevIdx].selector_name != currBlock.selector_name || chainBlocks[prevIdx].key == currBlock.key)
+            isReorderable = false;
+        }
+      }
+    }
+
+    if (isReorderable && numCondBlocks >= 2)  {
+      for (int idx = 0; idx < numCondBlocks; idx++)
+        newOrder.push_back (idx);
+
+      std::stable_sort (newOrder.begin(), newOrder.end(), [&] (int idx1, int idx2) {
+        return (blockProfile->getHitCount (chainBlocks[idx1].line_num, chainBlocks[idx1].col_pos)
+          > blockProfile->getHitCount (chainBlocks[idx2].line_num, chainBlocks[idx2].col_pos));
+      });
+
+      if (!std::is_sorted (newOrder.begin(), newOrder.end()))  {
+        uint32_t chainStartPos = chainBlocks[0].start_pos;
+        uint32_t nextBlockPos = chainStartPos;
+        std::string chainBytes, reorderedBytes;
+
+        ret_code = interpretedFileWriter.readBytes (chainStartPos, chainEndPos - chainStartPos, chainBytes);
+
+        for (int idx = 0; idx < newOrder.size() && OK == ret_code; idx++)  {
+          ifChainBlock & movedBlock = chainBlocks[newOrder[idx]];
+          reorderedBytes.append (chainBytes, movedBlock.start_pos - chainStartPos, blockEndPositions[newOrder[idx]] - movedBlock.start_pos);
+        }
+
+        if (OK == ret_code && numCondBlocks < chainBlocks.size())
+          // Trailing [else]
+          reorderedBytes.append (chainBytes, chainBlocks[numCondBlocks].start_pos - chainStartPos, std::string::npos);
+
+        if (OK == ret_code)
+          ret_code = interpretedFileWriter.truncateTo (chainStartPos);
+        if (OK == ret_code)
+          ret_code = interpretedFileWriter.writeRawBytes (reorderedBytes);
+
+        for (int idx = 0; idx < newOrder.size() && OK == ret_code; idx++)  {
+          int oldIdx = newOrder[idx];
+          ret_code = interpretedFileWriter.rewriteOpCode (nextBlockPos, idx == 0 ? IF_SCOPE_OPCODE : ELSE_IF_SCOPE_OPCODE);
+          nextBlockPos += blockEndPositions[oldIdx] - chainBlocks[oldIdx].start_pos;
+        }
+
+        if (OK != ret_code)  {
+          SET_FAILED_ON_SRC_LINE;
+
+        } else if (logLevel >= VERBOSE)  {
+          std::wcout << L"// OPTIMIZATION: Reordered [if] chain on line " << chainBlocks[0].line_num << L" by profiled runs:";
+          for (int idx = 0; idx < newOrder.size(); idx++)  {
+            ifChainBlock & movedBlock = chainBlocks[newOrder[idx]];
+            std::wcout << (idx == 0 ? L" " : L", ") << L"line " << movedBlock.line_num << L" ("
+              << blockProfile->getHitCount (movedBlock.line_num, movedBlock.col_pos) << L")";
+          }
+          std::wcout << std::endl;
+        }
+      }
+    }
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * Current scope is about to close, so nothing else can read the variables it
+ * declared. Cut the declarations and stores of the ones that never got read.
+ * Cuts go from the end of the file backwards so earlier positions stay good.
+ * ***************************************************************************/
+int GeneralParser::eliminateDeadStores ()  {
+  int ret_code = GENERAL_FAILURE;
+  std::vector<std::pair<std::wstring, storeSpan>> unreadStores;
+  bool isUnreachable;
+
+  if (OK != scopedNameSpace->get_top_is_unreachable (isUnreachable)) {
+    userMessages->logMsg (INTERNAL_ERROR, L"Could not check whether current scope is reachable", thisSrcFile, __LINE__, 0);
+
+  } else if (isUnreachable)  {
+    // Whole block is getting cut anyway
+    ret_code = OK;
+
+  } else if (OK != scopedNameSpace->get_top_unread_stores (unreadStores))  {
+    userMessages->logMsg (INTERNAL_ERROR, L"Could not retrieve unread variable stores", thisSrcFile, __LINE__, 0);
+
+  } else  {
+    // Drop the entire VARIABLES_DECLARATION object if none of the variables it declares get read
+    std::map<uint32_t, int> unreadDeclVarCnt;
+    for (auto & unread : unreadStores)  {
+      if (unread.second.decl_start_pos > 0)
+        unreadDeclVarCnt[unread.second.decl_start_pos]++;
+    }
+
+    // Start position -> [end position, position of the object that needs its length adjusted, or 0]
+    std::map<uint32_t, std::pair<uint32_t, uint32_t>> cuts;
+    for (auto & unread : unreadStores)  {
+      storeSpan & span = unread.second;
+
+      if (span.decl_start_pos > 0 && unreadDeclVarCnt[span.decl_start_pos] == span.num_decl_vars)
+        cuts[span.decl_start_pos] = {span.decl_end_pos, 0};
+      else
+        cuts[span.start_pos] = {span.end_pos, span.decl_start_pos};
+
+      if (logLevel >= VERBOSE)  {
+        if (span.decl_start_pos > 0)
+          std::wcout << L"// OPTIMIZATION: Removed unused variable [" << unread.first << L"] declared on line " << span.line_num << std::endl;
+        else
+          std::wcout << L"// OPTIMIZATION: Removed dead store to [" << unread.first << L"] on line " << span.line_num << std::endl;
+      }
+    }
+
+    ret_code = OK;
+    for (auto cut = cuts.rbegin(); cut != cuts.rend() && OK == ret_code; cut++) {
+      ret_code = interpretedFileWriter.cutRange (cut->first, cut->second.first);
+      if (OK == ret_code && cut->second.second > 0)
+        ret_code = interpretedFileWriter.adjustObjectLen (cut->second.second, -(int32_t)(cut->second.first - cut->first));
+    }
+
+    if (OK != ret_code)
+      userMessages->logMsg (INTERNAL_ERROR, L"Failed removing unused variables from interpreted file", thisSrcFile, __LINE__, 0);
+  }
+
+  return ret_code;
+}
@@ -25,7 +25,15 @@
 #include "ScopeWindow.h"
 #include "ExpressionParser.h"
 #include "InfoWarnError.h"
-#include "RunTimeInterpreter.h"
+#include "TypeChecker.h"
+#include "ConstantPropagator.h"
+#include "ConstantFolder.h"
+#include "AlgebraicSimplifier.h"
+#include "LoopInvariantHoister.h"
+#include "CommonSubExprEliminator.h"
+#include "TernaryLookupBuilder.h"
+#include "ConcatFlattener.h"
+#include "BlockProfile.h"
 #include "StackOfScopes.h"
 #include "UserMessages.h"
 
@@ -35,6 +43,12 @@
 #define FOR_CONDITIONAL_IDX   1
 #define FOR_ITER_IDX          2
 
+// [for] loops with a trip count known at compile time get unrolled
+#define DEFAULT_MAX_UNROLL_TRIPS  8       // Fully unrolled up to this many trips; 0 turns unrolling off
+#define DEFAULT_UNROLL_FACTOR     4       // Longer loops get this many trips per unrolled block, plus a remainder
+#define MAX_UNROLL_SETTING        64
+#define MAX_UNROLLED_LOOP_BYTES   2048    // Cap on how big the unrolled trips are allowed to get
+
 enum var_declaration_states_enum {
   GET_VAR_NAME
   ,CHECK_FOR_INIT_EXPR
@@ -46,9 +60,10 @@ typedef var_declaration_states_enum varDeclarationState;
 
 class GeneralParser {
 public:
-  GeneralParser(TokenPtrVector & inTknStream, std::wstring userSrcFileName, CompileExecTerms & inUsrSrcTerms
+  GeneralParser(TokenPtrVector & inTknStream, std::wstring userSrcFileName, const CompileExecTerms & inUsrSrcTerms
       , std::shared_ptr<UserMessages> userMessages, std::string object_file_name, std::shared_ptr<StackOfScopes> inVarNameSpace
-      , logLvlEnum logLvl);
+      , logLvlEnum logLvl, exprParserEnum exprParserType, optimizeLvlEnum optimizeLvl, int maxUnrollTrips, int unrollFactor
+      , std::shared_ptr<BlockProfile> blockProfile);
   virtual ~GeneralParser();
   int compileRootScope();
   int compileCurrScope ();
@@ -59,11 +74,18 @@ private:
   TokenPtrVector tkn_stream;
   std::wstring userSrcFileName;
   std::wstring thisSrcFile;
-  CompileExecTerms usrSrcTerms;
+  const CompileExecTerms & usrSrcTerms;
   Utilities util;
   std::ofstream interpretedFile;
   InterpretedFileWriter interpretedFileWriter;
-  RunTimeInterpreter interpreter;
+  TypeChecker typeChecker;
+  ConstantPropagator constantPropagator;
+  ConstantFolder constantFolder;
+  AlgebraicSimplifier algebraicSimplifier;
+  LoopInvariantHoister loopInvariantHoister;
+  CommonSubExprEliminator commonSubExprEliminator;
+  TernaryLookupBuilder ternaryLookupBuilder;
+  ConcatFlattener concatFlattener;
   ExpressionParser exprParser;
   std::shared_ptr<StackOfScopes> scopedNameSpace;
   Token scratchTkn;
@@ -72,23 +94,52 @@ private:
   std::vector<std::wstring> ender_list;
   std::vector<std::wstring> ender_and_comma_list;
   logLvlEnum logLevel;
+  optimizeLvlEnum optimizeLevel;
+  int maxUnrollTrips;
+  int unrollFactor;
+  std::shared_ptr<BlockProfile> blockProfile;                   // NULL unless profiling
   int failed_on_src_line;
 
 
   int parseVarDeclaration (std::wstring dataTypeStr, std::pair<TokenTypeEnum, uint8_t> tknType_opCode, bool & isDeclarationEnded
     , int & numVarsAdded, int & numInitExpressions);
   int resolveVarInitExpr (Token & varTkn, Token currTkn, Token & exprCloser, bool & isDeclarationEnded);
+  int parseArraySize (Token & arrayNameTkn, uint64_t & numElements);
   bool isProgressBlocked ();
   int chompUntil_infoMsgAfter (std::vector<std::wstring> searchStrings, Token & closerTkn);
   int compile_if_type_block (uint8_t op_code, Token & openingTkn, bool & isClosedByCurly);
   int handleExpression (bool & isStopFail, bool & is_expr_static, expr_ender_type expr_ended_by);
+  int handleExpression (bool & isStopFail, bool & is_expr_static, expr_ender_type expr_ended_by, bool isStandAloneStmt
+    , std::shared_ptr<ExprTreeNode> & exprTree);
   int compile_break (Token break_tkn);
   int openFloatyScope (Token openScopeTkn);
   int compile_for_loop_control (Token & openingTkn);
-  int compile_for_loop_ctrl_expr (int exprIdx, bool & is_expr_full, bool & is_expr_static);
+  int compile_for_loop_ctrl_expr (int exprIdx, bool & is_expr_full, bool & is_expr_static, std::shared_ptr<ExprTreeNode> & exprTree);
   int validate_closed_for_loop();
   int compile_while_loop_control (Token & openingTkn);
+  int finishClosedLoop (uint8_t closedScopeOpCode);
+  int writeLoopPreHeader (loopContext & closedLoop);
+  int unrollForLoop (loopContext & closedLoop);
+  void peekForLoopInit (std::wstring & initVarName, Token & initValTkn);
+  int markCountedForLoop (Token & openingTkn, uint32_t loopStartPos, std::wstring initVarName, Token & initValTkn
+    , std::shared_ptr<ExprTreeNode> condTree, std::shared_ptr<ExprTreeNode> lastTree);
   int compile_lone_system_call (Token & sys_call_tkn);
+  bool isStaticCondition (std::shared_ptr<ExprTreeNode> condTree, bool & isCondTrue);
+  bool isStoreTrackedScope ();
+  bool isRemovableStore (std::wstring varName, std::shared_ptr<ExprTreeNode> valueNode);
+  std::shared_ptr<ExprTreeNode> skipStatementEnder (std::shared_ptr<ExprTreeNode> exprTree);
+  void trackVarUsage (std::shared_ptr<ExprTreeNode> exprTree, bool isStandAloneStmt, uint32_t exprStartPos);
+  void markVarsRead_OLR (std::shared_ptr<ExprTreeNode> currNode);
+  int propagateConstants (std::shared_ptr<ExprTreeNode> exprTree);
+  void noteKnownValues (std::shared_ptr<ExprTreeNode> exprTree, bool isStandAloneStmt);
+  int forgetLoopWrittenVars ();
+  int buildLookupTables (std::shared_ptr<ExprTreeNode> exprTree);
+  int flattenConcats (std::shared_ptr<ExprTreeNode> exprTree);
+  int writeBlockProfile (Token & openingTkn);
+  int noteIfChainBlock (uint8_t op_code, uint8_t written_op_code, Token & openingTkn, uint32_t startFilePos, bool isUnreachable
+    , bool isCondStatic, std::shared_ptr<ExprTreeNode> condTree);
+  int reorderIfChain ();
+  int eliminateDeadStores ();
 
 };
 
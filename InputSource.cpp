@@ -0,0 +1,244 @@
+/*
+ * InputSource.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ *
+ * A file the user's program reads from.  The file gets pulled in by file
+ * descriptor a large buffer at a time, so a multi-GB file streams through in a
+ * single pass without ever being held in memory all at once.  Lines get found
+ * with memchr and decoded from UTF-8 in one go; anything that isn't valid
+ * UTF-8 becomes U+FFFD, the same as OutputSink does going the other way.
+ */
+
+#include "InputSource.h"
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include "common.h"
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+InputSource::InputSource(std::string inFileName) {
+  file_name = inFileName;
+  is_file_end = false;
+  buffer_pos = 0;
+  buffer_end = 0;
+
+  file_desc = open (file_name.c_str(), O_RDONLY);
+  is_failed = (file_desc < 0);
+
+  if (!is_failed)  {
+    // Let the kernel read ahead more aggressively; nothing gets read twice
+    posix_fadvise (file_desc, 0, 0, POSIX_FADV_SEQUENTIAL);
+    buffer.resize (INPUT_SOURCE_BUFFER_SIZE);
+  }
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+InputSource::~InputSource() {
+  if (file_desc >= 0)
+    close (file_desc);
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+bool InputSource::isOpen ()  {
+  return (!is_failed);
+}
+
+/* ****************************************************************************
+ * True once there's nothing left to read, so a loop can check before reading
+ * rather than after getting back an empty line
+ * ***************************************************************************/
+bool InputSource::isEof ()  {
+  if (!is_failed && buffer_pos == buffer_end && !is_file_end)
+    fillBuffer();
+
+  return (is_failed || buffer_pos == buffer_end);
+}
+
+/* ****************************************************************************
+ * Next line, without its "\n" or "\r\n".  Past the end of the file textLine
+ * comes back empty.
+ * ***************************************************************************/
+int InputSource::readLine (std::wstring & textLine)  {
+  int ret_code = GENERAL_FAILURE;
+  const char * line_end = NULL;
+  size_t scanned_to = buffer_pos;
+
+  textLine.clear();
+
+  while (!is_failed && line_end == NULL)  {
+    line_end = (const char *) memchr (buffer.data() + scanned_to, '\n', buffer_end - scanned_to);
+
+    if (line_end == NULL)  {
+      if (is_file_end)
+        break;
+
+      // Line runs past what's buffered; pull in more and only scan the new part
+      size_t scanned_len = buffer_end - buffer_pos;
+      if (OK != fillBuffer())
+        break;
+      scanned_to = buffer_pos + scanned_len;
+    }
+  }
+
+  if (!is_failed)  {
+    size_t line_len = (line_end == NULL ? buffer_end : line_end - buffer.data()) - buffer_pos;
+    size_t consumed_len = line_len + (line_end == NULL ? 0 : 1);
+
+    if (line_len > 0 && buffer[buffer_pos + line_len - 1] == '\r')
+      line_len--;
+
+    appendDecoded (buffer.data() + buffer_pos, line_len, textLine);
+    buffer_pos += consumed_len;
+    ret_code = OK;
+  }
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ * Up to maxChars characters, line breaks and all.  Fewer come back only at the
+ * end of the file.
+ * ***************************************************************************/
+int InputSource::readChunk (size_t maxChars, std::wstring & textChunk)  {
+  int ret_code = GENERAL_FAILURE;
+  size_t num_chars = 0;
+
+  textChunk.clear();
+  textChunk.reserve (maxChars < INPUT_SOURCE_BUFFER_SIZE ? maxChars : INPUT_SOURCE_BUFFER_SIZE);
+
+  while (!is_failed && num_chars < maxChars)  {
+    // Make sure a character split across 2 reads gets decoded whole
+    if (buffer_end - buffer_pos < 4 && !is_file_end && OK != fillBuffer())
+      break;
+
+    if (buffer_pos == buffer_end)
+      break;
+
+    wchar_t wideChar;
+    buffer_pos += decodeUtf8Char (buffer.data() + buffer_pos, buffer_end - buffer_pos, wideChar);
+    textChunk.push_back (wideChar);
+    num_chars++;
+  }
+
+  if (!is_failed)
+    ret_code = OK;
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ * Slide whatever hasn't been read yet to the front and read in behind it.  The
+ * buffer only grows when a single line won't fit in it.
+ * ***************************************************************************/
+int InputSource::fillBuffer ()  {
+  int ret_code = GENERAL_FAILURE;
+
+  if (buffer_pos > 0)  {
+    memmove (buffer.data(), buffer.data() + buffer_pos, buffer_end - buffer_pos);
+    buffer_end -= buffer_pos;
+    buffer_pos = 0;
+  }
+
+  if (buffer_end == buffer.size())
+    buffer.resize (buffer.size() * 2);
+
+  ssize_t read_cnt;
+  do  {
+    read_cnt = read (file_desc, buffer.data() + buffer_end, buffer.size() - buffer_end);
+  } while (read_cnt < 0 && errno == EINTR);
+
+  if (read_cnt > 0)  {
+    buffer_end += read_cnt;
+    ret_code = OK;
+
+  } else if (read_cnt == 0)  {
+    is_file_end = true;
+    ret_code = OK;
+
+  } else  {
+    is_failed = true;
+  }
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ * Returns how many bytes wideChar took up; always at least 1, so a bad byte
+ * can't stall the caller
+ * ***************************************************************************/
+size_t InputSource::decodeUtf8Char (const char * utf8, size_t num_avail, wchar_t & wideChar)  {
+  uint8_t lead_byte = (uint8_t) utf8[0];
+  uint32_t codePoint;
+  size_t num_bytes;
+
+  if (lead_byte < 0x80)  {
+    codePoint = lead_byte;
+    num_bytes = 1;
+  } else if ((lead_byte & 0xE0) == 0xC0)  {
+    codePoint = lead_byte & 0x1F;
+    num_bytes = 2;
+  } else if ((lead_byte & 0xF0) == 0xE0)  {
+    codePoint = lead_byte & 0x0F;
+    num_bytes = 3;
+  } else if ((lead_byte & 0xF8) == 0xF0)  {
+    codePoint = lead_byte & 0x07;
+    num_bytes = 4;
+  } else  {
+    codePoint = 0xFFFD;
+    num_bytes = 1;
+  }
+
+  if (num_bytes > num_avail)  {
+    codePoint = 0xFFFD;
+    num_bytes = 1;
+  }
+
+  for (size_t idx = 1; idx < num_bytes; idx++)  {
+    uint8_t cont_byte = (uint8_t) utf8[idx];
+
+    if ((cont_byte & 0xC0) != 0x80)  {
+      // Don't swallow what might be the start of the next character
+      codePoint = 0xFFFD;
+      num_bytes = idx;
+      break;
+    }
+    codePoint = (codePoint << 6) | (cont_byte & 0x3F);
+  }
+
+  if (codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+    codePoint = 0xFFFD;
+
+  wideChar = (wchar_t) codePoint;
+  return (num_bytes);
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+void InputSource::appendDecoded (const char * utf8, size_t num_bytes, std::wstring & text)  {
+  size_t idx = 0;
+
+  text.reserve (text.length() + num_bytes);
+
+  while (idx < num_bytes)  {
+    if ((uint8_t) utf8[idx] < 0x80)  {
+      text.push_back ((wchar_t) utf8[idx]);
+      idx++;
+
+    } else  {
+      wchar_t wideChar;
+      idx += decodeUtf8Char (utf8 + idx, num_bytes - idx, wideChar);
+      text.push_back (wideChar);
+    }
+  }
+}
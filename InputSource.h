@@ -0,0 +1,41 @@
+/*
+ * InputSource.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ */
+
+#ifndef INPUTSOURCE_H_
+#define INPUTSOURCE_H_
+
+#include <string>
+#include <vector>
+
+#define INPUT_SOURCE_BUFFER_SIZE  0x100000
+
+class InputSource {
+public:
+  InputSource(std::string inFileName);
+  virtual ~InputSource();
+
+  bool isOpen ();
+  bool isEof ();
+  int readLine (std::wstring & textLine);
+  int readChunk (size_t maxChars, std::wstring & textChunk);
+
+private:
+  std::string file_name;
+  int file_desc;
+  bool is_failed;
+  // read() came back with nothing; whatever's left in buffer is all there is
+  bool is_file_end;
+  std::vector<char> buffer;
+  size_t buffer_pos;
+  size_t buffer_end;
+
+  int fillBuffer ();
+  size_t decodeUtf8Char (const char * utf8, size_t num_avail, wchar_t & wideChar);
+  void appendDecoded (const char * utf8, size_t num_bytes, std::wstring & text);
+};
+
+#endif /* INPUTSOURCE_H_ */
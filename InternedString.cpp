@@ -0,0 +1,199 @@
+/*
+ * InternedString.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ *
+ * Immutable, reference counted string that a Token holds its text in.  Copying
+ * a Token only copies a pointer and bumps a count, rather than allocating and
+ * copying every character.  The hash and length are worked out once, when the
+ * characters are.
+ *
+ * Strings read out of the interpreted file (literals and variable names) get
+ * interned, so the same text always shares the same rep.  2 interned strings
+ * are equal only if they share a rep, which is a pointer compare.  Anything
+ * else falls back on the length, then the hash, then the characters.
+ */
+
+#include "InternedString.h"
+#include <unordered_map>
+
+// Everything interned lives for the rest of the run; a program only has so many literals & names
+static std::unordered_map<std::wstring, std::shared_ptr<const stringRep>> internedReps;
+
+static const std::wstring emptyText;
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+InternedString::InternedString()  {
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+InternedString::InternedString(const std::wstring & inText)
+  : strRep (makeRep (inText, false))  {
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+InternedString::InternedString(const wchar_t * inText)
+  : strRep (makeRep (inText, false))  {
+}
+
+/* ****************************************************************************
+ * Takes over inText's characters rather than copying them
+ * ***************************************************************************/
+InternedString::InternedString(std::wstring && inText)
+  : strRep (makeRep (std::move (inText)))  {
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+InternedString& InternedString::operator= (const std::wstring & inText)  {
+  strRep = makeRep (inText, false);
+  return (*this);
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+InternedString& InternedString::operator= (const wchar_t * inText)  {
+  strRep = makeRep (inText, false);
+  return (*this);
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+InternedString& InternedString::operator= (std::wstring && inText)  {
+  strRep = makeRep (std::move (inText));
+  return (*this);
+}
+
+/* ****************************************************************************
+ * Hand back the rep already holding inText, or make it the one
+ * ***************************************************************************/
+InternedString InternedString::intern (const std::wstring & inText)  {
+  InternedString interned;
+
+  if (!inText.empty())  {
+    auto mapItr = internedReps.find (inText);
+
+    if (mapItr != internedReps.end())  {
+      interned.strRep = mapItr->second;
+
+    } else  {
+      interned.strRep = makeRep (inText, true);
+      internedReps.emplace (inText, interned.strRep);
+    }
+  }
+
+  return (interned);
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+std::shared_ptr<const stringRep> InternedString::makeRep (const std::wstring & inText, bool isInterned)  {
+  std::shared_ptr<const stringRep> newRep;
+
+  if (!inText.empty())
+    newRep = std::make_shared<const stringRep> (stringRep {inText, std::hash<std::wstring>{} (inText), isInterned});
+
+  return (newRep);
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+std::shared_ptr<const stringRep> InternedString::makeRep (std::wstring && inText)  {
+  std::shared_ptr<const stringRep> newRep;
+
+  if (!inText.empty())  {
+    size_t textHash = std::hash<std::wstring>{} (inText);
+    newRep = std::make_shared<const stringRep> (stringRep {std::move (inText), textHash, false});
+  }
+
+  return (newRep);
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+const std::wstring & InternedString::str () const  {
+  return (strRep == NULL ? emptyText : strRep->text);
+}
+
+/* ****************************************************************************
+ * Same hash std::hash<std::wstring> would give
+ * ***************************************************************************/
+size_t InternedString::hash () const  {
+  static const size_t emptyHash = std::hash<std::wstring>{} (emptyText);
+  return (strRep == NULL ? emptyHash : strRep->hash);
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+InternedString& InternedString::append (const std::wstring & moreText)  {
+  if (!moreText.empty())
+    strRep = makeRep (str() + moreText);
+
+  return (*this);
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+void InternedString::erase (size_t startPos, size_t numChars)  {
+  std::wstring erased = str();
+  erased.erase (startPos, numChars);
+  strRep = makeRep (std::move (erased));
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+bool operator== (const InternedString & str1, const InternedString & str2)  {
+  bool isEqual;
+
+  if (str1.strRep == str2.strRep)
+    isEqual = true;
+  else if (str1.strRep == NULL || str2.strRep == NULL || (str1.strRep->isInterned && str2.strRep->isInterned))
+    isEqual = false;
+  else if (str1.strRep->hash != str2.strRep->hash)
+    isEqual = false;
+  else
+    isEqual = (str1.strRep->text == str2.strRep->text);
+
+  return (isEqual);
+}
+
+bool operator== (const InternedString & str1, const std::wstring & str2)  { return (str1.str() == str2); }
+bool operator== (const std::wstring & str1, const InternedString & str2)  { return (str1 == str2.str()); }
+bool operator== (const InternedString & str1, const wchar_t * str2)  { return (str1.str() == str2); }
+bool operator== (const wchar_t * str1, const InternedString & str2)  { return (str1 == str2.str()); }
+bool operator!= (const InternedString & str1, const InternedString & str2)  { return !(str1 == str2); }
+bool operator!= (const InternedString & str1, const std::wstring & str2)  { return !(str1.str() == str2); }
+bool operator!= (const std::wstring & str1, const InternedString & str2)  { return !(str1 == str2.str()); }
+bool operator!= (const InternedString & str1, const wchar_t * str2)  { return !(str1.str() == str2); }
+bool operator!= (const wchar_t * str1, const InternedString & str2)  { return !(str1 == str2.str()); }
+bool operator< (const InternedString & str1, const InternedString & str2)  { return (str1.str() < str2.str()); }
+bool operator<= (const InternedString & str1, const InternedString & str2)  { return (str1.str() <= str2.str()); }
+bool operator> (const InternedString & str1, const InternedString & str2)  { return (str1.str() > str2.str()); }
+bool operator>= (const InternedString & str1, const InternedString & str2)  { return (str1.str() >= str2.str()); }
+
+std::wstring operator+ (const InternedString & str1, const InternedString & str2)  { return (str1.str() + str2.str()); }
+std::wstring operator+ (const InternedString & str1, const std::wstring & str2)  { return (str1.str() + str2); }
+std::wstring operator+ (const std::wstring & str1, const InternedString & str2)  { return (str1 + str2.str()); }
+std::wstring operator+ (const InternedString & str1, const wchar_t * str2)  { return (str1.str() + str2); }
+std::wstring operator+ (const wchar_t * str1, const InternedString & str2)  { return (str1 + str2.str()); }
+std::wstring operator+ (const InternedString & str1, wchar_t str2)  { return (str1.str() + str2); }
+
+std::wostream & operator<< (std::wostream & outStream, const InternedString & str)  {
+  return (outStream << str.str());
+}
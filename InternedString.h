@@ -0,0 +1,90 @@
+/*
+ * InternedString.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ */
+
+#ifndef INTERNEDSTRING_H_
+#define INTERNEDSTRING_H_
+
+#include <string>
+#include <memory>
+#include <ostream>
+
+// Characters never change once a rep is built; everything that "changes" an
+// InternedString points it at a new rep instead
+struct string_rep_struct {
+  std::wstring text;
+  size_t hash;
+  bool isInterned;
+};
+
+typedef string_rep_struct stringRep;
+
+class InternedString {
+public:
+  InternedString();
+  InternedString(const std::wstring & inText);
+  InternedString(const wchar_t * inText);
+  InternedString(std::wstring && inText);
+  InternedString& operator= (const std::wstring & inText);
+  InternedString& operator= (std::wstring && inText);
+  InternedString& operator= (const wchar_t * inText);
+
+  static InternedString intern (const std::wstring & inText);
+
+  operator const std::wstring & () const  { return str(); }
+  const std::wstring & str () const;
+  const wchar_t * c_str () const          { return str().c_str(); }
+  size_t length () const                  { return (strRep == NULL ? 0 : strRep->text.length()); }
+  size_t size () const                    { return length(); }
+  bool empty () const                     { return (strRep == NULL); }
+  size_t hash () const;
+  bool isInterned () const                { return (strRep != NULL && strRep->isInterned); }
+  bool isSameRep (const InternedString & other) const  { return (strRep == other.strRep); }
+
+  void clear ()                           { strRep.reset(); }
+  InternedString& append (const std::wstring & moreText);
+  InternedString& operator+= (const std::wstring & moreText)  { return append (moreText); }
+  void erase (size_t startPos, size_t numChars);
+  int compare (const std::wstring & otherText) const  { return str().compare (otherText); }
+  std::wstring::const_iterator begin () const         { return str().begin(); }
+  std::wstring::const_iterator end () const           { return str().end(); }
+  std::wstring::const_iterator cbegin () const        { return str().cbegin(); }
+  std::wstring::const_iterator cend () const          { return str().cend(); }
+
+  friend bool operator== (const InternedString & str1, const InternedString & str2);
+
+private:
+  std::shared_ptr<const stringRep> strRep;                      // NULL for an empty string
+
+  static std::shared_ptr<const stringRep> makeRep (const std::wstring & inText, bool isInterned);
+  static std::shared_ptr<const stringRep> makeRep (std::wstring && inText);
+};
+
+bool operator== (const InternedString & str1, const InternedString & str2);
+bool operator== (const InternedString & str1, const std::wstring & str2);
+bool operator== (const std::wstring & str1, const InternedString & str2);
+bool operator== (const InternedString & str1, const wchar_t * str2);
+bool operator== (const wchar_t * str1, const InternedString & str2);
+bool operator!= (const InternedString & str1, const InternedString & str2);
+bool operator!= (const InternedString & str1, const std::wstring & str2);
+bool operator!= (const std::wstring & str1, const InternedString & str2);
+bool operator!= (const InternedString & str1, const wchar_t * str2);
+bool operator!= (const wchar_t * str1, const InternedString & str2);
+bool operator< (const InternedString & str1, const InternedString & str2);
+bool operator<= (const InternedString & str1, const InternedString & str2);
+bool operator> (const InternedString & str1, const InternedString & str2);
+bool operator>= (const InternedString & str1, const InternedString & str2);
+
+std::wstring operator+ (const InternedString & str1, const InternedString & str2);
+std::wstring operator+ (const InternedString & str1, const std::wstring & str2);
+std::wstring operator+ (const std::wstring & str1, const InternedString & str2);
+std::wstring operator+ (const InternedString & str1, const wchar_t * str2);
+std::wstring operator+ (const wchar_t * str1, const InternedString & str2);
+std::wstring operator+ (const InternedString & str1, wchar_t str2);
+
+std::wostream & operator<< (std::wostream & outStream, const InternedString & str);
+
+#endif /* INTERNEDSTRING_H_ */
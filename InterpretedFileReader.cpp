@@ -25,7 +25,7 @@ InterpretedFileReader::InterpretedFileReader() {
 /* ****************************************************************************
  *
  * ***************************************************************************/
-InterpretedFileReader::InterpretedFileReader(std::string input_file_name, CompileExecTerms & inExecTerms)
+InterpretedFileReader::InterpretedFileReader(std::string input_file_name, const CompileExecTerms & inExecTerms)
   : inputStream (input_file_name, inputStream.binary | inputStream.in) {
   execTerms = & inExecTerms;
   thisSrcFile = util.getLastSegment(util.stringToWstring(__FILE__), L"/");
@@ -206,6 +206,7 @@ int InterpretedFileReader::readFixedRange (uint8_t op_code, Token & nxtTkn) {
   uint16_t word;
   uint32_t dword;
   uint64_t qword;
+  const systemCall * sys_call;
   bool isFailed = false;
 
   switch (op_code)  {
@@ -217,6 +218,25 @@ int InterpretedFileReader::readFixedRange (uint8_t op_code, Token & nxtTkn) {
       }
       break;
 
+    case TEMP_SLOT_OPCODE:
+      // [op_code][8-bit temp slot #]
+      if (OK == readNextByte (byte))  {
+        nxtTkn.tkn_type = TEMP_SLOT_TKN;
+        nxtTkn._unsigned = byte;
+      }
+      break;
+
+    case SYSTEM_CALL_ID_OPCODE:
+      // [op_code][8-bit system call ID]; name tags along for display purposes
+      if (OK != readNextByte (byte) || (sys_call = execTerms->get_system_call (byte)) == NULL)  {
+        isFailed = true;
+      } else  {
+        nxtTkn.tkn_type = SYSTEM_CALL_TKN;
+        nxtTkn._unsigned = byte;
+        nxtTkn._string = sys_call->name;
+      }
+      break;
+
     case UINT8_OPCODE:
       // [op_code][8-bit #]
       if (OK == readNextByte (byte))  {
@@ -226,10 +246,10 @@ int InterpretedFileReader::readFixedRange (uint8_t op_code, Token & nxtTkn) {
       break;
     case INT8_OPCODE:
       // [op_code][8-bit #]
-      // TODO: Any conversion for signed INTs?
+      // Sign extend; folded constants can be negative
       if (OK == readNextByte (byte))  {
         nxtTkn.tkn_type = INT8_TKN;
-        nxtTkn._signed = byte;
+        nxtTkn._signed = (int8_t) byte;
       }
       break;
     case UINT16_OPCODE:
@@ -241,10 +261,17 @@ int InterpretedFileReader::readFixedRange (uint8_t op_code, Token & nxtTkn) {
       break;
     case INT16_OPCODE:
       // [op_code][16-bit #]
-      // TODO: Any conversion for signed INTs?
+      // Sign extend; folded constants can be negative
       if (OK == readNextWord (word))  {
         nxtTkn.tkn_type = INT16_TKN;
-        nxtTkn._signed = word;
+        nxtTkn._signed = (int16_t) word;
+      }
+      break;
+    case INVARIANT_SLOT_OPCODE:
+      // [op_code][16-bit invariant slot #]
+      if (OK == readNextWord (word))  {
+        nxtTkn.tkn_type = INVARIANT_SLOT_TKN;
+        nxtTkn._unsigned = word;
       }
       break;
     case UINT32_OPCODE:
@@ -256,10 +283,10 @@ int InterpretedFileReader::readFixedRange (uint8_t op_code, Token & nxtTkn) {
       break;
     case INT32_OPCODE:
       // [op_code][32-bit #]
-      // TODO: Any conversion for signed INTs?
+      // Sign extend; folded constants can be negative
       if (OK == readNextDword (dword))  {
         nxtTkn.tkn_type = INT32_TKN;
-        nxtTkn._signed = dword;
+        nxtTkn._signed = (int32_t) dword;
       }
       break;
     case UINT64_OPCODE:
@@ -271,10 +298,10 @@ int InterpretedFileReader::readFixedRange (uint8_t op_code, Token & nxtTkn) {
       break;
     case INT64_OPCODE:
       // [op_code][64-bit #]
-      // TODO: Any conversion for signed INTs?
+      // Sign extend; folded constants can be negative
       if (OK == readNextQword (qword))  {
         nxtTkn.tkn_type = INT64_TKN;
-        nxtTkn._signed = qword;
+        nxtTkn._signed = (int64_t) qword;
       }
       break;
     default:
@@ -339,7 +366,13 @@ int InterpretedFileReader::readString (uint8_t op_code, Token & nxtTkn) {
             nxtTkn.tkn_type = DOUBLE_TKN;
             break;
           case SYSTEM_CALL_OPCODE:
+            // Older files name the system call rather than give its ID
+            uint8_t sys_call_id;
             nxtTkn.tkn_type = SYSTEM_CALL_TKN;
+            if (OK != execTerms->get_system_call_id (tknStr, sys_call_id))
+              isFailed = true;
+            else
+              nxtTkn._unsigned = sys_call_id;
             break;
           default:
             isFailed = true;
@@ -348,7 +381,8 @@ int InterpretedFileReader::readString (uint8_t op_code, Token & nxtTkn) {
 
         if (!isFailed)  {
           // TODO: Allowing empty strings
-          nxtTkn._string = tknStr;
+          // Same literal or name read again points at the same rep
+          nxtTkn._string = InternedString::intern (tknStr);
           nxtTkn.isInitialized = true;
           ret_code = OK;
         }
@@ -360,12 +394,26 @@ int InterpretedFileReader::readString (uint8_t op_code, Token & nxtTkn) {
 }
 
 
+/* ****************************************************************************
+ * Everywhere but a declaration, an array goes by its name alone
+ * ***************************************************************************/
+ int InterpretedFileReader::readUserVar (Token & nxtTkn)  {
+  int ret_code = GENERAL_FAILURE;
+  uint64_t num_elements;
+
+  if (OK == readUserVar (nxtTkn, num_elements) && num_elements == 0)
+    ret_code = OK;
+
+  return (ret_code);
+}
+
 /* ****************************************************************************
  * TODO: Check for EOF!
  * USER_VAR_OPCODE  0x61  [op_code][total_length][STRING_OPCODE string] for scalar variable
  *                        [op_code][total_length][STRING_OPCODE string][string|integer]+ for array variable
+ * num_elements comes back 0 for a scalar variable
  * ***************************************************************************/
- int InterpretedFileReader::readUserVar (Token & nxtTkn)  {
+ int InterpretedFileReader::readUserVar (Token & nxtTkn, uint64_t & num_elements)  {
   int ret_code = GENERAL_FAILURE;
   uint32_t user_var_obj_len;
   bool isFailed = false;
@@ -376,6 +424,7 @@ int InterpretedFileReader::readString (uint8_t op_code, Token & nxtTkn) {
 
   tknStr.clear();
   nxtTkn.resetToken();
+  num_elements = 0;
 
   if (inputStream.is_open())  {
     uint32_t initPos = inputStream.tellg();
@@ -394,13 +443,19 @@ int InterpretedFileReader::readString (uint8_t op_code, Token & nxtTkn) {
     
     } else  {
       uint32_t curr_pos = inputStream.tellg();
-      if (curr_pos == initPos - OPCODE_NUM_BYTES + user_var_obj_len)  {
-        // Scalar variable; not an array -> [op_code][total_length][STRING_OPCODE string]
-        nxtTkn._string = var_name_tkn._string;
-        nxtTkn.tkn_type = USER_WORD_TKN;
-      } else {
-        // Handle the array case -> [op_code][total_length][STRING_OPCODE string][string|integer]+
-        isFailed = true; 
+      uint32_t end_pos = initPos - OPCODE_NUM_BYTES + user_var_obj_len;
+      nxtTkn._string = var_name_tkn._string;
+      nxtTkn.tkn_type = USER_WORD_TKN;
+
+      if (curr_pos != end_pos)  {
+        // Array -> [op_code][total_length][STRING_OPCODE string][integer]; 1 dimension, so just its # of elements
+        Token num_elements_tkn;
+
+        if (OK != readNextByte (op_code) || OK != readFixedRange (op_code, num_elements_tkn) || !num_elements_tkn.isUnsigned()
+          || num_elements_tkn._unsigned == 0 || end_pos != (uint32_t) inputStream.tellg())
+          isFailed = true;
+        else
+          num_elements = num_elements_tkn._unsigned;
       }
 
       if (!isFailed)
@@ -25,7 +25,7 @@
 class InterpretedFileReader {
 public:
   InterpretedFileReader ();
-  InterpretedFileReader(std::string input_file_name, CompileExecTerms & inExecTerms);
+  InterpretedFileReader(std::string input_file_name, const CompileExecTerms & inExecTerms);
   virtual ~InterpretedFileReader();
   int readExprIntoList (std::vector<Token> & exprTknStream);
   int readNextByte (uint8_t & nextByte);
@@ -40,6 +40,7 @@ public:
   int readFixedRange (uint8_t op_code, Token & nxtTkn);
   int readString (uint8_t op_code, Token & nxtTkn);
   int readUserVar (Token & nxtTkn);
+  int readUserVar (Token & nxtTkn, uint64_t & num_elements);
 
 
 protected:
@@ -52,7 +53,7 @@ private:
   std::wstring inFileName;
   std::ifstream inputStream;
   Utilities util;
-  CompileExecTerms * execTerms;
+  const CompileExecTerms * execTerms;
 
 };
 
@@ -12,19 +12,22 @@
 #include "InfoWarnError.h"
 #include "OpCodes.h"
 #include "Token.h"
+#include <algorithm>
 #include <cstdint>
+#include <filesystem>
 #include <iostream>
 #include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
-InterpretedFileWriter::InterpretedFileWriter(std::string output_file_name, CompileExecTerms & inExecTerms
+InterpretedFileWriter::InterpretedFileWriter(std::string output_file_name, const CompileExecTerms & inExecTerms
     , std::shared_ptr<UserMessages> userMessages)
   : outputStream (output_file_name, outputStream.binary | outputStream.out)
 {
   execTerms = & inExecTerms;
   this->userMessages = userMessages;
+  outFileName = util.stringToWstring(output_file_name);
 
   // TODO: Are these asserts even necessary when the & operator is used in parameter list?
   assert (execTerms != NULL);
@@ -90,6 +93,159 @@ int InterpretedFileWriter::writeFlatExprToFile (std::vector<Token> & flatExprTkn
   return (ret_code);
 }
 
+/* ****************************************************************************
+ * Walk the tree that represents an expression and encode each node straight
+ * into the interpreted file as a flexible length EXPRESSION_OPCODE object.
+ * Expression is written out in [OPR8R][LEFT][RIGHT] order.  The OPR8R goes 1st
+ * to enable short-circuiting of [&&], [||] and [?] OPR8Rs.
+ * Some example source expressions and their corresponding Token lists that get
+ * written out to the interpreted file are shown below.
+ * 
+ * seven = three + four;
+ * [=][seven][B+][three][four]
+ *
+ * one = 1;
+ * [=][one][1]
+ *
+ * seven * seven + init1++; 
+ * [B+][*][seven][seven][1+][init1]
+ * 
+ * seven * seven + ++init2;
+ * [B+][*][seven][seven][+1][init2]
+ * 
+ * one >= two ? 1 : three <= two ? 2 : three == four ? 3 : six > seven ? 4 : six > (two << two) ? 5 : 12345;
+ * [?][>=][one][two][1][?][<=][three][two][2][?][==][three][four][3][?][>][six][seven][4][?][>][six][<<][two][two][5][12345]
+ * 
+ * count == 1 ? "one" : count == 2 ? "two" : "MANY";
+ * [?][==][count][1]["one"][?][==][count][2]["two"]["MANY"]
+ * 
+ * 3 * 4 / 3 + 4 << 4;
+ * [<<][B+][/][*][3][4][3][4][4]
+ * 
+ * 3 * 4 / 3 + 4 << 4 + 1;
+ * [<<][B+][/][*][3][4][3][4][B+][4][1]
+ * 
+ * (one * two >= three || two * three > six || three * four < seven || four / two < one) && (three % two > 1 || (shortCircuitAnd987 = 654));
+ * [&&][||][||][||][>=][*][one][two][three][>][*][two][three][six][<][*][three][four][seven][<][/][four][two][one][||][>][%][three][two][1][=][shortCircuitAnd987][654]
+ *
+ * A stand-alone system call node is written out the same way:
+ * print_line ("Hello " + name);
+ * [sys_call::print_line][B+]["Hello "][name]
+ * ***************************************************************************/
+int InterpretedFileWriter::writeExprTreeToFile (std::shared_ptr<ExprTreeNode> rootOfExpr, bool isIllustrative) {
+  int ret_code = GENERAL_FAILURE;
+  std::wstring illustrativeStr;
+
+  if (rootOfExpr == NULL)  {
+    userMessages->logMsg (INTERNAL_ERROR, L"Expression tree is EMPTY!", thisSrcFile, __LINE__, 0);
+
+  } else  {
+    // Make sure we're at END of our output file
+    outputStream.seekp(0, std::fstream::end);
+
+    uint32_t startFilePos = outputStream.tellp();
+
+    uint32_t length_pos = writeFlexLenOpCode (EXPRESSION_OPCODE);
+    if (0 != length_pos)  {
+      // Length gets filled in after the entire expression has been written out
+      if (OK != writeExprNode_OLR (rootOfExpr, isIllustrative, illustrativeStr))
+        userMessages->logMsg (INTERNAL_ERROR, L"Failure writing expression tree out to interpreted file", thisSrcFile, __LINE__, 0);
+      else
+        ret_code = writeObjectLen (startFilePos);
+
+      if (OK == ret_code && isIllustrative) {
+        std::wcout << L"\nParse tree flattened and written out to interpreted file" << std::endl;
+        std::wcout << illustrativeStr << std::endl;
+      }
+    }
+  }
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ * Recursively write out [currNode][1st child sub-tree][2nd child sub-tree]
+ * ***************************************************************************/
+int InterpretedFileWriter::writeExprNode_OLR (std::shared_ptr<ExprTreeNode> currNode, bool isIllustrative, std::wstring & illustrativeStr)  {
+  int ret_code = GENERAL_FAILURE;
+
+  if (currNode != NULL && OK == writeExprNode (currNode, isIllustrative, illustrativeStr))  {
+    ret_code = OK;
+
+    if (currNode->_1stChild != NULL)  {
+      if (OK != writeExprNode_OLR (currNode->_1stChild, isIllustrative, illustrativeStr))
+        ret_code = GENERAL_FAILURE;
+
+      else if (currNode->_2ndChild != NULL && OK != writeExprNode_OLR (currNode->_2ndChild, isIllustrative, illustrativeStr))
+        ret_code = GENERAL_FAILURE;
+    }
+  }
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ * Encode a single tree node.  OPR8Rs could still be in their compiler form,
+ * so resolve them to their op_code here.  The [;] is syntactic sugar and the
+ * [:] doesn't need to be in the stream; their children still get written out.
+ * A system call or [?sel] node carries its parameter expressions along with it.
+ * ***************************************************************************/
+int InterpretedFileWriter::writeExprNode (std::shared_ptr<ExprTreeNode> treeNode, bool isIllustrative, std::wstring & illustrativeStr)  {
+  int ret_code = GENERAL_FAILURE;
+  Token & nodeTkn = *treeNode->originalTkn;
+
+  if (nodeTkn.tkn_type == SRC_OPR8R_TKN && execTerms->get_statement_ender() == nodeTkn._string)  {
+    ret_code = OK;
+
+  } else if (nodeTkn.tkn_type == SRC_OPR8R_TKN || nodeTkn.tkn_type == EXEC_OPR8R_TKN) {
+    uint8_t op_code = (nodeTkn.tkn_type == EXEC_OPR8R_TKN) ? nodeTkn._unsigned : execTerms->getOpCodeFor (nodeTkn._string);
+    Operator opr8r;
+
+    if (op_code == INVALID_OPCODE || OK != execTerms->getExecOpr8rDetails (op_code, opr8r)) {
+      userMessages->logMsg (INTERNAL_ERROR, L"Unexpected OPR8R " + nodeTkn.descr_sans_line_num_col(), thisSrcFile, __LINE__, 0);
+
+    } else if (op_code == TERNARY_2ND_OPR8R_OPCODE)  {
+      ret_code = OK;
+
+    } else if (OK == writeRawUnsigned (op_code, NUM_BITS_IN_BYTE))  {
+      if (isIllustrative)
+        illustrativeStr.append (L"[" + opr8r.symbol + L"]");
+
+      // [?sel] carries its operands along with it, same as a system call
+      int idx = 0;
+      for (; idx < treeNode->parameter_list.size(); idx++) {
+        if (OK != writeExprNode_OLR (treeNode->parameter_list[idx], isIllustrative, illustrativeStr))
+          break;
+      }
+
+      if (idx == treeNode->parameter_list.size())
+        ret_code = OK;
+    }
+
+  } else if (nodeTkn.tkn_type == SYSTEM_CALL_TKN)  {
+    if (OK == writeToken (nodeTkn)) {
+      if (isIllustrative)
+        illustrativeStr.append (nodeTkn.getBracketedValueStr());
+
+      int idx = 0;
+      for (; idx < treeNode->parameter_list.size(); idx++) {
+        if (OK != writeExprNode_OLR (treeNode->parameter_list[idx], isIllustrative, illustrativeStr))
+          break;
+      }
+
+      if (idx == treeNode->parameter_list.size())
+        ret_code = OK;
+    }
+
+  } else if (OK == writeToken (nodeTkn)) {
+    if (isIllustrative)
+      illustrativeStr.append (nodeTkn.getBracketedValueStr());
+    ret_code = OK;
+  }
+
+  return (ret_code);
+}
+
 /* ****************************************************************************
  * Called after an entire object has been written out and the length now needs
  * to be filled in.  This fxn assumes that the position for the output interpreted
@@ -257,7 +413,7 @@ int InterpretedFileWriter::writeRawUnsigned (uint64_t  payload, int payloadBitSi
 /* ****************************************************************************
  * TODO: Any kind of check for success?
  * ***************************************************************************/
-int InterpretedFileWriter::writeString (uint8_t op_code, std::wstring tokenStr) {
+int InterpretedFileWriter::writeString (uint8_t op_code, const std::wstring & tokenStr) {
   int ret_code = GENERAL_FAILURE;
 
   uint32_t startFilePos = outputStream.tellp();
@@ -280,8 +436,9 @@ int InterpretedFileWriter::writeString (uint8_t op_code, std::wstring tokenStr)
  * TODO: Any kind of check for success?
  * USER_VAR_OPCODE  0x61  [op_code][total_length][STRING_OPCODE string] for scalar variable
  *                        [op_code][total_length][STRING_OPCODE string] [string|integer]+ for array variable
+ * An array's declaration carries its # of elements as the single integer
  * ***************************************************************************/
- int InterpretedFileWriter::write_user_var (std::wstring tokenStr, bool is_array) {
+ int InterpretedFileWriter::write_user_var (const std::wstring & tokenStr, bool is_array, uint64_t num_elements) {
   int ret_code = GENERAL_FAILURE;
   bool is_failed = false;
 
@@ -293,9 +450,8 @@ int InterpretedFileWriter::writeString (uint8_t op_code, std::wstring tokenStr)
     // write 0s to it. It will get filled in later when writing the entire expression out has
     // been completed.
     if (OK == writeString(STRING_OPCODE, tokenStr))  {
-      if (is_array) {
-
-      }
+      if (is_array && OK != write64BitOpCode (UINT64_OPCODE, num_elements))
+        is_failed = true;
 
       if (!is_failed) {
         ret_code = writeObjectLen (startFilePos);
@@ -309,7 +465,7 @@ int InterpretedFileWriter::writeString (uint8_t op_code, std::wstring tokenStr)
 /* ****************************************************************************
  * TODO: Any kind of check for success?
  * ***************************************************************************/
-int InterpretedFileWriter::writeRawString (std::wstring tokenStr) {
+int InterpretedFileWriter::writeRawString (const std::wstring & tokenStr) {
   int ret_code = GENERAL_FAILURE;
   bool isFailed = false;
 
@@ -340,7 +496,7 @@ int InterpretedFileWriter::writeRawString (std::wstring tokenStr) {
 /* ****************************************************************************
  *
  * ***************************************************************************/
-int InterpretedFileWriter::writeToken (Token token) {
+int InterpretedFileWriter::writeToken (const Token & token) {
   int ret_code = GENERAL_FAILURE;
 
   uint8_t tkn8Val;
@@ -351,8 +507,8 @@ int InterpretedFileWriter::writeToken (Token token) {
   else {
     switch(token.tkn_type)  {
     case USER_WORD_TKN :
-      // TODO: Need to handle is_array == true case eventually
-      ret_code = write_user_var(token._string, false);
+      // Only a declaration says how big an array is; after that it just goes by its name
+      ret_code = write_user_var(token._string, false, 0);
       break;
     case STRING_TKN :
       ret_code = writeString (STRING_OPCODE, token._string);
@@ -404,8 +560,17 @@ int InterpretedFileWriter::writeToken (Token token) {
     case EXEC_OPR8R_TKN :
       ret_code = writeRawUnsigned (token._unsigned, NUM_BITS_IN_BYTE);
       break;
+    case TEMP_SLOT_TKN :
+      if (OK == writeRawUnsigned (TEMP_SLOT_OPCODE, NUM_BITS_IN_BYTE))
+        ret_code = writeRawUnsigned (token._unsigned, NUM_BITS_IN_BYTE);
+      break;
+    case INVARIANT_SLOT_TKN :
+      if (OK == writeRawUnsigned (INVARIANT_SLOT_OPCODE, NUM_BITS_IN_BYTE))
+        ret_code = writeRawUnsigned (token._unsigned, NUM_BITS_IN_WORD);
+      break;
     case SYSTEM_CALL_TKN :
-      ret_code = writeString (SYSTEM_CALL_OPCODE, token._string);
+      if (OK == writeRawUnsigned (SYSTEM_CALL_ID_OPCODE, NUM_BITS_IN_BYTE))
+        ret_code = writeRawUnsigned (token._unsigned, NUM_BITS_IN_BYTE);
       break;
       
     case SPR8R_TKN :
@@ -429,3 +594,216 @@ uint32_t InterpretedFileWriter::getWriteFilePos ()  {
 
 }
 
+/* ****************************************************************************
+ * Cut [startPos, endPos) out of the interpreted file and slide everything after
+ * it down.  Objects are only ever located by length, so this is safe as long as
+ * no object enclosing the range has had its length filled in yet, or the caller
+ * fixes that object up with adjustObjectLen.
+ * ***************************************************************************/
+int InterpretedFileWriter::cutRange (uint32_t startPos, uint32_t endPos)  {
+  int ret_code = GENERAL_FAILURE;
+  std::filesystem::path outFilePath (outFileName);
+  std::string tailBytes;
+  std::error_code resizeErr;
+
+  outputStream.flush();
+  outputStream.seekp(0, std::fstream::end);
+  uint32_t fileEndPos = outputStream.tellp();
+
+  if (startPos > endPos || endPos > fileEndPos) {
+    userMessages->logMsg (INTERNAL_ERROR, L"Cannot cut [" + std::to_wstring(startPos) + L", " + std::to_wstring(endPos)
+      + L") from interpreted file of length " + std::to_wstring(fileEndPos), thisSrcFile, __LINE__, 0);
+
+  } else  {
+    bool isFailed = false;
+
+    if (endPos < fileEndPos) {
+      // Pick up whatever follows the cut before it gets written over
+      std::ifstream tailStream (outFilePath, std::ios::binary | std::ios::in);
+      tailBytes.resize (fileEndPos - endPos);
+      tailStream.seekg (endPos, std::ios::beg);
+      if (!tailStream.read (&tailBytes[0], tailBytes.size()))
+        isFailed = true;
+    }
+
+    if (!isFailed)  {
+      outputStream.seekp (startPos, std::fstream::beg);
+      outputStream.write (tailBytes.data(), tailBytes.size());
+      outputStream.flush();
+      std::filesystem::resize_file (outFilePath, startPos + tailBytes.size(), resizeErr);
+      outputStream.seekp(0, std::fstream::end);
+
+      if (!resizeErr && outputStream.tellp() == startPos + tailBytes.size())
+        ret_code = OK;
+    }
+
+    if (OK != ret_code)
+      userMessages->logMsg (INTERNAL_ERROR, L"Failed cutting [" + std::to_wstring(startPos) + L", " + std::to_wstring(endPos)
+        + L") from interpreted file", thisSrcFile, __LINE__, 0);
+  }
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ * Throw away everything written from filePos on
+ * ***************************************************************************/
+int InterpretedFileWriter::truncateTo (uint32_t filePos)  {
+  outputStream.seekp(0, std::fstream::end);
+
+  return (cutRange (filePos, outputStream.tellp()));
+}
+
+/* ****************************************************************************
+ * Everything from tailStartPos to the end of the file gets moved in front of
+ * what's at destPos; whatever was in between slides over to make room
+ * ***************************************************************************/
+int InterpretedFileWriter::moveTailTo (uint32_t tailStartPos, uint32_t destPos)  {
+  int ret_code = GENERAL_FAILURE;
+  std::filesystem::path outFilePath (outFileName);
+  std::string movedBytes;
+
+  outputStream.flush();
+  outputStream.seekp(0, std::fstream::end);
+  uint32_t fileEndPos = outputStream.tellp();
+
+  if (destPos > tailStartPos || tailStartPos > fileEndPos) {
+    userMessages->logMsg (INTERNAL_ERROR, L"Cannot move [" + std::to_wstring(tailStartPos) + L", " + std::to_wstring(fileEndPos)
+      + L") in front of " + std::to_wstring(destPos), thisSrcFile, __LINE__, 0);
+
+  } else if (destPos == tailStartPos || tailStartPos == fileEndPos)  {
+    ret_code = OK;
+
+  } else  {
+    std::ifstream inStream (outFilePath, std::ios::binary | std::ios::in);
+    movedBytes.resize (fileEndPos - destPos);
+    inStream.seekg (destPos, std::ios::beg);
+
+    if (inStream.read (&movedBytes[0], movedBytes.size()))  {
+      std::rotate (movedBytes.begin(), movedBytes.begin() + (tailStartPos - destPos), movedBytes.end());
+      outputStream.seekp (destPos, std::fstream::beg);
+      outputStream.write (movedBytes.data(), movedBytes.size());
+      outputStream.flush();
+      outputStream.seekp(0, std::fstream::end);
+
+      if (outputStream.tellp() == fileEndPos)
+        ret_code = OK;
+    }
+
+    if (OK != ret_code)
+      userMessages->logMsg (INTERNAL_ERROR, L"Failed moving [" + std::to_wstring(tailStartPos) + L", " + std::to_wstring(fileEndPos)
+        + L") in front of " + std::to_wstring(destPos), thisSrcFile, __LINE__, 0);
+  }
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ * Swap the op_code of an already written flexible length object for another
+ * one with the same layout
+ * ***************************************************************************/
+int InterpretedFileWriter::rewriteOpCode (uint32_t objStartPos, uint8_t op_code)  {
+  int ret_code = GENERAL_FAILURE;
+
+  outputStream.seekp(0, std::fstream::end);
+  uint32_t fileEndPos = outputStream.tellp();
+
+  if (objStartPos >= fileEndPos || op_code < FIRST_VALID_FLEX_LEN_OPCODE || op_code > LAST_VALID_FLEX_LEN_OPCODE)  {
+    userMessages->logMsg (INTERNAL_ERROR, L"Cannot rewrite op_code at " + std::to_wstring(objStartPos), thisSrcFile, __LINE__, 0);
+
+  } else  {
+    outputStream.seekp(objStartPos, std::fstream::beg);
+    ret_code = writeRawUnsigned (op_code, NUM_BITS_IN_BYTE);
+    outputStream.seekp(0, std::fstream::end);
+  }
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ * Read back what has already been written out, e.g. so it can be copied
+ * ***************************************************************************/
+int InterpretedFileWriter::readBytes (uint32_t startPos, uint32_t numBytes, std::string & rawBytes)  {
+  int ret_code = GENERAL_FAILURE;
+
+  outputStream.flush();
+  outputStream.seekp(0, std::fstream::end);
+  uint32_t fileEndPos = outputStream.tellp();
+
+  if (startPos > fileEndPos || numBytes > fileEndPos - startPos)  {
+    userMessages->logMsg (INTERNAL_ERROR, L"Cannot read [" + std::to_wstring(startPos) + L", " + std::to_wstring(startPos + numBytes)
+      + L") from interpreted file of length " + std::to_wstring(fileEndPos), thisSrcFile, __LINE__, 0);
+
+  } else  {
+    std::ifstream inStream (std::filesystem::path (outFileName), std::ios::binary | std::ios::in);
+    rawBytes.resize (numBytes);
+    inStream.seekg (startPos, std::ios::beg);
+
+    if (numBytes == 0 || inStream.read (&rawBytes[0], numBytes))
+      ret_code = OK;
+    else
+      userMessages->logMsg (INTERNAL_ERROR, L"Failed reading [" + std::to_wstring(startPos) + L", " + std::to_wstring(startPos + numBytes)
+        + L") from interpreted file", thisSrcFile, __LINE__, 0);
+  }
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ * Bytes that came from readBytes go back out as is
+ * ***************************************************************************/
+int InterpretedFileWriter::writeRawBytes (const std::string & rawBytes)  {
+  int ret_code = GENERAL_FAILURE;
+
+  outputStream.write (rawBytes.data(), rawBytes.size());
+  if (outputStream.good())
+    ret_code = OK;
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ * Length field of the flexible length object starting at objPos within bytes
+ * that came from readBytes; 0 if it doesn't fit
+ * ***************************************************************************/
+uint32_t InterpretedFileWriter::getRawObjectLen (const std::string & rawBytes, uint32_t objPos)  {
+  uint32_t objectLen = 0;
+
+  if (objPos + OPCODE_NUM_BYTES + NUM_BYTES_IN_DWORD <= rawBytes.size())  {
+    for (int idx = 0; idx < NUM_BYTES_IN_DWORD; idx++)
+      objectLen = (objectLen << NUM_BITS_IN_BYTE) | (uint8_t)rawBytes[objPos + OPCODE_NUM_BYTES + idx];
+
+    if (objectLen > rawBytes.size() - objPos)
+      objectLen = 0;
+  }
+
+  return (objectLen);
+}
+
+/* ****************************************************************************
+ * Fix up the already written length of the object starting at objStartPos after
+ * something inside of it has been cut out
+ * ***************************************************************************/
+int InterpretedFileWriter::adjustObjectLen (uint32_t objStartPos, int32_t lenDelta)  {
+  int ret_code = GENERAL_FAILURE;
+  uint8_t lenBytes[NUM_BYTES_IN_DWORD];
+  uint32_t objectLen = 0;
+
+  outputStream.flush();
+  std::ifstream lenStream (std::filesystem::path (outFileName), std::ios::binary | std::ios::in);
+  lenStream.seekg (objStartPos + OPCODE_NUM_BYTES, std::ios::beg);
+
+  if (!lenStream.read (reinterpret_cast<char*>(lenBytes), NUM_BYTES_IN_DWORD)) {
+    userMessages->logMsg (INTERNAL_ERROR, L"Failed reading object length at " + std::to_wstring(objStartPos), thisSrcFile, __LINE__, 0);
+
+  } else  {
+    for (int idx = 0; idx < NUM_BYTES_IN_DWORD; idx++)
+      objectLen = (objectLen << NUM_BITS_IN_BYTE) | lenBytes[idx];
+
+    outputStream.seekp(objStartPos + OPCODE_NUM_BYTES, std::fstream::beg);
+    ret_code = writeRawUnsigned (objectLen + lenDelta, NUM_BITS_IN_DWORD);
+    outputStream.seekp(0, std::fstream::end);
+  }
+
+  return (ret_code);
+}
@@ -18,23 +18,32 @@
 
 class InterpretedFileWriter {
 public:
-  InterpretedFileWriter(std::string output_file_name, CompileExecTerms & inExecTerms, std::shared_ptr<UserMessages> userMessages);
+  InterpretedFileWriter(std::string output_file_name, const CompileExecTerms & inExecTerms, std::shared_ptr<UserMessages> userMessages);
   virtual ~InterpretedFileWriter();
   int writeFlatExprToFile(std::vector<Token> & flatExprTknLists, bool isIllustrative);
+  int writeExprTreeToFile (std::shared_ptr<ExprTreeNode> rootOfExpr, bool isIllustrative);
 
   // TODO: Is making these "public" legit?
   int writeFlexLenOpCode (uint8_t op_code);
   int writeObjectLen (uint32_t objStartPos);
   int writeRawUnsigned (uint64_t  payload, int payloadBitSize);
-  int writeString (uint8_t op_code, std::wstring tokenStr);
-  int write_user_var (std::wstring tokenStr, bool is_array);
+  int writeString (uint8_t op_code, const std::wstring & tokenStr);
+  int write_user_var (const std::wstring & tokenStr, bool is_array, uint64_t num_elements);
   uint32_t getWriteFilePos ();
+  int cutRange (uint32_t startPos, uint32_t endPos);
+  int truncateTo (uint32_t filePos);
+  int adjustObjectLen (uint32_t objStartPos, int32_t lenDelta);
+  int moveTailTo (uint32_t tailStartPos, uint32_t destPos);
+  int rewriteOpCode (uint32_t objStartPos, uint8_t op_code);
+  int readBytes (uint32_t startPos, uint32_t numBytes, std::string & rawBytes);
+  int writeRawBytes (const std::string & rawBytes);
+  uint32_t getRawObjectLen (const std::string & rawBytes, uint32_t objPos);
 
 private:
   std::wstring thisSrcFile;
   std::wstring outFileName;
   Utilities util;
-  CompileExecTerms * execTerms;
+  const CompileExecTerms * execTerms;
   std::ofstream outputStream;
   std::shared_ptr<UserMessages> userMessages;
 
@@ -43,8 +52,10 @@ private:
   int write16BitOpCode (uint8_t op_code, uint16_t payload);
   int write32BitOpCode (uint8_t op_code, uint32_t payload);
   int write64BitOpCode (uint8_t op_code, uint64_t payload);
-  int writeRawString (std::wstring tokenStr);
-  int writeToken (Token token);
+  int writeRawString (const std::wstring & tokenStr);
+  int writeToken (const Token & token);
+  int writeExprNode_OLR (std::shared_ptr<ExprTreeNode> currNode, bool isIllustrative, std::wstring & illustrativeStr);
+  int writeExprNode (std::shared_ptr<ExprTreeNode> treeNode, bool isIllustrative, std::wstring & illustrativeStr);
   
 };
 
@@ -0,0 +1,688 @@
+/*
+ * LoopInvariantHoister.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ *
+ * Compile time pass that moves sub-expressions whose value can't change from
+ * one trip through a [while]|[for] loop to the next out in front of the loop,
+ * so they only get evaluated once.
+ *
+ * uint32 limit = 10; uint32 step = 3; uint32 total = 0; uint32 idx = 0;
+ * while (idx < limit * 2)  { total += step * step + idx; idx++; }
+ *
+ * [=tmp][inv::0][*][limit][0x2]          <- pre-header, runs once
+ * [=tmp][inv::1][*][step][step]          <- pre-header, runs once
+ * while: [<][idx][inv::0]
+ *        [+=][total][B+][inv::1][idx]
+ *
+ * Before the loop body gets compiled, its Tokens are scanned for every variable
+ * that gets assigned, [pre|post]-fix'd or declared anywhere inside the loop.  A
+ * sub-tree is invariant if it's only made up of literals and initialized
+ * variables outside of that set.  The pre-header runs even if the loop body
+ * never does, so only OPR8Rs that can't fail at run time get hoisted, e.g. [/]
+ * needs a non-zero literal divisor.  Hoisting only ever goes as far as the
+ * innermost enclosing loop.
+ *
+ * The same scan tells which [for] loops are counted: see isCountedLoop.
+ */
+
+#include "LoopInvariantHoister.h"
+#include <iostream>
+#include "InfoWarnError.h"
+#include "OpCodes.h"
+#include "common.h"
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+LoopInvariantHoister::LoopInvariantHoister(const CompileExecTerms & inExecTerms, std::shared_ptr<UserMessages> userMessages
+  , std::shared_ptr<StackOfScopes> inVarScopeStack)
+  : execTerms (inExecTerms)  {
+
+  this->userMessages = userMessages;
+  scopedNameSpace = inVarScopeStack;
+  thisSrcFile = util.getLastSegment(util.stringToWstring(__FILE__), L"/");
+  failed_on_src_line = 0;
+  numSlotsUsed = 0;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+LoopInvariantHoister::~LoopInvariantHoister() {
+  if (failed_on_src_line > 0 && !userMessages->isExistsInternalError(thisSrcFile, failed_on_src_line))  {
+    // Dump out a debugging hint
+    std::wcout << L"FAILURE on " << thisSrcFile << L":" << failed_on_src_line << std::endl;
+  }
+}
+
+/* ****************************************************************************
+ * Called before a loop's control expression(s) get compiled. tknStream should
+ * be sitting on the loop's control block, with parenDepth [(]s already eaten.
+ * ***************************************************************************/
+int LoopInvariantHoister::openLoop (uint8_t opener_opcode, Token & openingTkn, TokenPtrVector & tknStream, int parenDepth
+  , uint32_t loopStartPos) {
+  loopContext newLoop;
+
+  newLoop.opener_opcode = opener_opcode;
+  newLoop.loop_start_pos = loopStartPos;
+  newLoop.line_num = openingTkn.get_line_number();
+  newLoop.is_body_breaking = false;
+  newLoop.is_body_declaring = false;
+  newLoop.const_trip_cnt = -1;
+  collectWrittenVars (tknStream, parenDepth, newLoop);
+  openLoops.push_back (newLoop);
+
+  return OK;
+}
+
+/* ****************************************************************************
+ * Hand back everything that got hoisted out of the innermost loop, which has
+ * to be the one that's closing
+ * ***************************************************************************/
+int LoopInvariantHoister::closeLoop (uint8_t closedScopeOpCode, loopContext & closedLoop) {
+  int ret_code = GENERAL_FAILURE;
+
+  if (openLoops.empty() || openLoops.back().opener_opcode != closedScopeOpCode)  {
+    userMessages->logMsg (INTERNAL_ERROR, L"Closing a loop that was never opened", thisSrcFile, __LINE__, 0);
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    closedLoop = openLoops.back();
+    openLoops.pop_back();
+    ret_code = OK;
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+bool LoopInvariantHoister::isLoopOpen () {
+  return (!openLoops.empty());
+}
+
+/* ****************************************************************************
+ * A [for] loop is counted if its induction variable only ever moves by a
+ * constant step in the last expression, e.g. for (int8 idx = 0; idx < 12; idx++)
+ * conditional:     [<|<=|>|>=|!=][var][literal|unchanging variable|inv::N]
+ * last expression: [++|--][var] or [+=|-=][var][non-zero literal]
+ * Nothing in the body can write to var, so the number of trips the loop makes
+ * can be worked out once when the loop starts.
+ * ***************************************************************************/
+bool LoopInvariantHoister::isCountedLoop (std::shared_ptr<ExprTreeNode> condTree, std::shared_ptr<ExprTreeNode> lastTree
+  , inductionVar & indVar) {
+  bool isCounted = false;
+  uint8_t condOpCode, lastOpCode;
+  uint64_t stepSize = 1;
+
+  if (openLoops.empty() || condTree == NULL || lastTree == NULL)  {
+    isCounted = false;
+
+  } else if (isOpr8rNode (condTree, condOpCode) && isOpr8rNode (lastTree, lastOpCode)
+    && condTree->_1stChild != NULL && condTree->_2ndChild != NULL
+    && condTree->_1stChild->originalTkn->tkn_type == USER_WORD_TKN)  {
+    loopContext & innerLoop = openLoops.back();
+    std::wstring varName = condTree->_1stChild->originalTkn->_string;
+    std::shared_ptr<ExprTreeNode> limitNode = condTree->_2ndChild;
+    std::shared_ptr<ExprTreeNode> steppedNode;
+    bool isCondOK = false;
+    bool isStepOK = false;
+    bool isLimitOK = false;
+
+    isCondOK = (condOpCode == LESS_THAN_OPR8R_OPCODE || condOpCode == LESS_EQUALS_OPR8R8_OPCODE || condOpCode == GREATER_THAN_OPR8R_OPCODE
+      || condOpCode == GREATER_EQUALS_OPR8R8_OPCODE || condOpCode == NOT_EQUALS_OPR8R_OPCODE);
+
+    if (lastOpCode == POST_INCR_OPR8R_OPCODE || lastOpCode == POST_DECR_OPR8R_OPCODE
+      || lastOpCode == PRE_INCR_OPR8R_OPCODE || lastOpCode == PRE_DECR_OPR8R_OPCODE)  {
+      steppedNode = (lastTree->_1stChild != NULL ? lastTree->_1stChild : lastTree->_2ndChild);
+      isStepOK = true;
+
+    } else if (lastOpCode == PLUS_ASSIGN_OPR8R_OPCODE || lastOpCode == MINUS_ASSIGN_OPR8R_OPCODE)  {
+      steppedNode = lastTree->_1stChild;
+      isStepOK = isNonNegativeLiteral (lastTree->_2ndChild, stepSize) && stepSize != 0 && stepSize <= MAX_COUNTED_LOOP_MAGNITUDE;
+    }
+
+    if (limitNode->_1stChild == NULL && limitNode->_2ndChild == NULL)  {
+      Token & limitTkn = *limitNode->originalTkn;
+      isLimitOK = (limitTkn.isSigned() || limitTkn.isUnsigned() || limitTkn.tkn_type == INVARIANT_SLOT_TKN
+        || (limitTkn.tkn_type == USER_WORD_TKN && innerLoop.written_vars.count (limitTkn._string) == 0 && isIntegerVar (limitTkn._string)));
+    }
+
+    isCounted = (isCondOK && isStepOK && isLimitOK && steppedNode != NULL && steppedNode->originalTkn->tkn_type == USER_WORD_TKN
+      && steppedNode->originalTkn->_string == varName && innerLoop.body_written_vars.count (varName) == 0 && isIntegerVar (varName));
+
+    if (isCounted)  {
+      indVar.var_name = varName;
+      indVar.cond_op_code = condOpCode;
+      indVar.limit_tkn = *limitNode->originalTkn;
+      indVar.step = (lastOpCode == POST_INCR_OPR8R_OPCODE || lastOpCode == PRE_INCR_OPR8R_OPCODE
+        || lastOpCode == PLUS_ASSIGN_OPR8R_OPCODE ? (int64_t)stepSize : -(int64_t)stepSize);
+    }
+  }
+
+  return isCounted;
+}
+
+/* ****************************************************************************
+ * Innermost loop makes exactly numTrips trips, every time it runs
+ * ***************************************************************************/
+void LoopInvariantHoister::setConstTripCount (int64_t numTrips) {
+  if (!openLoops.empty())
+    openLoops.back().const_trip_cnt = numTrips;
+}
+
+/* ****************************************************************************
+ * Every variable the innermost loop writes to, in its control block or body
+ * ***************************************************************************/
+int LoopInvariantHoister::getWrittenVars (std::set<std::wstring> & writtenVars) {
+  int ret_code = GENERAL_FAILURE;
+
+  writtenVars.clear();
+
+  if (!openLoops.empty())  {
+    writtenVars = openLoops.back().written_vars;
+    ret_code = OK;
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * Swap every maximal invariant sub-tree of this expression for an [inv::N]
+ * slot. Nothing happens outside of a loop.
+ * ***************************************************************************/
+int LoopInvariantHoister::hoistInvariants (std::shared_ptr<ExprTreeNode> rootOfExpr) {
+  int ret_code = GENERAL_FAILURE;
+  bool isInvariant;
+
+  if (openLoops.empty())  {
+    ret_code = OK;
+
+  } else if (OK != hoistNode_OLR (rootOfExpr, isInvariant))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    if (isInvariant)  {
+      // e.g. a [while] conditional that's invariant in its entirety; [break] gets it out of the loop
+      if (isHoistable (rootOfExpr))
+        hoistSubTree (rootOfExpr);
+      else
+        hoistInvariantChildren_OLR (rootOfExpr);
+    }
+    ret_code = OK;
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * Walk the loop's control block and body without consuming anything. The body
+ * is either a {} block or a single statement ending in [;].
+ * ***************************************************************************/
+void LoopInvariantHoister::collectWrittenVars (TokenPtrVector & tknStream, int parenDepth, loopContext & newLoop) {
+  std::wstring incrStr = execTerms.getSrcOpr8rStrFor (POST_INCR_OPR8R_OPCODE);
+  std::wstring decrStr = execTerms.getSrcOpr8rStrFor (POST_DECR_OPR8R_OPCODE);
+  std::wstring stmtEnder = execTerms.get_statement_ender();
+  std::set<std::wstring> assignStrs;
+  bool isCtrlDone = false;
+  bool isBodyDone = false;
+  bool isInDeclaration = false;
+  int braceDepth = 0;
+
+  for (uint8_t op_code = ASSIGNMENT_OPR8R_OPCODE; op_code <= BITWISE_OR_ASSIGN_OPR8R_OPCODE; op_code++)
+    assignStrs.insert (execTerms.getSrcOpr8rStrFor (op_code));
+
+  for (int idx = 0; idx < tknStream.size() && !isBodyDone; idx++) {
+    Token & currTkn = *tknStream[idx];
+    std::shared_ptr<Token> prevTkn = (idx > 0 ? tknStream[idx - 1] : NULL);
+    std::shared_ptr<Token> nxtTkn = (idx + 1 < tknStream.size() ? tknStream[idx + 1] : NULL);
+
+    if (currTkn.tkn_type == END_OF_STREAM_TKN)  {
+      isBodyDone = true;
+
+    } else if (currTkn.tkn_type == SPR8R_TKN)  {
+      if (currTkn._string == L"(")  {
+        parenDepth++;
+
+      } else if (currTkn._string == L")")  {
+        parenDepth--;
+        if (parenDepth == 0 && !isCtrlDone)
+          isCtrlDone = true;
+
+      } else if (currTkn._string == L"{")  {
+        braceDepth++;
+
+      } else if (currTkn._string == L"}")  {
+        braceDepth--;
+        if (isCtrlDone && braceDepth <= 0)
+          isBodyDone = true;
+      }
+
+    } else if (currTkn.tkn_type == SRC_OPR8R_TKN && currTkn._string == stmtEnder)  {
+      isInDeclaration = false;
+      if (isCtrlDone && parenDepth <= 0 && braceDepth <= 0)
+        // Single statement loop body
+        isBodyDone = true;
+
+    } else if (currTkn.tkn_type == SRC_OPR8R_TKN && (currTkn._string == incrStr || currTkn._string == decrStr))  {
+      if (prevTkn != NULL && prevTkn->tkn_type == USER_WORD_TKN)
+        noteWrittenVar (prevTkn->_string, isCtrlDone, newLoop);
+      if (nxtTkn != NULL && nxtTkn->tkn_type == USER_WORD_TKN)
+        noteWrittenVar (nxtTkn->_string, isCtrlDone, newLoop);
+
+    } else if (currTkn.tkn_type == SRC_OPR8R_TKN && assignStrs.count (currTkn._string) > 0)  {
+      if (prevTkn != NULL && prevTkn->tkn_type == USER_WORD_TKN)
+        noteWrittenVar (prevTkn->_string, isCtrlDone, newLoop);
+
+    } else if (execTerms.getDataType_tknEnum_opCode (currTkn._string).second != INVALID_OPCODE)  {
+      isInDeclaration = true;
+      if (isCtrlDone)
+        newLoop.is_body_declaring = true;
+
+    } else if (isCtrlDone && currTkn.tkn_type == RESERVED_WORD_TKN && currTkn._string == L"break")  {
+      newLoop.is_body_breaking = true;
+
+    } else if (isInDeclaration && currTkn.tkn_type == USER_WORD_TKN && nxtTkn != NULL
+      && (nxtTkn->_string == L"," || nxtTkn->_string == stmtEnder))  {
+      // Declared without an initializer; [=] is handled above
+      noteWrittenVar (currTkn._string, isCtrlDone, newLoop);
+    }
+  }
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+void LoopInvariantHoister::noteWrittenVar (std::wstring varName, bool isInBody, loopContext & newLoop) {
+  newLoop.written_vars.insert (varName);
+  if (isInBody)
+    newLoop.body_written_vars.insert (varName);
+}
+
+/* ****************************************************************************
+ * Figure out whether currNode's sub-tree is invariant. Any invariant child of a
+ * node that isn't gets hoisted here; an invariant node is left for its parent
+ * to deal with, so only maximal sub-trees get hoisted.
+ * ***************************************************************************/
+int LoopInvariantHoister::hoistNode_OLR (std::shared_ptr<ExprTreeNode> currNode, bool & isInvariant) {
+  int ret_code = GENERAL_FAILURE;
+  uint8_t op_code;
+  isInvariant = false;
+
+  if (currNode == NULL || currNode->originalTkn == NULL)  {
+    userMessages->logMsg (INTERNAL_ERROR, L"Unexpected NULL expression tree node", thisSrcFile, __LINE__, 0);
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (currNode->originalTkn->tkn_type == SYSTEM_CALL_TKN)  {
+    std::vector<bool> isParamInvariant;
+    bool isAllInvariant = true;
+    ret_code = OK;
+
+    for (auto param : currNode->parameter_list) {
+      bool isRandInvariant;
+      if (OK != hoistNode_OLR (param, isRandInvariant))
+        ret_code = GENERAL_FAILURE;
+      isParamInvariant.push_back (isRandInvariant);
+      isAllInvariant = isAllInvariant && isRandInvariant;
+    }
+
+    isInvariant = (OK == ret_code && isAllInvariant && execTerms.is_pure_system_call (currNode->originalTkn->_string));
+
+    for (int idx = 0; OK == ret_code && !isInvariant && idx < currNode->parameter_list.size(); idx++) {
+      if (isParamInvariant[idx] && isHoistable (currNode->parameter_list[idx]))
+        hoistSubTree (currNode->parameter_list[idx]);
+      else if (isParamInvariant[idx])
+        hoistInvariantChildren_OLR (currNode->parameter_list[idx]);
+    }
+
+  } else if (isOpr8rNode (currNode, op_code))  {
+    bool is1stInvariant = false, is2ndInvariant = false;
+    ret_code = OK;
+
+    if (isWritingOpr8r (op_code))  {
+      // Left side of an assignment is where the value goes; [pre|post]-fix operands aren't values at all
+      if (op_code >= ASSIGNMENT_OPR8R_OPCODE && currNode->_2ndChild != NULL && OK != hoistNode_OLR (currNode->_2ndChild, is2ndInvariant))
+        ret_code = GENERAL_FAILURE;
+
+    } else  {
+      if (currNode->_1stChild != NULL && OK != hoistNode_OLR (currNode->_1stChild, is1stInvariant))
+        ret_code = GENERAL_FAILURE;
+      else if (currNode->_2ndChild != NULL && OK != hoistNode_OLR (currNode->_2ndChild, is2ndInvariant))
+        ret_code = GENERAL_FAILURE;
+
+      isInvariant = (OK == ret_code && (currNode->_1stChild == NULL || is1stInvariant)
+        && (currNode->_2ndChild == NULL || is2ndInvariant) && isSafeOpr8r (currNode, op_code));
+    }
+
+    if (OK == ret_code && !isInvariant)  {
+      if (is1stInvariant && isHoistable (currNode->_1stChild))
+        hoistSubTree (currNode->_1stChild);
+      else if (is1stInvariant)
+        hoistInvariantChildren_OLR (currNode->_1stChild);
+
+      if (is2ndInvariant && isHoistable (currNode->_2ndChild))
+        hoistSubTree (currNode->_2ndChild);
+      else if (is2ndInvariant)
+        hoistInvariantChildren_OLR (currNode->_2ndChild);
+    }
+
+  } else  {
+    // Leaf node
+    if (currNode->originalTkn->tkn_type == USER_WORD_TKN)
+      isInvariant = isInvariantVar (currNode->originalTkn->_string);
+    else
+      isInvariant = currNode->originalTkn->isDirectOperand();
+
+    ret_code = OK;
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * currNode is invariant, but not worth a slot of its own (e.g. [?]). Its
+ * children are just as invariant, so hoist the ones that are.
+ * ***************************************************************************/
+void LoopInvariantHoister::hoistInvariantChildren_OLR (std::shared_ptr<ExprTreeNode> currNode) {
+  std::vector<std::shared_ptr<ExprTreeNode>> children = currNode->parameter_list;
+
+  if (currNode->_1stChild != NULL)
+    children.push_back (currNode->_1stChild);
+  if (currNode->_2ndChild != NULL)
+    children.push_back (currNode->_2ndChild);
+
+  for (auto child : children) {
+    if (isHoistable (child))
+      hoistSubTree (child);
+    else
+      hoistInvariantChildren_OLR (child);
+  }
+}
+
+/* ****************************************************************************
+ * Invariant sub-trees only get a slot if they actually do some work. Sub-trees
+ * made up of nothing but literals would have been constant folded already.
+ * ***************************************************************************/
+bool LoopInvariantHoister::isHoistable (std::shared_ptr<ExprTreeNode> currNode) {
+  bool isWorthIt = false;
+  uint8_t op_code;
+
+  if (numSlotsUsed >= MAX_INVARIANT_SLOTS)  {
+    isWorthIt = false;
+
+  } else if (currNode->originalTkn->tkn_type == SYSTEM_CALL_TKN)  {
+    isWorthIt = hasVar_OLR (currNode);
+
+  } else if (isOpr8rNode (currNode, op_code))  {
+    // [;], [?] and [:] aren't stand-alone values worth saving off
+    isWorthIt = op_code != STATEMENT_ENDER_OPR8R_OPCODE && op_code != TERNARY_1ST_OPR8R_OPCODE
+      && op_code != TERNARY_2ND_OPR8R_OPCODE && hasVar_OLR (currNode);
+  }
+
+  return isWorthIt;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+bool LoopInvariantHoister::hasVar_OLR (std::shared_ptr<ExprTreeNode> currNode) {
+  bool isVarFound = false;
+
+  if (currNode != NULL)  {
+    isVarFound = (currNode->originalTkn->tkn_type == USER_WORD_TKN || hasVar_OLR (currNode->_1stChild)
+      || hasVar_OLR (currNode->_2ndChild));
+
+    for (auto param : currNode->parameter_list)
+      isVarFound = isVarFound || hasVar_OLR (param);
+  }
+
+  return isVarFound;
+}
+
+/* ****************************************************************************
+ * OPR8Rs that are guaranteed to succeed at run time on a type checked tree, no
+ * matter what value their operands end up with.  Operands of OPR8Rs that fail
+ * on a negative have to be an unsigned variable or a non-negative literal.
+ * ***************************************************************************/
+bool LoopInvariantHoister::isSafeOpr8r (std::shared_ptr<ExprTreeNode> currNode, uint8_t op_code) {
+  bool isSafe = false;
+  uint64_t value;
+
+  switch (op_code)  {
+    case UNARY_MINUS_OPR8R_OPCODE:
+    case LOGICAL_NOT_OPR8R_OPCODE:
+    case MULTIPLY_OPR8R_OPCODE:
+    case BINARY_PLUS_OPR8R_OPCODE:
+    case BINARY_MINUS_OPR8R_OPCODE:
+    case LESS_THAN_OPR8R_OPCODE:
+    case LESS_EQUALS_OPR8R8_OPCODE:
+    case GREATER_THAN_OPR8R_OPCODE:
+    case GREATER_EQUALS_OPR8R8_OPCODE:
+    case EQUALITY_OPR8R_OPCODE:
+    case NOT_EQUALS_OPR8R_OPCODE:
+    case LOGICAL_AND_OPR8R_OPCODE:
+    case LOGICAL_OR_OPR8R_OPCODE:
+    case TERNARY_1ST_OPR8R_OPCODE:
+    case TERNARY_2ND_OPR8R_OPCODE:
+      isSafe = true;
+      break;
+
+    case BITWISE_NOT_OPR8R_OPCODE:
+      isSafe = isUnsignedLeaf (currNode->_1stChild);
+      break;
+
+    case DIV_OPR8R_OPCODE:
+    case MOD_OPR8R_OPCODE:
+      isSafe = isNonNegativeLiteral (currNode->_2ndChild, value) && value != 0;
+      break;
+
+    case LEFT_SHIFT_OPR8R_OPCODE:
+    case RIGHT_SHIFT_OPR8R_OPCODE:
+      isSafe = isUnsignedLeaf (currNode->_2ndChild) || isNonNegativeLiteral (currNode->_2ndChild, value);
+      break;
+
+    case BITWISE_AND_OPR8R_OPCODE:
+    case BITWISE_XOR_OPR8R_OPCODE:
+    case BITWISE_OR_OPR8R_OPCODE:
+      isSafe = (isUnsignedLeaf (currNode->_1stChild) || isNonNegativeLiteral (currNode->_1stChild, value))
+        && (isUnsignedLeaf (currNode->_2ndChild) || isNonNegativeLiteral (currNode->_2ndChild, value));
+      break;
+
+    default:
+      break;
+  }
+
+  return isSafe;
+}
+
+/* ****************************************************************************
+ * Not written to anywhere in the innermost loop, and already holding a value
+ * by the time the loop starts
+ * ***************************************************************************/
+bool LoopInvariantHoister::isInvariantVar (std::wstring varName) {
+  bool isInvariant = false;
+  Token varTkn;
+  std::wstring lookUpMsg;
+
+  if (openLoops.back().written_vars.count (varName) == 0
+    && OK == scopedNameSpace->findVar (varName, 0, varTkn, READ_ONLY, lookUpMsg))
+    isInvariant = varTkn.isInitialized;
+
+  return isInvariant;
+}
+
+/* ****************************************************************************
+ * Unsigned literal, or a variable declared as unsigned
+ * ***************************************************************************/
+bool LoopInvariantHoister::isUnsignedLeaf (std::shared_ptr<ExprTreeNode> currNode) {
+  bool isUnsigned = false;
+  Token varTkn;
+  std::wstring lookUpMsg;
+
+  if (currNode != NULL && currNode->_1stChild == NULL && currNode->_2ndChild == NULL)  {
+    if (currNode->originalTkn->tkn_type == USER_WORD_TKN)
+      isUnsigned = (OK == scopedNameSpace->findVar (currNode->originalTkn->_string, 0, varTkn, READ_ONLY, lookUpMsg)
+        && varTkn.isUnsigned());
+    else
+      isUnsigned = currNode->originalTkn->isUnsigned();
+  }
+
+  return isUnsigned;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+bool LoopInvariantHoister::isNonNegativeLiteral (std::shared_ptr<ExprTreeNode> currNode, uint64_t & value) {
+  bool isNonNegative = false;
+
+  if (currNode != NULL && currNode->_1stChild == NULL && currNode->_2ndChild == NULL)  {
+    Token & tkn = *currNode->originalTkn;
+
+    if (tkn.isUnsigned())  {
+      value = tkn._unsigned;
+      isNonNegative = true;
+
+    } else if (tkn.isSigned() && tkn._signed >= 0) {
+      value = tkn._signed;
+      isNonNegative = true;
+    }
+  }
+
+  return isNonNegative;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+bool LoopInvariantHoister::isIntegerVar (std::wstring varName) {
+  bool isInteger = false;
+  Token varTkn;
+  std::wstring lookUpMsg;
+
+  if (OK == scopedNameSpace->findVar (varName, 0, varTkn, READ_ONLY, lookUpMsg))
+    isInteger = varTkn.isSigned() || varTkn.isUnsigned();
+
+  return isInteger;
+}
+
+/* ****************************************************************************
+ * currNode -> [inv::N]
+ * The original sub-tree moves into [=tmp][inv::N][sub-tree], to be written out
+ * in front of the loop once it closes. Identical sub-trees share a slot.
+ * ***************************************************************************/
+void LoopInvariantHoister::hoistSubTree (std::shared_ptr<ExprTreeNode> currNode) {
+  loopContext & innerLoop = openLoops.back();
+  std::wstring key = makeKey_OLR (currNode);
+  uint32_t slotNum = numSlotsUsed;
+  bool isShared = false;
+
+  for (auto & hoisted : innerLoop.hoisted)  {
+    if (hoisted.key == key)  {
+      slotNum = hoisted.slot_num;
+      isShared = true;
+    }
+  }
+
+  if (!isShared)  {
+    std::shared_ptr<ExprTreeNode> valueNode = std::make_shared<ExprTreeNode> (currNode->originalTkn);
+    valueNode->_1stChild = currNode->_1stChild;
+    valueNode->_2ndChild = currNode->_2ndChild;
+    valueNode->parameter_list = currNode->parameter_list;
+    valueNode->resultTypes = currNode->resultTypes;
+
+    if (valueNode->_1stChild != NULL)
+      valueNode->_1stChild->treeParent = valueNode;
+    if (valueNode->_2ndChild != NULL)
+      valueNode->_2ndChild->treeParent = valueNode;
+    for (auto param : valueNode->parameter_list)
+      param->treeParent = valueNode;
+
+    std::shared_ptr<Token> storeTkn = std::make_shared<Token> (EXEC_OPR8R_TKN, TEMP_STORE_OPR8R);
+    storeTkn->_unsigned = TEMP_STORE_OPR8R_OPCODE;
+    std::shared_ptr<ExprTreeNode> storeNode = std::make_shared<ExprTreeNode> (storeTkn);
+    std::shared_ptr<Token> slotTkn = std::make_shared<Token> (INVARIANT_SLOT_TKN, L"");
+    slotTkn->_unsigned = slotNum;
+    std::shared_ptr<ExprTreeNode> slotNode = std::make_shared<ExprTreeNode> (slotTkn);
+    slotNode->resultTypes = currNode->resultTypes;
+    slotNode->treeParent = storeNode;
+    valueNode->treeParent = storeNode;
+    storeNode->_1stChild = slotNode;
+    storeNode->_2ndChild = valueNode;
+    storeNode->resultTypes = currNode->resultTypes;
+
+    innerLoop.hoisted.push_back ({key, slotNum, storeNode});
+    numSlotsUsed++;
+  }
+
+  std::shared_ptr<Token> slotTkn = std::make_shared<Token> (INVARIANT_SLOT_TKN, L"");
+  slotTkn->_unsigned = slotNum;
+
+  currNode->originalTkn = slotTkn;
+  currNode->_1stChild.reset();
+  currNode->_2ndChild.reset();
+  currNode->parameter_list.clear();
+}
+
+/* ****************************************************************************
+ * Structurally identical sub-trees get identical keys; the data type is part of
+ * a leaf's key so [5] and [5u] don't get mixed up
+ * ***************************************************************************/
+std::wstring LoopInvariantHoister::makeKey_OLR (std::shared_ptr<ExprTreeNode> currNode) {
+  Token & currTkn = *currNode->originalTkn;
+  uint8_t op_code;
+  std::wstring key;
+
+  if (currTkn.tkn_type == SYSTEM_CALL_TKN)  {
+    key = L"sys_call::" + currTkn._string + L"(";
+    for (auto param : currNode->parameter_list)
+      key.append (makeKey_OLR (param) + L",");
+    key.append (L")");
+
+  } else if (isOpr8rNode (currNode, op_code))  {
+    key = L"(" + std::to_wstring(op_code);
+    if (currNode->_1stChild != NULL)
+      key.append (L" " + makeKey_OLR (currNode->_1stChild));
+    if (currNode->_2ndChild != NULL)
+      key.append (L" " + makeKey_OLR (currNode->_2ndChild));
+    key.append (L")");
+
+  } else  {
+    key = std::to_wstring(currTkn.tkn_type) + L":" + currTkn._string + L":" + currTkn.getValueStr();
+  }
+
+  return key;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+bool LoopInvariantHoister::isOpr8rNode (std::shared_ptr<ExprTreeNode> currNode, uint8_t & op_code) {
+  bool isOpr8r = false;
+  op_code = INVALID_OPCODE;
+
+  if (currNode->originalTkn->tkn_type == SRC_OPR8R_TKN) {
+    if (currNode->originalTkn->_string == execTerms.get_statement_ender())
+      op_code = STATEMENT_ENDER_OPR8R_OPCODE;
+    else
+      op_code = execTerms.getOpCodeFor (currNode->originalTkn->_string);
+    isOpr8r = true;
+
+  } else if (currNode->originalTkn->tkn_type == EXEC_OPR8R_TKN) {
+    op_code = currNode->originalTkn->_unsigned;
+    isOpr8r = true;
+  }
+
+  return isOpr8r;
+}
+
+/* ****************************************************************************
+ * Assignments and [pre|post]-fix OPR8Rs change the variable they operate on
+ * ***************************************************************************/
+bool LoopInvariantHoister::isWritingOpr8r (uint8_t op_code) {
+  return ((op_code >= POST_INCR_OPR8R_OPCODE && op_code <= PRE_DECR_OPR8R_OPCODE)
+    || (op_code >= ASSIGNMENT_OPR8R_OPCODE && op_code <= BITWISE_OR_ASSIGN_OPR8R_OPCODE));
+}
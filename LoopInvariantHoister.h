@@ -0,0 +1,101 @@
+/*
+ * LoopInvariantHoister.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ */
+
+#ifndef LOOPINVARIANTHOISTER_H_
+#define LOOPINVARIANTHOISTER_H_
+
+#include <string>
+#include <memory>
+#include <vector>
+#include <set>
+#include <cstdint>
+#include "CompileExecTerms.h"
+#include "ExprTreeNode.h"
+#include "Token.h"
+#include "Utilities.h"
+#include "StackOfScopes.h"
+#include "UserMessages.h"
+
+// Invariant slot # has to fit in INVARIANT_SLOT_OPCODE's 16-bit payload
+#define MAX_INVARIANT_SLOTS  65536
+
+struct hoisted_expr_struct {
+  std::wstring key;                     // Structurally identical sub-trees share a slot
+  uint32_t slot_num;
+  std::shared_ptr<ExprTreeNode> store_tree;   // [=tmp][inv::N][sub-tree] that goes in front of the loop
+};
+
+typedef hoisted_expr_struct hoistedExpr;
+
+struct loop_context_struct {
+  uint8_t opener_opcode;                // [while] or [for]
+  uint32_t loop_start_pos;              // Where the loop object begins in the interpreted file
+  int line_num;
+  std::set<std::wstring> written_vars;  // Anything assigned, [pre|post]-fix'd or declared anywhere in the loop
+  std::set<std::wstring> body_written_vars;   // Same, but only what's written after the control block
+  bool is_body_breaking;                // [break] somewhere in the loop body
+  bool is_body_declaring;               // Variable declared somewhere in the loop body
+  int64_t const_trip_cnt;               // # of trips known at compile time; -1 if it isn't
+  std::vector<hoistedExpr> hoisted;
+};
+
+typedef loop_context_struct loopContext;
+
+// [for] loop control expressions of a counted loop, boiled down
+struct induction_var_struct {
+  std::wstring var_name;
+  uint8_t cond_op_code;                 // [<|<=|>|>=|!=]
+  Token limit_tkn;                      // Literal, unchanging variable or [inv::N]
+  int64_t step;                         // What the last expression adds to var on every trip
+};
+
+typedef induction_var_struct inductionVar;
+
+class LoopInvariantHoister {
+public:
+  LoopInvariantHoister(const CompileExecTerms & inExecTerms, std::shared_ptr<UserMessages> userMessages
+    , std::shared_ptr<StackOfScopes> inVarScopeStack);
+  virtual ~LoopInvariantHoister();
+
+  int openLoop (uint8_t opener_opcode, Token & openingTkn, TokenPtrVector & tknStream, int parenDepth, uint32_t loopStartPos);
+  int hoistInvariants (std::shared_ptr<ExprTreeNode> rootOfExpr);
+  int closeLoop (uint8_t closedScopeOpCode, loopContext & closedLoop);
+  bool isLoopOpen ();
+  bool isCountedLoop (std::shared_ptr<ExprTreeNode> condTree, std::shared_ptr<ExprTreeNode> lastTree, inductionVar & indVar);
+  void setConstTripCount (int64_t numTrips);
+  int getWrittenVars (std::set<std::wstring> & writtenVars);
+
+private:
+  const CompileExecTerms & execTerms;
+  std::shared_ptr<UserMessages> userMessages;
+  std::shared_ptr<StackOfScopes> scopedNameSpace;
+  std::wstring thisSrcFile;
+  Utilities util;
+  int failed_on_src_line;
+  std::vector<loopContext> openLoops;
+  uint32_t numSlotsUsed;
+
+  void collectWrittenVars (TokenPtrVector & tknStream, int parenDepth, loopContext & newLoop);
+  void noteWrittenVar (std::wstring varName, bool isInBody, loopContext & newLoop);
+  int hoistNode_OLR (std::shared_ptr<ExprTreeNode> currNode, bool & isInvariant);
+  void hoistInvariantChildren_OLR (std::shared_ptr<ExprTreeNode> currNode);
+  bool isHoistable (std::shared_ptr<ExprTreeNode> currNode);
+  bool hasVar_OLR (std::shared_ptr<ExprTreeNode> currNode);
+  bool isSafeOpr8r (std::shared_ptr<ExprTreeNode> currNode, uint8_t op_code);
+  bool isInvariantVar (std::wstring varName);
+  bool isUnsignedLeaf (std::shared_ptr<ExprTreeNode> currNode);
+  bool isNonNegativeLiteral (std::shared_ptr<ExprTreeNode> currNode, uint64_t & value);
+  bool isIntegerVar (std::wstring varName);
+  void hoistSubTree (std::shared_ptr<ExprTreeNode> currNode);
+  std::wstring makeKey_OLR (std::shared_ptr<ExprTreeNode> currNode);
+
+  bool isOpr8rNode (std::shared_ptr<ExprTreeNode> currNode, uint8_t & op_code);
+  bool isWritingOpr8r (uint8_t op_code);
+
+};
+
+#endif /* LOOPINVARIANTHOISTER_H_ */
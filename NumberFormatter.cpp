@@ -0,0 +1,85 @@
+/*
+ * NumberFormatter.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ *
+ * Turns numbers into wide characters with std::to_chars.  Digits get written
+ * into a buffer on the stack, then appended onto the caller's string, so there
+ * are no stream objects or locales involved and no temporary strings to throw
+ * away.
+ *
+ * Doubles come out as the fewest digits that read back in as the exact same
+ * double, e.g. 0.1 rather than 0.100000.  A whole number double keeps a ".0" so
+ * it still looks like a double rather than an integer.
+ */
+
+#include "NumberFormatter.h"
+#include <charconv>
+
+/* ****************************************************************************
+ * Lower case, no leading zeroes; 255 -> 0xff
+ * ***************************************************************************/
+void NumberFormatter::appendHex (std::wstring & outStr, uint64_t value)  {
+  char digits [NUM_FORMAT_BUF_SIZE];
+  std::to_chars_result result = std::to_chars (digits, digits + NUM_FORMAT_BUF_SIZE, value, 16);
+
+  outStr.append (L"0x");
+  appendChars (outStr, digits, result.ptr);
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+void NumberFormatter::appendUnsigned (std::wstring & outStr, uint64_t value)  {
+  char digits [NUM_FORMAT_BUF_SIZE];
+  std::to_chars_result result = std::to_chars (digits, digits + NUM_FORMAT_BUF_SIZE, value);
+
+  appendChars (outStr, digits, result.ptr);
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+void NumberFormatter::appendSigned (std::wstring & outStr, int64_t value)  {
+  char digits [NUM_FORMAT_BUF_SIZE];
+  std::to_chars_result result = std::to_chars (digits, digits + NUM_FORMAT_BUF_SIZE, value);
+
+  appendChars (outStr, digits, result.ptr);
+}
+
+/* ****************************************************************************
+ * Shortest round trip; 2.5 -> 2.5, -5 -> -5.0, 1e+100 stays as is
+ * ***************************************************************************/
+void NumberFormatter::appendDouble (std::wstring & outStr, double value)  {
+  char digits [NUM_FORMAT_BUF_SIZE];
+  std::to_chars_result result = std::to_chars (digits, digits + NUM_FORMAT_BUF_SIZE, value);
+  bool isWholeLooking = true;
+
+  for (const char * nxtChar = digits; nxtChar < result.ptr && isWholeLooking; nxtChar++)  {
+    // Covers '.', exponents, inf & nan
+    if (*nxtChar != '-' && (*nxtChar < '0' || *nxtChar > '9'))
+      isWholeLooking = false;
+  }
+
+  appendChars (outStr, digits, result.ptr);
+
+  if (isWholeLooking)
+    outStr.append (L".0");
+}
+
+/* ****************************************************************************
+ * For the odd error message that wants a hex value on its own
+ * ***************************************************************************/
+std::wstring NumberFormatter::toHexStr (uint64_t value)  {
+  std::wstring hexStr;
+  appendHex (hexStr, value);
+  return (hexStr);
+}
+
+/* ****************************************************************************
+ * Every character to_chars writes is plain ASCII, so widening is just a copy
+ * ***************************************************************************/
+void NumberFormatter::appendChars (std::wstring & outStr, const char * firstChar, const char * lastChar)  {
+  outStr.append (firstChar, lastChar);
+}
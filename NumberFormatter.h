@@ -0,0 +1,30 @@
+/*
+ * NumberFormatter.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ */
+
+#ifndef NUMBERFORMATTER_H_
+#define NUMBERFORMATTER_H_
+
+#include <string>
+#include <cstdint>
+
+// Big enough for the longest shortest round trip double, e.g. -2.2250738585072014e-308
+#define NUM_FORMAT_BUF_SIZE   64
+
+class NumberFormatter {
+public:
+  static void appendHex (std::wstring & outStr, uint64_t value);
+  static void appendUnsigned (std::wstring & outStr, uint64_t value);
+  static void appendSigned (std::wstring & outStr, int64_t value);
+  static void appendDouble (std::wstring & outStr, double value);
+
+  static std::wstring toHexStr (uint64_t value);
+
+private:
+  static void appendChars (std::wstring & outStr, const char * firstChar, const char * lastChar);
+};
+
+#endif /* NUMBERFORMATTER_H_ */
@@ -62,7 +62,11 @@
 #define BITWISE_OR_ASSIGN_OPR8R_OPCODE  0x27    // "|="
 #define STATEMENT_ENDER_OPR8R_OPCODE    0x28    // ";", STATEMENT_ENDER
 #define BREAK_OPR8R_OPCODE              0x29
-#define LAST_VALID_OPR8R_OPCODE         0x29    // Change this value if new op_codes in this range are created
+#define TEMP_STORE_OPR8R_OPCODE         0x2A    // [=tmp][TEMP_SLOT|INVARIANT_SLOT][expression]; generated by the optimizer
+#define LOOKUP_SELECT_OPR8R_OPCODE      0x2B    // [?sel][# of keys][selector][sorted keys][values][default]; generated by the optimizer
+#define CONCAT_N_OPR8R_OPCODE           0x2C    // [+cat][# of pieces][piece]+; generated by the optimizer
+#define ARRAY_ELEMENT_OPR8R_OPCODE      0x2D    // [@elm][array name][index expression]; what the compiler makes out of "name[index]"
+#define LAST_VALID_OPR8R_OPCODE         0x2D    // Change this value if new op_codes in this range are created
 
 // [0x30-0x3F] is reserved for self-contained, single 8-bit BYTE data type op_codes
 #define FIRST_VALID_DATA_TYPE_OPCODE    0x30
@@ -87,10 +91,13 @@
 #define UINT8_OPCODE                    0x40  // [op_code][8-bit #]
 #define INT8_OPCODE                     0x42  // [op_code][8-bit #]
 #define BOOL_DATA_OPCODE                0x43
+#define TEMP_SLOT_OPCODE                0x44  // [op_code][8-bit temp slot #]; value saved earlier in the same expression
+#define SYSTEM_CALL_ID_OPCODE           0x45  // [op_code][8-bit system call ID]; see CompileExecTerms for the table of IDs
 
 // Opcodes [0x48-0x4F] have a 16-bit payload
 #define UINT16_OPCODE                   0x48  // [op_code][16-bit #]
 #define INT16_OPCODE                    0x49  // [op_code][16-bit #]
+#define INVARIANT_SLOT_OPCODE           0x4A  // [op_code][16-bit invariant slot #]; value saved in front of the enclosing loop
 
 // Opcodes [0x50-0x57] have a 32-bit payload
 #define UINT32_OPCODE                   0x50  // [op_code][32-bit #]
@@ -109,10 +116,11 @@
 #define STRING_OPCODE                   0x60  // [op_code][total_length][string]
 #define USER_VAR_OPCODE                 0x61  // [op_code][total_length][STRING_OPCODE string] for scalar variable
                                               // [op_code][total_length][STRING_OPCODE string] [string|integer]+ for array variable
+                                              // An array's declaration carries a single integer; its # of elements
 
 #define DATETIME_OPCODE                 0x62  // [op_code][total_length][datetime string]
 #define DOUBLE_OPCODE                   0x63  // [op_code][total_length][double string]
-#define SYSTEM_CALL_OPCODE              0x64  // [op_code][total_length][system_call name string]
+#define SYSTEM_CALL_OPCODE              0x64  // [op_code][total_length][system_call name string]; no longer written, see SYSTEM_CALL_ID_OPCODE
 #define USER_FXN_CALL_OPCODE            0x65  // [op_code][total_length][user_fxn_call name string]
 
 // TODO: Should code_blocks also have their own total_length field?
@@ -128,7 +136,10 @@
 #define ANON_SCOPE_OPCODE               0x6E  // [op_code][total_length][code block]
 #define VARIABLES_DECLARATION_OPCODE    0x6F  // [op_code][total_length][datatype op_code][[string var_name][init_expression]]+
 #define USER_FXN_DECLARATION_OPCODE     0x70  // [op_code][total_length][string fxn_name][parameter type list][parameter name list]
-#define LAST_VALID_FLEX_LEN_OPCODE      0x70  // Change this value if new flexible length op_codes in this range are created
+#define COUNTED_FOR_SCOPE_OPCODE        0x71  // Same layout as FOR_SCOPE_OPCODE; trip count gets computed once at loop entry
+#define UNROLLED_FOR_SCOPE_OPCODE       0x72  // [op_code][total_length][init_expression][last_expression][repeat count][trips per block][code_block length][unrolled block][remainder block]
+#define BLOCK_PROFILE_OPCODE            0x73  // [op_code][total_length][line #][column #]; counts a block's runs when profiling
+#define LAST_VALID_FLEX_LEN_OPCODE      0x73  // Change this value if new flexible length op_codes in this range are created
 
 // TODO: What about SPR8Rs?
 // this->_1char_spr8rs = L"()[]{}"; [ASCII - 0x28,0x29,0x5B,0x5D,0x7B,0x7D]
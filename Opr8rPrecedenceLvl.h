@@ -8,7 +8,7 @@
 #ifndef OPR8RPRECEDENCELVL_H_
 #define OPR8RPRECEDENCELVL_H_
 
-#include <list>
+#include <vector>
 #include "Operator.h"
 
 class Opr8rPrecedenceLvl {
@@ -16,7 +16,7 @@ public:
   Opr8rPrecedenceLvl();
   virtual ~Opr8rPrecedenceLvl();
 
-  std::list<Operator> opr8rs;
+  std::vector<Operator> opr8rs;
 };
 
 #endif /* OPR8RPRECEDENCELVL_H_ */
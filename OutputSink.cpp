@@ -0,0 +1,206 @@
+/*
+ * OutputSink.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ *
+ * Where the user's program output (print_line) goes.  Lines get encoded to
+ * UTF-8 into a large buffer, and the buffer gets written out according to the
+ * flush policy, rather than paying for a flush and a trip through the locale
+ * machinery on every line.
+ *
+ * Stdout gets written to by file descriptor so the bytes go out exactly as
+ * encoded.  Anything std::wcout has buffered up goes out 1st, so the program's
+ * output stays in order with the rest of what gets displayed.
+ */
+
+#include "OutputSink.h"
+#include <iostream>
+#include <cstdio>
+#include <cerrno>
+#include <cstdint>
+#include <unistd.h>
+#include "common.h"
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+OutputSink::OutputSink(sinkDestEnum inDest, flushPolicyEnum inFlushPolicy, std::string inFileName) {
+  dest = inDest;
+  flush_policy = inFlushPolicy;
+  file_name = inFileName;
+  is_failed = false;
+
+  if (dest == SINK_TO_FILE || dest == SINK_APPEND_TO_FILE)  {
+    file_stream.open (file_name, std::ios::out | std::ios::binary | (dest == SINK_TO_FILE ? std::ios::trunc : std::ios::app));
+    is_failed = !file_stream.is_open();
+  }
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+OutputSink::~OutputSink() {
+  flush();
+
+  if (file_stream.is_open())
+    file_stream.close();
+}
+
+/* ****************************************************************************
+ * Output is going to a terminal if it's line buffered; otherwise big writes
+ * ***************************************************************************/
+flushPolicyEnum OutputSink::getDefaultFlushPolicy (sinkDestEnum dest)  {
+  flushPolicyEnum policy = FLUSH_ON_SIZE;
+
+  if (dest == SINK_TO_STDOUT && isatty (STDOUT_FILENO))
+    policy = FLUSH_EACH_LINE;
+
+  return (policy);
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+bool OutputSink::isOpen ()  {
+  return (!is_failed);
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+int OutputSink::writeLine (const std::wstring & textLine)  {
+  return (bufferText (textLine, true));
+}
+
+/* ****************************************************************************
+ * No line ending gets added
+ * ***************************************************************************/
+int OutputSink::writeText (const std::wstring & text)  {
+  return (bufferText (text, false));
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+int OutputSink::bufferText (const std::wstring & text, bool isEndOfLine)  {
+  int ret_code = GENERAL_FAILURE;
+
+  if (!is_failed)  {
+    if (buffer.capacity() < OUTPUT_SINK_BUFFER_SIZE)
+      buffer.reserve (OUTPUT_SINK_BUFFER_SIZE);
+
+    appendUtf8 (text, buffer);
+    if (isEndOfLine)
+      buffer.push_back ('\n');
+
+    if ((flush_policy == FLUSH_EACH_LINE && isEndOfLine) || (flush_policy == FLUSH_ON_SIZE && buffer.size() >= OUTPUT_SINK_BUFFER_SIZE))
+      ret_code = flush();
+    else
+      ret_code = OK;
+  }
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ * Write out everything buffered so far, no matter the flush policy
+ * ***************************************************************************/
+int OutputSink::flush ()  {
+  int ret_code = GENERAL_FAILURE;
+
+  if (is_failed)  {
+    // Already failed; don't keep trying
+
+  } else if (buffer.empty())  {
+    ret_code = OK;
+
+  } else if (dest == SINK_TO_STDOUT)  {
+    ret_code = writeToStdout();
+
+  } else if (dest == SINK_TO_FILE || dest == SINK_APPEND_TO_FILE)  {
+    file_stream.write (buffer.data(), buffer.size());
+    file_stream.flush();
+    if (file_stream.good())
+      ret_code = OK;
+
+  } else if (dest == SINK_TO_MEMORY)  {
+    memory_contents.append (buffer);
+    ret_code = OK;
+  }
+
+  if (OK == ret_code)
+    buffer.clear();
+  else
+    is_failed = true;
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ * Everything written to a SINK_TO_MEMORY sink, flushed or not
+ * ***************************************************************************/
+const std::string & OutputSink::getContents ()  {
+  if (dest == SINK_TO_MEMORY)
+    flush();
+
+  return (memory_contents);
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+int OutputSink::writeToStdout ()  {
+  int ret_code = OK;
+  size_t num_written = 0;
+
+  std::wcout.flush();
+  std::fflush (stdout);
+
+  while (num_written < buffer.size() && OK == ret_code)  {
+    ssize_t write_cnt = write (STDOUT_FILENO, buffer.data() + num_written, buffer.size() - num_written);
+
+    if (write_cnt > 0)
+      num_written += write_cnt;
+    else if (write_cnt < 0 && errno == EINTR)
+      // Interrupted before anything got written; try again
+      ;
+    else
+      ret_code = GENERAL_FAILURE;
+  }
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ * wchar_t holds a whole code point; anything that isn't a valid one becomes
+ * U+FFFD
+ * ***************************************************************************/
+void OutputSink::appendUtf8 (const std::wstring & text, std::string & utf8)  {
+
+  for (wchar_t wideChar : text)  {
+    uint32_t codePoint = (uint32_t) wideChar;
+
+    if (codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+      codePoint = 0xFFFD;
+
+    if (codePoint < 0x80)  {
+      utf8.push_back ((char) codePoint);
+
+    } else if (codePoint < 0x800)  {
+      utf8.push_back ((char) (0xC0 | (codePoint >> 6)));
+      utf8.push_back ((char) (0x80 | (codePoint & 0x3F)));
+
+    } else if (codePoint < 0x10000)  {
+      utf8.push_back ((char) (0xE0 | (codePoint >> 12)));
+      utf8.push_back ((char) (0x80 | ((codePoint >> 6) & 0x3F)));
+      utf8.push_back ((char) (0x80 | (codePoint & 0x3F)));
+
+    } else  {
+      utf8.push_back ((char) (0xF0 | (codePoint >> 18)));
+      utf8.push_back ((char) (0x80 | ((codePoint >> 12) & 0x3F)));
+      utf8.push_back ((char) (0x80 | ((codePoint >> 6) & 0x3F)));
+      utf8.push_back ((char) (0x80 | (codePoint & 0x3F)));
+    }
+  }
+}
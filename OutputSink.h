@@ -0,0 +1,60 @@
+/*
+ * OutputSink.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ */
+
+#ifndef OUTPUTSINK_H_
+#define OUTPUTSINK_H_
+
+#include <string>
+#include <fstream>
+
+#define OUTPUT_SINK_BUFFER_SIZE   0x10000
+
+enum sink_dest_enum {
+  SINK_TO_STDOUT
+  ,SINK_TO_FILE
+  ,SINK_APPEND_TO_FILE      // Like SINK_TO_FILE, but keeps what the file already had
+  ,SINK_TO_MEMORY           // Everything written stays in memory; see getContents
+};
+
+typedef sink_dest_enum sinkDestEnum;
+
+enum flush_policy_enum {
+  FLUSH_EACH_LINE           // What a user watching a terminal expects
+  ,FLUSH_ON_SIZE            // Write out whenever the buffer fills up
+  ,FLUSH_AT_EXIT            // Hold everything until the program is done running
+};
+
+typedef flush_policy_enum flushPolicyEnum;
+
+class OutputSink {
+public:
+  OutputSink(sinkDestEnum inDest, flushPolicyEnum inFlushPolicy, std::string inFileName);
+  virtual ~OutputSink();
+
+  bool isOpen ();
+  int writeLine (const std::wstring & textLine);
+  int writeText (const std::wstring & text);
+  int flush ();
+  const std::string & getContents ();
+
+  static flushPolicyEnum getDefaultFlushPolicy (sinkDestEnum dest);
+  static void appendUtf8 (const std::wstring & text, std::string & utf8);
+
+private:
+  sinkDestEnum dest;
+  flushPolicyEnum flush_policy;
+  std::string file_name;
+  std::ofstream file_stream;
+  std::string buffer;
+  std::string memory_contents;
+  bool is_failed;
+
+  int bufferText (const std::wstring & text, bool isEndOfLine);
+  int writeToStdout ();
+};
+
+#endif /* OUTPUTSINK_H_ */
@@ -113,16 +113,19 @@
 #include "CompileExecTerms.h"
 #include "ExprTreeNode.h"
 #include "FileLineCol.h"
+#include "NumberFormatter.h"
 #include "OpCodes.h"
 #include "Operator.h"
 #include "Token.h"
 #include "TokenCompareResult.h"
 #include <cassert>
 #include <climits>
+#include <cmath>
 #include <cstdint>
+#include <cwchar>
+#include <cwctype>
 #include <iostream>
 #include <memory>
-#include <sstream>
 #include <string>
 #include <vector>
 #include "InfoWarnError.h"
@@ -131,28 +134,14 @@
 #include "common.h"
 
 /* ****************************************************************************
- * This constructor should never get called
+ * Compile time checks are done by TypeChecker, so the interpreter only ever
+ * runs an interpreted file
  * ***************************************************************************/
-RunTimeInterpreter::RunTimeInterpreter() {
-  one_tkn = std::make_shared<Token> (UINT64_TKN, L"1");
-  // TODO: Token value not automatically filled in currently
-  one_tkn->_unsigned = 1;
-  one_tkn->isInitialized = true;
-  zero_tkn = std::make_shared<Token> (UINT64_TKN, L"0");
-  zero_tkn->_unsigned = 0;
-  zero_tkn->isInitialized = true;
-  this_src_file = util.getLastSegment(util.stringToWstring(__FILE__), L"/");
-  failed_on_src_line = 0;
-  log_level = SILENT;
-  is_illustrative = false;
-  assert(0);
-}
-
-/* ****************************************************************************
- * This is the COMPILE_TIME constructor call
- * ***************************************************************************/
-RunTimeInterpreter::RunTimeInterpreter(CompileExecTerms & execTerms, std::shared_ptr<StackOfScopes> inVarScopeStack
-    , std::wstring userSrcFileName, std::shared_ptr<UserMessages> userMessages, logLvlEnum logLvl) {
+RunTimeInterpreter::RunTimeInterpreter(const CompileExecTerms & execTerms, std::string interpretedFileName, std::wstring userSrcFileName
+  , std::shared_ptr<StackOfScopes> inVarScope,  std::shared_ptr<UserMessages> userMessages, logLvlEnum logLvl
+  , std::shared_ptr<BlockProfile> blockProfile, std::shared_ptr<OutputSink> outputSink)
+    : exec_terms (execTerms)
+    , file_reader (interpretedFileName, execTerms) {
   one_tkn = std::make_shared<Token> (UINT64_TKN, L"1");
   // TODO: Token value not automatically filled in currently
   one_tkn->_unsigned = 1;
@@ -161,26 +150,26 @@ RunTimeInterpreter::RunTimeInterpreter(CompileExecTerms & execTerms, std::shared
   zero_tkn->_unsigned = 0;
   zero_tkn->isInitialized = true;
 
-  this->exec_terms = execTerms;
   this_src_file = util.getLastSegment(util.stringToWstring(__FILE__), L"/");
-  scope_name_space = inVarScopeStack;
+  scope_name_space = inVarScope;
   this->user_messages = userMessages;
   this->usr_src_file_name = userSrcFileName;
   failed_on_src_line = 0;
   log_level = logLvl;
   is_illustrative = false;
-  usage_mode = COMPILE_TIME;
+  block_profile = blockProfile;
+  output_sink = outputSink;
 }
 
 /* ****************************************************************************
- * This is the INTERPRETER mode constructor call
+ * Expression only; there's no interpreted file behind this one.  ConstantFolder
+ * uses it to resolve constant sub-expressions at compile time with the exact
+ * same OPR8R implementations the interpreted file will get at run time.
  * ***************************************************************************/
-RunTimeInterpreter::RunTimeInterpreter(std::string interpretedFileName, std::wstring userSrcFileName
-  , std::shared_ptr<StackOfScopes> inVarScope,  std::shared_ptr<UserMessages> userMessages, logLvlEnum logLvl)
-    : exec_terms ()
-    , file_reader (interpretedFileName, exec_terms) {
+RunTimeInterpreter::RunTimeInterpreter(const CompileExecTerms & execTerms, std::wstring userSrcFileName
+  , std::shared_ptr<StackOfScopes> inVarScope,  std::shared_ptr<UserMessages> userMessages)
+    : exec_terms (execTerms) {
   one_tkn = std::make_shared<Token> (UINT64_TKN, L"1");
-  // TODO: Token value not automatically filled in currently
   one_tkn->_unsigned = 1;
   one_tkn->isInitialized = true;
   zero_tkn = std::make_shared<Token> (UINT64_TKN, L"0");
@@ -192,10 +181,9 @@ RunTimeInterpreter::RunTimeInterpreter(std::string interpretedFileName, std::wst
   this->user_messages = userMessages;
   this->usr_src_file_name = userSrcFileName;
   failed_on_src_line = 0;
-  log_level = logLvl;
+  log_level = SILENT;
   is_illustrative = false;
-  usage_mode = INTERPRETER;
-
+  output_sink = std::make_shared<OutputSink> (SINK_TO_STDOUT, FLUSH_EACH_LINE, "");
 }
 
 /* ****************************************************************************
@@ -222,30 +210,28 @@ int RunTimeInterpreter::execRootScope() {
   uint32_t root_scope_len;
   uint32_t break_scope_end_pos;
 
-  if (usage_mode == INTERPRETER)  {
-    file_reader.setPos(0);
-    if (OK != file_reader.readNextByte(root_scope_op_code) || root_scope_op_code != ANON_SCOPE_OPCODE)
-      user_messages->logMsg(INTERNAL_ERROR, L"Failure reading ROOT scope op_code", this_src_file, failed_on_src_line, 0);
-    
-    else if (OK != file_reader.readNextDword(root_scope_len))
-      user_messages->logMsg(INTERNAL_ERROR, L"Failure reading ROOT scope length", this_src_file, failed_on_src_line, 0);
+  file_reader.setPos(0);
+  if (OK != file_reader.readNextByte(root_scope_op_code) || root_scope_op_code != ANON_SCOPE_OPCODE)
+    user_messages->logMsg(INTERNAL_ERROR, L"Failure reading ROOT scope op_code", this_src_file, failed_on_src_line, 0);
+  
+  else if (OK != file_reader.readNextDword(root_scope_len))
+    user_messages->logMsg(INTERNAL_ERROR, L"Failure reading ROOT scope length", this_src_file, failed_on_src_line, 0);
 
-    else {
-      ret_code = execCurrScope (file_reader.getPos(), root_scope_len, break_scope_end_pos);
-    }
+  else {
+    ret_code = execCurrScope (file_reader.getPos(), root_scope_len, break_scope_end_pos);
   }
 
   return (ret_code);
 }
 
 /* ****************************************************************************
- * Check if we're in the right mode, and be sure we're not nested inside a loop
+ * Check the log level, and be sure we're not nested inside a loop
  * ***************************************************************************/
  bool RunTimeInterpreter::isOkToIllustrate ()  {
   bool isOK = false;
   uint32_t loop_boundary_end_pos;
   
-  if (usage_mode == INTERPRETER && log_level >= ILLUSTRATIVE && !scope_name_space->isInsideLoop(loop_boundary_end_pos, false))
+  if (log_level >= ILLUSTRATIVE && !scope_name_space->isInsideLoop(loop_boundary_end_pos, false))
     isOK = true;
 
   return isOK;
@@ -270,150 +256,151 @@ int RunTimeInterpreter::execCurrScope (uint32_t exec_start_pos, uint32_t after_s
   uint32_t obj_start_pos;
   uint32_t object_len;
   bool is_done = false;
-  std::wstringstream hex_stream;
-  std::wstringstream obj_start_pos_str;
-
-  if (usage_mode == INTERPRETER)  {
 
-    // Make sure we're starting off at right position
-    file_reader.setPos(exec_start_pos);
-    break_scope_end_pos = 0;
-
-    while (!is_done && !failed_on_src_line) {
-      obj_start_pos = file_reader.getPos();
+  // Make sure we're starting off at right position
+  file_reader.setPos(exec_start_pos);
+  break_scope_end_pos = 0;
 
-      obj_start_pos_str.str(L"");
-      obj_start_pos_str << L"0x" << std::hex << obj_start_pos;
+  while (!is_done && !failed_on_src_line) {
+    obj_start_pos = file_reader.getPos();
 
-      if (file_reader.isEOF())
-        is_done = true;
+    if (file_reader.isEOF())
+      is_done = true;
 
-      else if (obj_start_pos == after_scope_bndry)
-        // scopeEndPos > 0 means non-global scope and whole scope processed
-        is_done = true;
+    else if (obj_start_pos == after_scope_bndry)
+      // scopeEndPos > 0 means non-global scope and whole scope processed
+      is_done = true;
 
-      else if (OK != file_reader.peekNextByte(op_code)) {
-        // TODO: isEOF doesn't seem to work. What's the issue?
-        is_done = true;
-        if (exec_start_pos > 0) {
-          SET_FAILED_ON_SRC_LINE;
-          user_messages->logMsg(INTERNAL_ERROR, L"Failed while peeking next op_code in non-global scope"
-            , this_src_file, failed_on_src_line, 0);
-        }
+    else if (OK != file_reader.peekNextByte(op_code)) {
+      // TODO: isEOF doesn't seem to work. What's the issue?
+      is_done = true;
+      if (exec_start_pos > 0) {
+        SET_FAILED_ON_SRC_LINE;
+        user_messages->logMsg(INTERNAL_ERROR, L"Failed while peeking next op_code in non-global scope"
+          , this_src_file, failed_on_src_line, 0);
+      }
 
-      } else if (OK != file_reader.readNextByte (op_code))  {
+    } else if (OK != file_reader.readNextByte (op_code))  {
+      SET_FAILED_ON_SRC_LINE;
+    
+    } else if (op_code == BREAK_OPR8R_OPCODE) {
+      scope_name_space->isInsideLoop(break_scope_end_pos, true);
+      
+      if (0 == break_scope_end_pos) {
+        // [break] statement MUST be inside a loop and this one wasn't
         SET_FAILED_ON_SRC_LINE;
       
-      } else if (op_code == BREAK_OPR8R_OPCODE) {
-        scope_name_space->isInsideLoop(break_scope_end_pos, true);
-        
-        if (0 == break_scope_end_pos) {
-          // [break] statement MUST be inside a loop and this one wasn't
-          SET_FAILED_ON_SRC_LINE;
-        
-        } else {
-          is_done = true;
+      } else {
+        is_done = true;
 
-        }
-      } else if (op_code >= FIRST_VALID_FLEX_LEN_OPCODE && op_code <= LAST_VALID_FLEX_LEN_OPCODE)   {
-        if (OK != file_reader.readNextDword (object_len)) {
-          SET_FAILED_ON_SRC_LINE;
-          hex_stream.str(L"");
-          hex_stream << L"0x" << std::hex << op_code;
-          std::wstring msg = L"Failed to get length of object (opcode = ";
-          msg.append(hex_stream.str());
-          msg.append(L") starting at ");
-          msg.append(obj_start_pos_str.str());
-          user_messages->logMsg(INTERNAL_ERROR, msg, this_src_file, failed_on_src_line, 0);
+      }
+    } else if (op_code >= FIRST_VALID_FLEX_LEN_OPCODE && op_code <= LAST_VALID_FLEX_LEN_OPCODE)   {
+      if (OK != file_reader.readNextDword (object_len)) {
+        SET_FAILED_ON_SRC_LINE;
+        std::wstring msg = L"Failed to get length of object (opcode = ";
+        NumberFormatter::appendHex (msg, op_code);
+        msg.append(L") starting at ");
+        NumberFormatter::appendHex (msg, obj_start_pos);
+        user_messages->logMsg(INTERNAL_ERROR, msg, this_src_file, failed_on_src_line, 0);
 
-        } else {
-          if (op_code == VARIABLES_DECLARATION_OPCODE)  {
-            if (OK != execVarDeclaration (obj_start_pos, object_len)) {
-              SET_FAILED_ON_SRC_LINE;
-            }
+      } else {
+        if (op_code == VARIABLES_DECLARATION_OPCODE)  {
+          if (OK != execVarDeclaration (obj_start_pos, object_len)) {
+            SET_FAILED_ON_SRC_LINE;
+          }
 
-          } else if (op_code == EXPRESSION_OPCODE)  {   
-            Token result_tkn; 
-            is_illustrative = isOkToIllustrate();
+        } else if (op_code == EXPRESSION_OPCODE)  {   
+          Token result_tkn; 
+          is_illustrative = isOkToIllustrate();
 
-            if (is_illustrative)
-              std::wcout << L"// ILLUSTRATIVE MODE: Flattened expression resolved below" << std::endl << std::endl;
+          if (is_illustrative)
+            std::wcout << L"// ILLUSTRATIVE MODE: Flattened expression resolved below" << std::endl << std::endl;
 
-            
-            if (OK != execExpression (obj_start_pos, result_tkn)) {
-              SET_FAILED_ON_SRC_LINE;
-            }
-            is_illustrative = false;
           
-          } else if (op_code == IF_SCOPE_OPCODE)  { 
-            if (OK != exec_if_block (obj_start_pos, object_len, after_scope_bndry, break_scope_end_pos))  {
-              SET_FAILED_ON_SRC_LINE;
-            
-            } else if (break_scope_end_pos >= after_scope_bndry)  {
-              // [break]ing out of the current scope; no need to retain the info
-              // TODO: Wouldn't this be a failure?
-              is_done = true;
-            }
-
-          } else if (op_code == ELSE_IF_SCOPE_OPCODE) {           
+          if (OK != execExpression (obj_start_pos, result_tkn)) {
             SET_FAILED_ON_SRC_LINE;
-            user_messages->logMsg(INTERNAL_ERROR, L"Floating [else if] block encountered at " + obj_start_pos_str.str(), this_src_file, failed_on_src_line, 0);
-
-          } else if (op_code == ELSE_SCOPE_OPCODE)  {               
+          }
+          is_illustrative = false;
+        
+        } else if (op_code == IF_SCOPE_OPCODE)  { 
+          if (OK != exec_if_block (obj_start_pos, object_len, after_scope_bndry, break_scope_end_pos))  {
             SET_FAILED_ON_SRC_LINE;
-            user_messages->logMsg(INTERNAL_ERROR, L"Floating [else] block encountered at " + obj_start_pos_str.str(), this_src_file, failed_on_src_line, 0);
-
-          } else if (op_code == WHILE_SCOPE_OPCODE) {               
-            if (OK != exec_while_loop (obj_start_pos, object_len, after_scope_bndry, break_scope_end_pos))  {
-              SET_FAILED_ON_SRC_LINE;
+          
+          } else if (break_scope_end_pos >= after_scope_bndry)  {
+            // [break]ing out of the current scope; no need to retain the info
+            // TODO: Wouldn't this be a failure?
+            is_done = true;
+          }
 
-            } else if (break_scope_end_pos >= after_scope_bndry)  {
-              // [break]ing out of the current scope; no need to retain the info
-              // TODO: Wouldn't this be a failure?
-              is_done = true;
-              // TODO: break_scope_end_pos = 0;
+        } else if (op_code == ELSE_IF_SCOPE_OPCODE) {           
+          SET_FAILED_ON_SRC_LINE;
+          user_messages->logMsg(INTERNAL_ERROR, L"Floating [else if] block encountered at " + NumberFormatter::toHexStr (obj_start_pos), this_src_file, failed_on_src_line, 0);
 
-            }
+        } else if (op_code == ELSE_SCOPE_OPCODE)  {               
+          SET_FAILED_ON_SRC_LINE;
+          user_messages->logMsg(INTERNAL_ERROR, L"Floating [else] block encountered at " + NumberFormatter::toHexStr (obj_start_pos), this_src_file, failed_on_src_line, 0);
 
-          } else if (op_code == FOR_SCOPE_OPCODE) {                 
-            if (OK != exec_for_loop (obj_start_pos, object_len, after_scope_bndry, break_scope_end_pos))  {
-              SET_FAILED_ON_SRC_LINE;
+        } else if (op_code == WHILE_SCOPE_OPCODE) {               
+          if (OK != exec_while_loop (obj_start_pos, object_len, after_scope_bndry, break_scope_end_pos))  {
+            SET_FAILED_ON_SRC_LINE;
 
-            } else if (break_scope_end_pos >= after_scope_bndry)  {
-              // [break]ing out of the current scope; no need to retain the info
-              // TODO: Wouldn't this be a failure?
-              is_done = true;
-              // TODO: break_scope_end_pos = 0;
+          } else if (break_scope_end_pos >= after_scope_bndry)  {
+            // [break]ing out of the current scope; no need to retain the info
+            // TODO: Wouldn't this be a failure?
+            is_done = true;
+            // TODO: break_scope_end_pos = 0;
 
-            }
+          }
 
-          } else if (op_code == ANON_SCOPE_OPCODE)  {               
+        } else if (op_code == FOR_SCOPE_OPCODE || op_code == COUNTED_FOR_SCOPE_OPCODE) {                 
+          if (OK != exec_for_loop (op_code, obj_start_pos, object_len, after_scope_bndry, break_scope_end_pos))  {
             SET_FAILED_ON_SRC_LINE;
-            user_messages->logMsg(INTERNAL_ERROR, L"NOT SUPPORTED YET!", this_src_file, failed_on_src_line, 0);
 
-          } else if (op_code == USER_FXN_DECLARATION_OPCODE)  {         
-            SET_FAILED_ON_SRC_LINE;
-            user_messages->logMsg(INTERNAL_ERROR, L"NOT SUPPORTED YET!", this_src_file, failed_on_src_line, 0);
+          } else if (break_scope_end_pos >= after_scope_bndry)  {
+            // [break]ing out of the current scope; no need to retain the info
+            // TODO: Wouldn't this be a failure?
+            is_done = true;
+            // TODO: break_scope_end_pos = 0;
 
-          } else if (op_code == USER_FXN_CALL_OPCODE) {                 
-            SET_FAILED_ON_SRC_LINE;
-            user_messages->logMsg(INTERNAL_ERROR, L"NOT SUPPORTED YET!", this_src_file, failed_on_src_line, 0);
+          }
 
-          } else if (op_code == SYSTEM_CALL_OPCODE) {             
+        } else if (op_code == UNROLLED_FOR_SCOPE_OPCODE) {
+          if (OK != exec_unrolled_for_loop (obj_start_pos, object_len, break_scope_end_pos))  {
             SET_FAILED_ON_SRC_LINE;
-            // TODO: Will stand-alone system calls be wrapped inside an expression?  Probably.....
-            user_messages->logMsg(INTERNAL_ERROR, L"NOT SUPPORTED YET!", this_src_file, failed_on_src_line, 0);
 
-          } else {
-            SET_FAILED_ON_SRC_LINE;
-            hex_stream.str(L"");
-            hex_stream << L"0x" << std::hex << op_code;
-            std::wstring msg = L"Unknown opcode [";
-            msg.append(hex_stream.str());
-            msg.append(L"] found at ");
-            msg.append(obj_start_pos_str.str());
-            user_messages->logMsg(INTERNAL_ERROR, msg, this_src_file, failed_on_src_line, 0);
+          } else if (break_scope_end_pos >= after_scope_bndry)  {
+            // [break]ing out of the current scope
+            is_done = true;
           }
+
+        } else if (op_code == BLOCK_PROFILE_OPCODE) {
+          if (OK != exec_block_profile (obj_start_pos, object_len))
+            SET_FAILED_ON_SRC_LINE;
+
+        } else if (op_code == ANON_SCOPE_OPCODE)  {               
+          SET_FAILED_ON_SRC_LINE;
+          user_messages->logMsg(INTERNAL_ERROR, L"NOT SUPPORTED YET!", this_src_file, failed_on_src_line, 0);
+
+        } else if (op_code == USER_FXN_DECLARATION_OPCODE)  {         
+          SET_FAILED_ON_SRC_LINE;
+          user_messages->logMsg(INTERNAL_ERROR, L"NOT SUPPORTED YET!", this_src_file, failed_on_src_line, 0);
+
+        } else if (op_code == USER_FXN_CALL_OPCODE) {                 
+          SET_FAILED_ON_SRC_LINE;
+          user_messages->logMsg(INTERNAL_ERROR, L"NOT SUPPORTED YET!", this_src_file, failed_on_src_line, 0);
+
+        } else if (op_code == SYSTEM_CALL_OPCODE) {             
+          SET_FAILED_ON_SRC_LINE;
+          // TODO: Will stand-alone system calls be wrapped inside an expression?  Probably.....
+          user_messages->logMsg(INTERNAL_ERROR, L"NOT SUPPORTED YET!", this_src_file, failed_on_src_line, 0);
+
+        } else {
+          SET_FAILED_ON_SRC_LINE;
+          std::wstring msg = L"Unknown opcode [";
+          NumberFormatter::appendHex (msg, op_code);
+          msg.append(L"] found at ");
+          NumberFormatter::appendHex (msg, obj_start_pos);
+          user_messages->logMsg(INTERNAL_ERROR, msg, this_src_file, failed_on_src_line, 0);
         }
       }
     }
@@ -436,34 +423,31 @@ int RunTimeInterpreter::execCurrScope (uint32_t exec_start_pos, uint32_t after_s
  * ***************************************************************************/
 int RunTimeInterpreter::execExpression (uint32_t obj_start_pos, Token & result_tkn) {
   int ret_code = GENERAL_FAILURE;
-  std::wstringstream obj_start_pos_str;
-  obj_start_pos_str.str(L"");
-  obj_start_pos_str << L"0x" << std::hex << obj_start_pos;
   int expected_ret_tkn_cnt;
 
   if (OK != file_reader.setPos(obj_start_pos))  {
     // Follow on fxn expects to start at beginning of expression
     SET_FAILED_ON_SRC_LINE;
     user_messages->logMsg(INTERNAL_ERROR
-      , L"Failed to reset interpreter file position to " + obj_start_pos_str.str(), this_src_file, failed_on_src_line, 0);
+      , L"Failed to reset interpreter file position to " + NumberFormatter::toHexStr (obj_start_pos), this_src_file, failed_on_src_line, 0);
 
   } else {
     std::vector<Token> expr_tkns;
     if (OK != file_reader.readExprIntoList(expr_tkns))  {
       SET_FAILED_ON_SRC_LINE;
       user_messages->logMsg(INTERNAL_ERROR
-        , L"Failed to retrieve expression starting at " + obj_start_pos_str.str(), this_src_file, failed_on_src_line, 0);
+        , L"Failed to retrieve expression starting at " + NumberFormatter::toHexStr (obj_start_pos), this_src_file, failed_on_src_line, 0);
     
     } else if (OK != resolveFlatExpr(expr_tkns, expected_ret_tkn_cnt)) {
         SET_FAILED_ON_SRC_LINE;
         user_messages->logMsg(INTERNAL_ERROR
-          , L"Failed to resolve flat expression starting at " + obj_start_pos_str.str(), this_src_file, failed_on_src_line, 0);
+          , L"Failed to resolve flat expression starting at " + NumberFormatter::toHexStr (obj_start_pos), this_src_file, failed_on_src_line, 0);
 
      } else if (expr_tkns.size() != expected_ret_tkn_cnt) {
       // TODO: Should not have returned OK!
       // flattenedExpr should have 1 Token left - the result of the expression
       SET_FAILED_ON_SRC_LINE;
-      std::wstring dev_msg = L"Failed to resolve at file position " + obj_start_pos_str.str();
+      std::wstring dev_msg = L"Failed to resolve at file position " + NumberFormatter::toHexStr (obj_start_pos);
       user_messages->logMsg (INTERNAL_ERROR, dev_msg, this_src_file, failed_on_src_line, 0);
 
     } else {
@@ -497,8 +481,6 @@ int RunTimeInterpreter::execVarDeclaration (uint32_t obj_start_pos, uint32_t obj
   int ret_code = GENERAL_FAILURE;
   uint8_t op_code;
   bool is_done = false;
-  std::wstringstream op_code_hex_str;
-  std::wstringstream file_pos_hex_str;
   std::wstring dev_msg;
   uint32_t curr_obj_start_pos;
 
@@ -507,14 +489,10 @@ int RunTimeInterpreter::execVarDeclaration (uint32_t obj_start_pos, uint32_t obj
     TokenTypeEnum tkn_type = exec_terms.getTokenTypeForOpCode (op_code);
     if (tkn_type == USER_WORD_TKN || !Token::isDirectOperand (tkn_type))  {
       SET_FAILED_ON_SRC_LINE;
-      op_code_hex_str.str(L"");
-      op_code_hex_str << L"0x" << std::hex << op_code;
       std::wstring devMsg = L"Expected op_code that would resolve to a datatype but got ";
-      devMsg.append(op_code_hex_str.str());
+      NumberFormatter::appendHex (devMsg, op_code);
       devMsg.append (L" at file position ");
-      file_pos_hex_str.str(L"");
-      file_pos_hex_str << L"0x" << std::hex << file_reader.getPos();
-      devMsg.append(file_pos_hex_str.str());
+      NumberFormatter::appendHex (devMsg, file_reader.getPos());
       user_messages->logMsg(INTERNAL_ERROR, devMsg, this_src_file, failed_on_src_line, 0);
 
     } else {
@@ -525,6 +503,7 @@ int RunTimeInterpreter::execVarDeclaration (uint32_t obj_start_pos, uint32_t obj
 
       while (!is_done && !failed_on_src_line) {
         var_name_tkn.resetToString(L"");
+        uint64_t num_elements = 0;
         Token var_tkn;
         var_tkn.resetTokenExceptSrc();
         var_tkn.tkn_type = tkn_type;
@@ -536,27 +515,29 @@ int RunTimeInterpreter::execVarDeclaration (uint32_t obj_start_pos, uint32_t obj
           is_done = true;
         
         } else {
-            file_pos_hex_str.str(L"");
-            file_pos_hex_str << L"0x" << std::hex << curr_obj_start_pos;
-
           if (OK != file_reader.readNextByte(op_code) || USER_VAR_OPCODE != op_code)  {
             SET_FAILED_ON_SRC_LINE;
-            dev_msg = L"Did not get expected VAR_NAME_OPCODE at file position " + file_pos_hex_str.str();
+            dev_msg = L"Did not get expected VAR_NAME_OPCODE at file position " + NumberFormatter::toHexStr (curr_obj_start_pos);
             user_messages->logMsg(INTERNAL_ERROR, dev_msg, this_src_file, failed_on_src_line, 0);
       
-          } else if (OK != file_reader.readUserVar (var_name_tkn))  {
+          } else if (OK != file_reader.readUserVar (var_name_tkn, num_elements))  {
             SET_FAILED_ON_SRC_LINE;
-            dev_msg = L"Failed reading variable name in declaration after file position " + file_pos_hex_str.str();
+            dev_msg = L"Failed reading variable name in declaration after file position " + NumberFormatter::toHexStr (curr_obj_start_pos);
             user_messages->logMsg(INTERNAL_ERROR, dev_msg, this_src_file, failed_on_src_line, 0);
 
           } else if (!exec_terms.is_viable_var_name(var_name_tkn._string))  {
             SET_FAILED_ON_SRC_LINE;
-            dev_msg = L"Variable name in declaration is invalid [" + var_name_tkn._string + L"] after file position " + file_pos_hex_str.str();
+            dev_msg = L"Variable name in declaration is invalid [" + var_name_tkn._string + L"] after file position " + NumberFormatter::toHexStr (curr_obj_start_pos);
             user_messages->logMsg(INTERNAL_ERROR, dev_msg, this_src_file, failed_on_src_line, 0);
           
-          } else if (OK != scope_name_space->insertNewVarAtCurrScope(var_name_tkn._string, var_tkn))  {
+          } else if (num_elements > 0 && OK != scope_name_space->insertNewArrayAtCurrScope(var_name_tkn._string, var_tkn, num_elements, true))  {
+              SET_FAILED_ON_SRC_LINE;
+              dev_msg = L"Failed to insert array into NameSpace [" + var_name_tkn._string + L"] after file position " + NumberFormatter::toHexStr (curr_obj_start_pos);
+              user_messages->logMsg(INTERNAL_ERROR, dev_msg, this_src_file, failed_on_src_line, 0);
+
+          } else if (num_elements == 0 && OK != scope_name_space->insertNewVarAtCurrScope(var_name_tkn._string, var_tkn))  {
               SET_FAILED_ON_SRC_LINE;
-              dev_msg = L"Failed to insert variable into NameSpace [" + var_name_tkn._string + L"] after file position " + file_pos_hex_str.str();
+              dev_msg = L"Failed to insert variable into NameSpace [" + var_name_tkn._string + L"] after file position " + NumberFormatter::toHexStr (curr_obj_start_pos);
               user_messages->logMsg(INTERNAL_ERROR, dev_msg, this_src_file, failed_on_src_line, 0);
           
           } else if (past_limit_file_pos <= (file_reader.getPos())) {
@@ -577,8 +558,6 @@ int RunTimeInterpreter::execVarDeclaration (uint32_t obj_start_pos, uint32_t obj
             //                         ^                    ^                         ^
             // Otherwise, go back to top of loop and look for the next variable name
             uint32_t expr_start_pos = file_reader.getPos();
-            file_pos_hex_str.str(L"");
-            file_pos_hex_str << L"0x" << std::hex << expr_start_pos;
             Token resolved_tkn;
 
             if (OK != execExpression(expr_start_pos, resolved_tkn)) {
@@ -588,7 +567,7 @@ int RunTimeInterpreter::execVarDeclaration (uint32_t obj_start_pos, uint32_t obj
               // Don't limit search to current scope
               SET_FAILED_ON_SRC_LINE;
               user_messages->logMsg (INTERNAL_ERROR
-                  , L"After resolving initialization expression starting on|near " + file_pos_hex_str.str() + L": " + look_up_msg
+                  , L"After resolving initialization expression starting on|near " + NumberFormatter::toHexStr (expr_start_pos) + L": " + look_up_msg
                   , this_src_file, failed_on_src_line, 0);
             }
           }
@@ -617,21 +596,53 @@ int RunTimeInterpreter::execVarDeclaration (uint32_t obj_start_pos, uint32_t obj
 int RunTimeInterpreter::execPrePostFixOp (std::vector<Token> & expr_tkn_stream, int opr8r_idx)  {
   int ret_code = GENERAL_FAILURE;
   bool is_success = false;
-  std::wstring lookup_msg;
 
   if (opr8r_idx >= 0 && expr_tkn_stream.size() > (opr8r_idx + 1) && expr_tkn_stream[opr8r_idx].tkn_type == EXEC_OPR8R_TKN)  {
     // Snarf up OPR8R op_code BEFORE it is overwritten by the result
     uint8_t op_code = expr_tkn_stream[opr8r_idx]._unsigned;
-    Operator opr8r;
-    exec_terms.getExecOpr8rDetails(op_code, opr8r);
 
     // Our operand Token *MUST* be a USER_WORD variable name, requiring a NameSpace look up to get the actual value
     // TODO: Figure out how to log errors but continue on when compiling
-    Token operand1;
-    std::wstring var_name1;
-    resolveTknOrVar (expr_tkn_stream[opr8r_idx+1], operand1, var_name1);
+    Token & operand1 = expr_tkn_stream[opr8r_idx+1];
+    scopeVar * var_handle = NULL;
+    TypedArray * typed_array = NULL;
+
+    if (operand1.tkn_type == ARRAY_ELEMENT_TKN)  {
+      // Array elements don't live in a Token of their own; read, alter & write back
+      Token elem_value;
+      Token new_value;
+      std::wstring error_msg;
+      int addValue = (op_code == PRE_INCR_OPR8R_OPCODE || op_code == POST_INCR_OPR8R_OPCODE ? 1 : -1);
+
+      if (OK == get_array (operand1._string, typed_array))
+        typed_array->getElement (operand1._unsigned, elem_value);
+
+      if (typed_array == NULL)  {
+        // Already reported
+
+      } else if (!elem_value.isSigned() && !elem_value.isUnsigned())  {
+        // TODO: The compiler failed us. How should we handle this?
+
+      } else  {
+        new_value = elem_value;
+        new_value.isUnsigned() ? new_value._unsigned += addValue : new_value._signed += addValue;
+
+        if (OK != typed_array->setElement (operand1._unsigned, new_value, operand1._string, error_msg))  {
+          user_messages->logMsg (INTERNAL_ERROR, error_msg, this_src_file, __LINE__, 0);
 
-    if (var_name1.empty())  {
+        } else  {
+          // PREFIX change is visible in the current expression, cut down to the element's width; POSTFIX change isn't
+          if (op_code == PRE_INCR_OPR8R_OPCODE || op_code == PRE_DECR_OPR8R_OPCODE)
+            typed_array->getElement (operand1._unsigned, expr_tkn_stream[opr8r_idx]);
+          else
+            expr_tkn_stream[opr8r_idx] = elem_value;
+          ret_code = OK;
+        }
+      }
+
+    } else if (operand1.tkn_type != USER_WORD_TKN)  {
+      Operator opr8r;
+      exec_terms.getExecOpr8rDetails(op_code, opr8r);
       std::wstring userMsg = L"Failed to execute OPR8R ";
       userMsg.append (opr8r.symbol);
       userMsg.append (L"; ");
@@ -639,32 +650,36 @@ int RunTimeInterpreter::execPrePostFixOp (std::vector<Token> & expr_tkn_stream,
       userMsg.append (L" is an r-value");
       user_messages->logMsg (USER_ERROR, userMsg, this_src_file, __LINE__, 0);
 
-    } else if (!operand1.isSigned() &&  !operand1.isUnsigned()) {
+    } else if (OK != scope_name_space->getVarHandle (operand1._string, 0, var_handle))  {
+      user_messages->logMsg(INTERNAL_ERROR, L"Failed to find variable " + operand1._string, this_src_file, __LINE__, 0);
+
+    } else if (!var_handle->value.isSigned() &&  !var_handle->value.isUnsigned()) {
       // TODO: The compiler failed us. How should we handle this?
 
     } else if (op_code == PRE_INCR_OPR8R_OPCODE || op_code == PRE_DECR_OPR8R_OPCODE)  {
+      // Variable gets altered in place in the NameSpace
+      Token & var_value = var_handle->value;
       int addValue = (op_code == PRE_INCR_OPR8R_OPCODE ? 1 : -1);
-      operand1.isUnsigned() ? operand1._unsigned += addValue : operand1._signed += addValue;
+      var_value.isUnsigned() ? var_value._unsigned += addValue : var_value._signed += addValue;
 
       // Return altered value to our "stack" for use in the expression
-      expr_tkn_stream[opr8r_idx] = operand1;
+      expr_tkn_stream[opr8r_idx] = var_value;
       is_success = true;
 
     } else if (op_code == POST_INCR_OPR8R_OPCODE || op_code == POST_DECR_OPR8R_OPCODE)  {
+      Token & var_value = var_handle->value;
       int addValue = (op_code == POST_INCR_OPR8R_OPCODE ? 1 : -1);
 
       // Return current value to our "stack" for use in the expression, THEN alter NameSpace value
-      expr_tkn_stream[opr8r_idx] = operand1;
-      operand1.isUnsigned() ? operand1._unsigned += addValue : operand1._signed += addValue;
+      expr_tkn_stream[opr8r_idx] = var_value;
+      var_value.isUnsigned() ? var_value._unsigned += addValue : var_value._signed += addValue;
       is_success = true;
     }
 
     if (is_success) {
       expr_tkn_stream[opr8r_idx].isInitialized = true;
-      operand1.isInitialized = true;
-      ret_code = scope_name_space->findVar(var_name1, 0, operand1, COMMIT_WRITE, lookup_msg);
-      if (OK!= ret_code)
-        user_messages->logMsg(INTERNAL_ERROR, lookup_msg, this_src_file, __LINE__, 0);
+      var_handle->value.isInitialized = true;
+      ret_code = OK;
     }
 
   } else  {
@@ -689,10 +704,8 @@ int RunTimeInterpreter::execEquivalenceOp(std::vector<Token> & expr_tkn_stream,
     // TODO: Figure out how to log errors but continue on when compiling
     Token operand1;
     Token operand2;
-    std::wstring var_name1;
-    std::wstring var_name2;
-    resolveTknOrVar (expr_tkn_stream[opr8r_idx + 1], operand1, var_name1);
-    resolveTknOrVar (expr_tkn_stream[opr8r_idx + 2], operand2, var_name2);
+    resolveTknOrVar (expr_tkn_stream[opr8r_idx + 1], operand1);
+    resolveTknOrVar (expr_tkn_stream[opr8r_idx + 2], operand2);
 
     TokenCompareResult compare_rez = operand1.compare (operand2);
 
@@ -792,10 +805,8 @@ int RunTimeInterpreter::execStandardMath (std::vector<Token> & expr_tkn_stream,
     // TODO: Figure out how to log errors but continue on when compiling
     Token operand1;
     Token operand2;
-    std::wstring var_name1;
-    std::wstring var_name2;
-    resolveTknOrVar (expr_tkn_stream[opr8r_idx+1], operand1, var_name1);
-    resolveTknOrVar (expr_tkn_stream[opr8r_idx+2], operand2, var_name2);
+    resolveTknOrVar (expr_tkn_stream[opr8r_idx+1], operand1);
+    resolveTknOrVar (expr_tkn_stream[opr8r_idx+2], operand2);
 
     // 1st check for valid passed parameters
     if (op_code == MULTIPLY_OPR8R_OPCODE || op_code == DIV_OPR8R_OPCODE || op_code == BINARY_MINUS_OPR8R_OPCODE)  {
@@ -1167,9 +1178,11 @@ int RunTimeInterpreter::execStandardMath (std::vector<Token> & expr_tkn_stream,
       // Should enclosing scope contain opening line # and possibly source file name
       // void InfoWarnError::set(info_warn_error_type type, std::wstring userSrcFileName, int userSrcLineNum, int userSrcColPos, std::wstring srcFileName, int srcLineNum, std::wstring msgForUser) {
       std::wstring bad_user_msg = L"User code attempted to divide by ZERO! [";
-      bad_user_msg.append (var_name1.empty() ? operand1.getValueStr() : var_name1);
+      Token & dividend_tkn = expr_tkn_stream[opr8r_idx+1];
+      Token & divisor_tkn = expr_tkn_stream[opr8r_idx+2];
+      bad_user_msg.append (dividend_tkn.tkn_type == USER_WORD_TKN ? dividend_tkn._string.str() : operand1.getValueStr());
       bad_user_msg.append (L" / ");
-      bad_user_msg.append (var_name2.empty() ? operand2.getValueStr() : var_name2);
+      bad_user_msg.append (divisor_tkn.tkn_type == USER_WORD_TKN ? divisor_tkn._string.str() : operand2.getValueStr());
       bad_user_msg.append (L"]");
       user_messages->logMsg (USER_ERROR, bad_user_msg, !usr_src_file_name.empty() ? usr_src_file_name : L"???", 0, 0);
 
@@ -1197,10 +1210,8 @@ int RunTimeInterpreter::execShift (std::vector<Token> & expr_tkn_stream, int opr
     // TODO: Figure out how to log errors but continue on when compiling
     Token operand1;
     Token operand2;
-    std::wstring var_name1;
-    std::wstring var_name2;
-    resolveTknOrVar (expr_tkn_stream[opr8r_idx+1], operand1, var_name1);
-    resolveTknOrVar (expr_tkn_stream[opr8r_idx+2], operand2, var_name2);
+    resolveTknOrVar (expr_tkn_stream[opr8r_idx+1], operand1);
+    resolveTknOrVar (expr_tkn_stream[opr8r_idx+2], operand2);
 
     // Operand #1 must be of type UINT[N] or INT[N]; Operand #2 can be either UINT[N] or INT[N] > 0
     if ((op_code == LEFT_SHIFT_OPR8R_OPCODE || op_code == RIGHT_SHIFT_OPR8R_OPCODE) && (operand1.isUnsigned() || operand1.isSigned())
@@ -1287,10 +1298,8 @@ int RunTimeInterpreter::execBitWiseOp (std::vector<Token> & expr_tkn_stream, int
     // TODO: Figure out how to log errors but continue on when compiling
     Token operand1;
     Token operand2;
-    std::wstring var_name1;
-    std::wstring var_name2;
-    resolveTknOrVar (expr_tkn_stream[opr8r_idx+1], operand1, var_name1);
-    resolveTknOrVar (expr_tkn_stream[opr8r_idx+2], operand2, var_name2);
+    resolveTknOrVar (expr_tkn_stream[opr8r_idx+1], operand1);
+    resolveTknOrVar (expr_tkn_stream[opr8r_idx+2], operand2);
 
     uint64_t bitwise_result;
 
@@ -1396,8 +1405,7 @@ int RunTimeInterpreter::execUnaryOp (std::vector<Token> & expr_tkn_stream, int o
     // Our operand Token could be a USER_WORD variable name, requiring a NameSpace look up to get the actual value
     // TODO: Figure out how to log errors but continue on when compiling
     Token operand1;
-    std::wstring var_name1;
-    resolveTknOrVar (expr_tkn_stream[opr8r_idx+1], operand1, var_name1);
+    resolveTknOrVar (expr_tkn_stream[opr8r_idx+1], operand1);
     uint64_t unary_result;
 
     if (op_code == UNARY_PLUS_OPR8R_OPCODE) {
@@ -1497,38 +1505,39 @@ int RunTimeInterpreter::execAssignmentOp(std::vector<Token> & expr_tkn_stream, i
 
     // Either|both of our operand Tokens could be USER_WORD variable names, requiring a NameSpace look up to get the actual value
     // TODO: Figure out how to log errors but continue on when compiling
-    Token operand1;
-    Token operand2;
-    std::wstring var_name1;
-    std::wstring var_name2;
-    resolveTknOrVar (expr_tkn_stream[opr8r_idx + 1], operand1, var_name1, false);
-    resolveTknOrVar (expr_tkn_stream[opr8r_idx + 2], operand2, var_name2);
-
+    // Resolve the target variable once; the result gets converted & stored right where it lives
+    scopeVar * var_handle = NULL;
+    TypedArray * typed_array = NULL;
+    Token target_tkn = expr_tkn_stream[opr8r_idx + 1];
     bool is_op_success = false;
 
-    std::wstring bgn_notta_var_msg = L"Left operand of an assignment operator must be a named variable: ";
-    Token opr8rTkn = expr_tkn_stream[opr8r_idx];
-    
-    if (var_name1.empty() && usage_mode == COMPILE_TIME)  {
-      user_messages->logMsg(USER_ERROR
-        , bgn_notta_var_msg + opr8rTkn.descr_sans_line_num_col() + L" Assignment operation may need to be enclosed in parentheses."
-        , usr_src_file_name, opr8rTkn.get_line_number(), opr8rTkn.get_column_pos());
+    if (target_tkn.tkn_type == ARRAY_ELEMENT_TKN && OK != get_array (target_tkn._string, typed_array))  {
+      // Already reported
+
+    } else if (target_tkn.tkn_type != USER_WORD_TKN && target_tkn.tkn_type != ARRAY_ELEMENT_TKN)  {
+      user_messages->logMsg(INTERNAL_ERROR, L"Left operand of an assignment operator must be a named variable: "
+        + expr_tkn_stream[opr8r_idx].descr_sans_line_num_col(), this_src_file, __LINE__, 0);
 
-    } else if (var_name1.empty() && usage_mode == INTERPRETER)  {
-      user_messages->logMsg(INTERNAL_ERROR, bgn_notta_var_msg + opr8rTkn.descr_sans_line_num_col()
+    } else if (target_tkn.tkn_type == USER_WORD_TKN && OK != scope_name_space->getVarHandle (target_tkn._string, 0, var_handle))  {
+      user_messages->logMsg(INTERNAL_ERROR, L"Failed to find variable " + expr_tkn_stream[opr8r_idx + 1]._string
         , this_src_file, __LINE__, 0);
 
     } else  {
       switch (original_op_code) {
         case ASSIGNMENT_OPR8R_OPCODE :
-          if (OK == scope_name_space->findVar(var_name1, 0, operand2, COMMIT_WRITE, lookUpMsg)) {
-            // We've updated the NS Variable Token; now overwrite the OPR8R with the result also
-            expr_tkn_stream[opr8r_idx] = operand2;
-            is_op_success = true;
-            ret_code = OK;
-          
-          } else if (!lookUpMsg.empty())  {
-            user_messages->logMsg(INTERNAL_ERROR, lookUpMsg, this_src_file, __LINE__, 0);
+          {
+            Token operand2;
+            resolveTknOrVar (expr_tkn_stream[opr8r_idx + 2], operand2);
+
+            if (OK == assign_var_or_element (var_handle, typed_array, target_tkn, operand2, lookUpMsg)) {
+              // We've updated the NS Variable Token; now overwrite the OPR8R with the result also
+              expr_tkn_stream[opr8r_idx] = operand2;
+              is_op_success = true;
+              ret_code = OK;
+            
+            } else if (!lookUpMsg.empty())  {
+              user_messages->logMsg(INTERNAL_ERROR, lookUpMsg, this_src_file, __LINE__, 0);
+            }
           }
           break;
         case PLUS_ASSIGN_OPR8R_OPCODE :
@@ -1589,7 +1598,7 @@ int RunTimeInterpreter::execAssignmentOp(std::vector<Token> & expr_tkn_stream, i
     if (is_op_success)  {
       expr_tkn_stream[opr8r_idx].isInitialized = true;
       if (original_op_code != ASSIGNMENT_OPR8R_OPCODE
-          && OK == scope_name_space->findVar(var_name1, 0, expr_tkn_stream[opr8r_idx], COMMIT_WRITE, lookUpMsg))  {
+          && OK == assign_var_or_element (var_handle, typed_array, target_tkn, expr_tkn_stream[opr8r_idx], lookUpMsg))  {
         // Commit the result to the stored NS variable. OPR8R Token (previously @ opr8r_idx) has already been overwritten with result 
         ret_code = OK;
       } else if (!lookUpMsg.empty())  {
@@ -1603,6 +1612,21 @@ int RunTimeInterpreter::execAssignmentOp(std::vector<Token> & expr_tkn_stream, i
   return (ret_code);
 }
 
+/* ****************************************************************************
+ * Assignment target is either a variable or an element of typed_array
+ * ***************************************************************************/
+int RunTimeInterpreter::assign_var_or_element (scopeVar * var_handle, TypedArray * typed_array, const Token & target_tkn
+  , const Token & new_val_tkn, std::wstring & error_msg)  {
+  int ret_code = GENERAL_FAILURE;
+
+  if (typed_array != NULL)
+    ret_code = typed_array->setElement (target_tkn._unsigned, new_val_tkn, target_tkn._string, error_msg);
+  else if (var_handle != NULL)
+    ret_code = scope_name_space->assignVar (*var_handle, new_val_tkn, error_msg);
+
+  return (ret_code);
+}
+
 /* ****************************************************************************
  * Jump gate for handling BINARY OPR8Rs
  * ***************************************************************************/
@@ -1619,10 +1643,8 @@ int RunTimeInterpreter::execBinaryOp(std::vector<Token> & expr_tkn_stream, int o
     // TODO: Figure out how to log errors but continue on when compiling
     Token operand1;
     Token operand2;
-    std::wstring var_name1;
-    std::wstring var_name2;
-    resolveTknOrVar (expr_tkn_stream[opr8r_idx+1], operand1, var_name1, op_code == ASSIGNMENT_OPR8R_OPCODE ?  false : true);
-    resolveTknOrVar (expr_tkn_stream[opr8r_idx+2], operand2, var_name2);
+    resolveTknOrVar (expr_tkn_stream[opr8r_idx+1], operand1);
+    resolveTknOrVar (expr_tkn_stream[opr8r_idx+2], operand2);
 
     switch (op_code)  {
       case MULTIPLY_OPR8R_OPCODE :
@@ -1918,6 +1940,20 @@ int RunTimeInterpreter::getEndOfSubExprIdx (std::vector<Token> & expr_tkn_stream
         // TERNARY_2ND was *NOT* expected!
         SET_FAILED_ON_SRC_LINE;
 
+      } else if (opr8r_deets.op_code == LOOKUP_SELECT_OPR8R_OPCODE)  {
+        // [?sel][# of keys][selector][keys][values][default]
+        if (idx + 1 >= expr_tkn_stream.size() || !expr_tkn_stream[idx + 1].isUnsigned())
+          SET_FAILED_ON_SRC_LINE;
+        else
+          opr8rReqStack.push_back(3 + 2 * expr_tkn_stream[idx + 1]._unsigned);
+
+      } else if (opr8r_deets.op_code == CONCAT_N_OPR8R_OPCODE)  {
+        // [+cat][# of pieces][piece]+
+        if (idx + 1 >= expr_tkn_stream.size() || !expr_tkn_stream[idx + 1].isUnsigned())
+          SET_FAILED_ON_SRC_LINE;
+        else
+          opr8rReqStack.push_back(1 + expr_tkn_stream[idx + 1]._unsigned);
+
       } else  {
         opr8rReqStack.push_back(opr8r_deets.numReqExecOperands);
       }
@@ -2039,8 +2075,12 @@ int RunTimeInterpreter::execOperation (Operator opr8r, int opr8r_idx, std::vecto
       tmp_str.append(L"^ ");
       if (opr8r_idx >= 0 && opr8r_idx < flat_expr_tkns.size())  {
         Operator opr8r;
-        if (OK == exec_terms.getExecOpr8rDetails (flat_expr_tkns[opr8r_idx]._unsigned, opr8r))  {
+        if (flat_expr_tkns[opr8r_idx].tkn_type == EXEC_OPR8R_TKN && OK == exec_terms.getExecOpr8rDetails (flat_expr_tkns[opr8r_idx]._unsigned, opr8r))  {
           int rand_cnt = opr8r.numReqExecOperands;
+          if (opr8r.op_code == LOOKUP_SELECT_OPR8R_OPCODE && opr8r_idx + 1 < flat_expr_tkns.size() && flat_expr_tkns[opr8r_idx + 1].isUnsigned())
+            rand_cnt = 3 + 2 * flat_expr_tkns[opr8r_idx + 1]._unsigned;
+          else if (opr8r.op_code == CONCAT_N_OPR8R_OPCODE && opr8r_idx + 1 < flat_expr_tkns.size() && flat_expr_tkns[opr8r_idx + 1].isUnsigned())
+            rand_cnt = 1 + flat_expr_tkns[opr8r_idx + 1]._unsigned;
           if (!opr8r.description.empty())
             tmp_str.append (opr8r.description);
           else
@@ -2052,15 +2092,17 @@ int RunTimeInterpreter::execOperation (Operator opr8r, int opr8r_idx, std::vecto
 
           if (opr8r.op_code == TERNARY_1ST_OPR8R_OPCODE)  {
             tmp_str.append (L"; [Conditional][TRUE path][FALSE path]");
+          } else if (opr8r.op_code == LOOKUP_SELECT_OPR8R_OPCODE)  {
+            tmp_str.append (L"; [# of keys][selector][keys][values][default]");
+          } else if (opr8r.op_code == CONCAT_N_OPR8R_OPCODE)  {
+            tmp_str.append (L"; [# of pieces][pieces]");
           }
         } else if (flat_expr_tkns[opr8r_idx].tkn_type == SYSTEM_CALL_TKN) {
           tmp_str.append (L"system call consumes next ");
-          std::vector<uint8_t> param_list;
-          TokenTypeEnum data_type;
-          exec_terms.get_system_call_details(flat_expr_tkns[opr8r_idx]._string, param_list, data_type);
-          tmp_str.append (std::to_wstring(param_list.size()));
+          const systemCall * sys_call = exec_terms.get_system_call (flat_expr_tkns[opr8r_idx]._unsigned);
+          tmp_str.append (std::to_wstring(sys_call == NULL ? 0 : sys_call->param_list.size()));
           tmp_str.append (L" sequential operand(s); replace w/ result (");
-          Token tmp_type_tkn (data_type, L"");
+          Token tmp_type_tkn (sys_call == NULL ? START_UNDEF_TKN : sys_call->ret_type, L"");
           tmp_str.append (tmp_type_tkn.get_type_str(true));
           tmp_str.append (L")");
         }
@@ -2109,6 +2151,11 @@ int RunTimeInterpreter::execOperation (Operator opr8r, int opr8r_idx, std::vecto
       is_ready = true;
       ret_code = OK;
 
+    } else if (opr8r.op_code == LOOKUP_SELECT_OPR8R_OPCODE) {
+      // Only the selected value gets evaluated
+      is_ready = true;
+      ret_code = OK;
+
     } else if (opr8r.op_code == LOGICAL_AND_OPR8R_OPCODE) {
       // Special case this OPR8R in case there is short circuiting
       is_ready = true;
@@ -2118,19 +2165,33 @@ int RunTimeInterpreter::execOperation (Operator opr8r, int opr8r_idx, std::vecto
       is_ready = true;
       ret_code = OK;
 
+    } else if (opr8r.op_code == CONCAT_N_OPR8R_OPCODE)  {
+      // Needs its [# of pieces] and every piece resolved
+      if (curr_idx + 1 >= flat_expr_tkns.size() || !flat_expr_tkns[curr_idx + 1].isUnsigned())  {
+        SET_FAILED_ON_SRC_LINE;
+
+      } else  {
+        is_actor = true;
+        num_req_seq_rands = 1 + flat_expr_tkns[curr_idx + 1]._unsigned;
+      }
+
     } else {
       is_actor = true;
       num_req_seq_rands = opr8r.numReqExecOperands;
     }
   
   } else if (flat_expr_tkns[curr_idx].tkn_type == SYSTEM_CALL_TKN) {
-    if (OK != exec_terms.get_num_sys_call_parameters (flat_expr_tkns[curr_idx]._string, num_req_seq_rands))  {
+    const systemCall * sys_call = exec_terms.get_system_call (flat_expr_tkns[curr_idx]._unsigned);
+    if (sys_call == NULL)  {
       SET_FAILED_ON_SRC_LINE;
     
     } else  {
+     num_req_seq_rands = sys_call->param_list.size();
      is_actor = true;
     }
-  } else if (flat_expr_tkns[curr_idx].isDirectOperand() || flat_expr_tkns[curr_idx].tkn_type == USER_WORD_TKN) {
+  } else if (flat_expr_tkns[curr_idx].isDirectOperand() || flat_expr_tkns[curr_idx].tkn_type == USER_WORD_TKN
+    || flat_expr_tkns[curr_idx].tkn_type == TEMP_SLOT_TKN || flat_expr_tkns[curr_idx].tkn_type == INVARIANT_SLOT_TKN
+    || flat_expr_tkns[curr_idx].tkn_type == ARRAY_ELEMENT_TKN) {
     ret_code = OK;
   
   } else {
@@ -2200,8 +2261,54 @@ int RunTimeInterpreter::execOperation (Operator opr8r, int opr8r_idx, std::vecto
       else
         ret_code = OK;
 
+    } else if (opr8r.op_code == TEMP_STORE_OPR8R_OPCODE)  {
+      if (OK != exec_temp_store (flat_expr_tkns, exec_idx))
+        SET_FAILED_ON_SRC_LINE;
+      else
+        ret_code = OK;
+
+    } else if (opr8r.op_code == LOOKUP_SELECT_OPR8R_OPCODE)  {
+      if (OK != exec_lookup_select (flat_expr_tkns, exec_idx))
+        SET_FAILED_ON_SRC_LINE;
+      else
+        ret_code = OK;
+
+    } else if (opr8r.op_code == ARRAY_ELEMENT_OPR8R_OPCODE)  {
+      if (OK != exec_array_element (flat_expr_tkns, exec_idx))
+        SET_FAILED_ON_SRC_LINE;
+      else
+        ret_code = OK;
+
+    } else if (opr8r.op_code == CONCAT_N_OPR8R_OPCODE)  {
+      int num_pieces = flat_expr_tkns[exec_idx + 1]._unsigned;
+
+      for (int rand_idx = exec_idx + 2; rand_idx <= exec_idx + 1 + num_pieces && !failed_on_src_line; rand_idx++) {
+        if (OK != resolveTempSlot (flat_expr_tkns[rand_idx]))
+          SET_FAILED_ON_SRC_LINE;
+      }
+
+      if (failed_on_src_line)  {
+        // Already reported
+
+      } else if (OK != exec_concat_n (flat_expr_tkns, exec_idx, num_pieces))  {
+        SET_FAILED_ON_SRC_LINE;
+
+      } else  {
+        flat_expr_tkns.erase(flat_expr_tkns.begin() + exec_idx + 1, flat_expr_tkns.begin() + exec_idx + num_pieces + 2);
+        ret_code = OK;
+      }
+
     } else {
-      if (OK != execOperation (opr8r, exec_idx, flat_expr_tkns))  {
+      for (int rand_idx = exec_idx + 1; rand_idx <= exec_idx + opr8r.numReqExecOperands && !failed_on_src_line; rand_idx++) {
+        // Operands saved off earlier in this expression get swapped in for their temp slot
+        if (OK != resolveTempSlot (flat_expr_tkns[rand_idx]))
+          SET_FAILED_ON_SRC_LINE;
+      }
+
+      if (failed_on_src_line)  {
+        // Already reported
+
+      } else if (OK != execOperation (opr8r, exec_idx, flat_expr_tkns))  {
         SET_FAILED_ON_SRC_LINE;
       } else  {
         // Operation result stored in Token that previously held the OPR8R. We need to delete any associatd operands
@@ -2210,9 +2317,21 @@ int RunTimeInterpreter::execOperation (Operator opr8r, int opr8r_idx, std::vecto
       }
     }
   } else if (exec_tkn_type == SYSTEM_CALL_TKN)  {
-    if (OK != exec_system_call(flat_expr_tkns, exec_idx))
+    int num_params = 0;
+    const systemCall * sys_call = exec_terms.get_system_call (flat_expr_tkns[exec_idx]._unsigned);
+    if (sys_call == NULL)
       SET_FAILED_ON_SRC_LINE;
     else
+      num_params = sys_call->param_list.size();
+
+    for (int rand_idx = exec_idx + 1; rand_idx <= exec_idx + num_params && !failed_on_src_line; rand_idx++) {
+      if (OK != resolveTempSlot (flat_expr_tkns[rand_idx]))
+        SET_FAILED_ON_SRC_LINE;
+    }
+
+    if (!failed_on_src_line && OK != exec_system_call(flat_expr_tkns, exec_idx))
+      SET_FAILED_ON_SRC_LINE;
+    else if (!failed_on_src_line)
       ret_code = OK;
 
   } else {
@@ -2255,11 +2374,10 @@ int RunTimeInterpreter::execFlatExpr_OLR(std::vector<Token> & flat_expr_tkns, in
     if (flat_expr_tkns[start_idx].tkn_type == SYSTEM_CALL_TKN)  {
       // Check expected return data type. If it's a void, let our caller know by adjusting
       // expected_tkn_cnt
-      TokenTypeEnum ret_data_type;
-      std::vector<uint8_t> param_list;
-      if (OK != exec_terms.get_system_call_details (flat_expr_tkns[start_idx]._string, param_list, ret_data_type))
+      const systemCall * sys_call = exec_terms.get_system_call (flat_expr_tkns[start_idx]._unsigned);
+      if (sys_call == NULL)
         SET_FAILED_ON_SRC_LINE;
-      else if (ret_data_type == VOID_TKN)
+      else if (sys_call->ret_type == VOID_TKN)
         expected_tkn_cnt = 0;
     }
     int opr8r_cnt = 0;
@@ -2324,6 +2442,11 @@ int RunTimeInterpreter::execFlatExpr_OLR(std::vector<Token> & flat_expr_tkns, in
     } else if (!lookUpMsg.empty())  {
       user_messages->logMsg(INTERNAL_ERROR, lookUpMsg, this_src_file, __LINE__, 0);
     }
+  } else if (sub_expr_completed_line && !failed_on_src_line
+    && (flat_expr_tkns[start_idx].tkn_type == TEMP_SLOT_TKN || flat_expr_tkns[start_idx].tkn_type == INVARIANT_SLOT_TKN))  {
+    if (OK == resolveTempSlot (flat_expr_tkns[start_idx]))
+      ret_code = OK;
+
   } else if (sub_expr_completed_line && !failed_on_src_line && flat_expr_tkns[start_idx].tkn_type != EXEC_OPR8R_TKN)  {
     if (flat_expr_tkns[start_idx].isDirectOperand())
       flat_expr_tkns[start_idx].isInitialized = true;
@@ -2357,23 +2480,44 @@ int RunTimeInterpreter::resolveFlatExpr(std::vector<Token> & flat_expr_tkns, int
   return (ret_code);
 }
 
+/* ****************************************************************************
+ * Resolve a flat expression made up entirely of literals down to a single
+ * literal.  A failure (e.g. divide by zero) isn't fatal to the caller; the
+ * expression just gets left for run time to resolve and report on, so don't
+ * let failed_on_src_line stick around to block the next attempt.
+ * ***************************************************************************/
+int RunTimeInterpreter::resolveConstExpr (std::vector<Token> & flat_expr_tkns) {
+  int ret_code = GENERAL_FAILURE;
+  int expected_tkn_cnt;
+
+  if (OK == resolveFlatExpr (flat_expr_tkns, expected_tkn_cnt) && expected_tkn_cnt == 1 && flat_expr_tkns.size() == 1)
+    ret_code = OK;
+
+  failed_on_src_line = 0;
+
+  return (ret_code);
+}
+
 /* ****************************************************************************
  *
  * ***************************************************************************/
-int RunTimeInterpreter::resolveTknOrVar (Token & original_tkn, Token & resolved_tkn, std::wstring & var_name, bool is_check_init) {
+int RunTimeInterpreter::resolveTknOrVar (Token & original_tkn, Token & resolved_tkn) {
   int ret_code = GENERAL_FAILURE;
 
   if (original_tkn.tkn_type == USER_WORD_TKN) {
-    var_name = original_tkn._string;
-    std::wstring lookup_msg;
-    if (OK != scope_name_space->findVar(var_name, 0, resolved_tkn, READ_ONLY, lookup_msg))  {
-      user_messages->logMsg(INTERNAL_ERROR, lookup_msg, this_src_file, __LINE__, 0);
+    scopeVar * var_handle;
+    if (OK != scope_name_space->getVarHandle (original_tkn._string, 0, var_handle))  {
+      user_messages->logMsg(INTERNAL_ERROR, L"Failed to find variable " + original_tkn._string, this_src_file, __LINE__, 0);
 
     } else  {
-      if (is_check_init && usage_mode == COMPILE_TIME && !resolved_tkn.isInitialized) {
-        user_messages->logMsg(WARNING, L"Uninitialized variable used - " + original_tkn.descr_sans_line_num_col()
-          , usr_src_file_name, original_tkn.get_line_number(), original_tkn.get_column_pos());
-      }
+      resolved_tkn = var_handle->value;
+      ret_code = OK;
+    }
+  } else if (original_tkn.tkn_type == ARRAY_ELEMENT_TKN) {
+    TypedArray * typed_array;
+    if (OK == get_array (original_tkn._string, typed_array))  {
+      // Index was bounds checked when the reference was made
+      typed_array->getElement (original_tkn._unsigned, resolved_tkn);
       ret_code = OK;
     }
   } else  {
@@ -2388,67 +2532,382 @@ int RunTimeInterpreter::resolveTknOrVar (Token & original_tkn, Token & resolved_
 
 
 /* ****************************************************************************
- *
- * ***************************************************************************/
-int RunTimeInterpreter::resolveTknOrVar (Token & original_tkn, Token & resolved_tkn, std::wstring & varName)  {
-  return resolveTknOrVar(original_tkn, resolved_tkn, varName, true);
-}
-
-/* ****************************************************************************
- * Encountered the IF_SCOPE_OPCODE. Evaluate the conditional to determine if 
- * the enclosed block will be executed.  Check for follow on [else if] and|or
- * [else] blocks at the same scope. We'll need to know where the scope that
- * encloses this [if] block ends.
- * [op_code][total_length][conditional EXPRESSION][code block]
+ * [@elm][array name][index] -> [element]
+ * The one bounds check an element access gets.  When the element is about to
+ * be written to by the OPR8R in front of it, an ARRAY_ELEMENT_TKN reference
+ * to it takes the place of its value.
  * ***************************************************************************/
-int RunTimeInterpreter::exec_if_block (uint32_t scope_start_pos, uint32_t if_scope_len
-  , uint32_t after_parent_scope_pos, uint32_t & break_scope_end_pos)  {
-  
+int RunTimeInterpreter::exec_array_element (std::vector<Token> & flat_expr_tkns, int opr8r_idx) {
   int ret_code = GENERAL_FAILURE;
-  break_scope_end_pos = 0;
+  TypedArray * typed_array = NULL;
+  Token index_tkn;
 
-  bool is_else_blocks_done = false;
-  bool is_if_cond_true = false;
-  uint32_t pos_after_else_scope = 0;
-  uint8_t curr_obj_op_code = INVALID_OPCODE;
-  uint32_t curr_obj_start_pos = 0;
-  uint32_t curr_obj_len = 0;
-  uint32_t nxt_obj_start_pos = 0;
-  Token if_cond_tkn;
+  if (opr8r_idx + 2 >= flat_expr_tkns.size())  {
+    SET_FAILED_ON_SRC_LINE;
+    user_messages->logMsg (INTERNAL_ERROR, L"Incorrect parameters|count", this_src_file, failed_on_src_line, 0);
 
-  if (OK != execExpression(scope_start_pos + OPCODE_NUM_BYTES + NUM_BYTES_IN_DWORD, if_cond_tkn)) {
+  } else if (OK != get_array (flat_expr_tkns[opr8r_idx + 1]._string, typed_array))  {
     SET_FAILED_ON_SRC_LINE;
-  
-  } else if (if_cond_tkn.evalResolvedTokenAsIf()) {
-    // [if] condition is TRUE, so execute the code block
-    is_if_cond_true = true;
-    if (OK != execCurrScope(file_reader.getPos(), scope_start_pos + if_scope_len, break_scope_end_pos))
-      SET_FAILED_ON_SRC_LINE;
 
+  } else if (OK != resolveTempSlot (flat_expr_tkns[opr8r_idx + 2]) || OK != resolveTknOrVar (flat_expr_tkns[opr8r_idx + 2], index_tkn))  {
+    SET_FAILED_ON_SRC_LINE;
 
-  } else {
-    // [if] condition is FALSE, so jump around the [if] block
-    file_reader.setPos(scope_start_pos + if_scope_len);
-  }
+  } else if (!index_tkn.isSigned() && !index_tkn.isUnsigned())  {
+    SET_FAILED_ON_SRC_LINE;
+    user_messages->logMsg (INTERNAL_ERROR, L"Expected an integer array index but got " + index_tkn.descr_sans_line_num_col()
+      , this_src_file, failed_on_src_line, 0);
 
-  if (!failed_on_src_line)  {
-    bool is_skip_block;
+  } else if (index_tkn.isSigned() ? (index_tkn._signed < 0 || (uint64_t) index_tkn._signed >= typed_array->size())
+    : index_tkn._unsigned >= typed_array->size())  {
+    Token & name_tkn = flat_expr_tkns[opr8r_idx + 1];
+    SET_FAILED_ON_SRC_LINE;
+    user_messages->logMsg (USER_ERROR, L"Index " + index_tkn.getValueStr() + L" is out of bounds for array " + name_tkn._string
+      + L" of size " + std::to_wstring (typed_array->size()), usr_src_file_name, name_tkn.get_line_number(), name_tkn.get_column_pos());
 
-    while (!is_else_blocks_done && !failed_on_src_line) {
-      // Consume any [else if][else] blocks after our initial [if] block
-      curr_obj_start_pos = file_reader.getPos();
-      is_skip_block = false;
+  } else  {
+    uint64_t elem_idx = (index_tkn.isSigned() ? (uint64_t) index_tkn._signed : index_tkn._unsigned);
+    Token & elem_tkn = flat_expr_tkns[opr8r_idx];
 
-      if (curr_obj_start_pos == after_parent_scope_pos) {
-        // We've just gone past the parent scope that contains the [if] block
-        // and any chained [else if]+, [else] blocks
-        is_else_blocks_done = true;
+    if (opr8r_idx > 0 && flat_expr_tkns[opr8r_idx - 1].tkn_type == EXEC_OPR8R_TKN && is_writing_opr8r (flat_expr_tkns[opr8r_idx - 1]._unsigned))  {
+      elem_tkn.resetTokenExceptSrc();
+      elem_tkn.tkn_type = ARRAY_ELEMENT_TKN;
+      elem_tkn._string = flat_expr_tkns[opr8r_idx + 1]._string;
+      elem_tkn._unsigned = elem_idx;
+      elem_tkn.isInitialized = true;
 
-      } else if (OK != file_reader.peekNextByte(curr_obj_op_code))  {
-        SET_FAILED_ON_SRC_LINE;
+    } else  {
+      typed_array->getElement (elem_idx, elem_tkn);
+    }
 
-      } else if (curr_obj_op_code != ELSE_IF_SCOPE_OPCODE && curr_obj_op_code != ELSE_SCOPE_OPCODE) {
-        is_else_blocks_done = true;
+    flat_expr_tkns.erase (flat_expr_tkns.begin() + opr8r_idx + 1, flat_expr_tkns.begin() + opr8r_idx + 3);
+    ret_code = OK;
+  }
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+int RunTimeInterpreter::get_array (const InternedString & array_name, TypedArray * & typed_array) {
+  int ret_code = GENERAL_FAILURE;
+  scopeVar * var_handle;
+
+  typed_array = NULL;
+
+  if (OK != scope_name_space->getVarHandle (array_name, 0, var_handle))  {
+    user_messages->logMsg (INTERNAL_ERROR, L"Failed to find array " + array_name, this_src_file, __LINE__, 0);
+
+  } else if (var_handle->num_elements == 0 || var_handle->elements == NULL)  {
+    user_messages->logMsg (INTERNAL_ERROR, L"Variable " + array_name + L" is not an array", this_src_file, __LINE__, 0);
+
+  } else  {
+    typed_array = var_handle->elements.get();
+    ret_code = OK;
+  }
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ * Assignments and [pre|post]-fix OPR8Rs change the operand in front of them
+ * ***************************************************************************/
+bool RunTimeInterpreter::is_writing_opr8r (uint8_t op_code) {
+  return ((op_code >= POST_INCR_OPR8R_OPCODE && op_code <= PRE_DECR_OPR8R_OPCODE)
+    || (op_code >= ASSIGNMENT_OPR8R_OPCODE && op_code <= BITWISE_OR_ASSIGN_OPR8R_OPCODE));
+}
+
+/* ****************************************************************************
+ * Swap in the value saved off to a temp slot earlier in the same expression, or
+ * to an invariant slot in front of the enclosing loop.
+ * Anything that isn't a slot is left alone.
+ * ***************************************************************************/
+int RunTimeInterpreter::resolveTempSlot (Token & slot_tkn) {
+  int ret_code = GENERAL_FAILURE;
+
+  if (slot_tkn.tkn_type != TEMP_SLOT_TKN && slot_tkn.tkn_type != INVARIANT_SLOT_TKN) {
+    ret_code = OK;
+
+  } else  {
+    std::vector<Token> & slots = (slot_tkn.tkn_type == TEMP_SLOT_TKN ? temp_slots : invariant_slots);
+
+    if (slot_tkn._unsigned >= slots.size() || slots[slot_tkn._unsigned].tkn_type == START_UNDEF_TKN) {
+      user_messages->logMsg (INTERNAL_ERROR, L"Slot " + slot_tkn.getBracketedValueStr() + L" read before it was saved"
+        , this_src_file, __LINE__, 0);
+
+    } else  {
+      slot_tkn = slots[slot_tkn._unsigned];
+      ret_code = OK;
+    }
+  }
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ * [=tmp][TEMP_SLOT|INVARIANT_SLOT][resolved sub-expression] -> [resolved sub-expression]
+ * Save the sub-expression's result so later uses of the same slot don't have
+ * to evaluate it again.
+ * ***************************************************************************/
+int RunTimeInterpreter::exec_temp_store (std::vector<Token> & flat_expr_tkns, int opr8r_idx) {
+  int ret_code = GENERAL_FAILURE;
+  Token saved_tkn;
+
+  if (opr8r_idx + 2 >= flat_expr_tkns.size() || (flat_expr_tkns[opr8r_idx + 1].tkn_type != TEMP_SLOT_TKN
+    && flat_expr_tkns[opr8r_idx + 1].tkn_type != INVARIANT_SLOT_TKN))  {
+    SET_FAILED_ON_SRC_LINE;
+    user_messages->logMsg (INTERNAL_ERROR, L"Expected [=tmp][TEMP_SLOT|INVARIANT_SLOT][sub-expression]", this_src_file, __LINE__, 0);
+
+  } else if (OK != resolveTempSlot (flat_expr_tkns[opr8r_idx + 2])
+    || OK != resolveTknOrVar (flat_expr_tkns[opr8r_idx + 2], saved_tkn))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    std::vector<Token> & slots = (flat_expr_tkns[opr8r_idx + 1].tkn_type == TEMP_SLOT_TKN ? temp_slots : invariant_slots);
+    uint32_t slot_num = flat_expr_tkns[opr8r_idx + 1]._unsigned;
+    if (slot_num >= slots.size())
+      slots.resize (slot_num + 1);
+
+    saved_tkn.isInitialized = true;
+    slots[slot_num] = saved_tkn;
+    flat_expr_tkns[opr8r_idx] = saved_tkn;
+    flat_expr_tkns.erase (flat_expr_tkns.begin() + opr8r_idx + 1, flat_expr_tkns.begin() + opr8r_idx + 3);
+    ret_code = OK;
+  }
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ * [?sel][# of keys][selector][sorted keys][values in key order][default value]
+ * -> [selected value]
+ * Compiler turned a chain of [?] OPR8Rs comparing the same integer variable to
+ * integer literals into this.  Keys that run without gaps get indexed straight
+ * into; otherwise they get binary searched.  Only the selected value gets
+ * evaluated; the rest get short-circuited.
+ * ***************************************************************************/
+int RunTimeInterpreter::exec_lookup_select (std::vector<Token> & flat_expr_tkns, int opr8r_idx) {
+  int ret_code = GENERAL_FAILURE;
+  int expected_ret_tkn_cnt;
+  int selector_idx = opr8r_idx + 2;
+  int keys_idx = opr8r_idx + 3;
+  int64_t num_keys = 0, first_key, last_key;
+
+  if (opr8r_idx + 1 < flat_expr_tkns.size() && flat_expr_tkns[opr8r_idx + 1].isUnsigned())
+    num_keys = flat_expr_tkns[opr8r_idx + 1]._unsigned;
+
+  if (num_keys <= 0 || keys_idx + 2 * num_keys >= flat_expr_tkns.size())  {
+    SET_FAILED_ON_SRC_LINE;
+    user_messages->logMsg (INTERNAL_ERROR, L"Expected [?sel][# of keys][selector][keys][values][default]", this_src_file, __LINE__, 0);
+
+  } else if (OK != execFlatExpr_OLR (flat_expr_tkns, selector_idx, expected_ret_tkn_cnt))  {
+    // Resolve the selector
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (!flat_expr_tkns[selector_idx].isSigned() && !flat_expr_tkns[selector_idx].isUnsigned())  {
+    SET_FAILED_ON_SRC_LINE;
+    user_messages->logMsg (INTERNAL_ERROR, L"Lookup table selector is not an integer: " + flat_expr_tkns[selector_idx].descr_sans_line_num_col()
+      , this_src_file, __LINE__, 0);
+
+  } else if (!getLookupKey (flat_expr_tkns[keys_idx], first_key) || !getLookupKey (flat_expr_tkns[keys_idx + num_keys - 1], last_key))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    Token & selector = flat_expr_tkns[selector_idx];
+    // Keys are all non-negative, so a negative selector can't match any of them
+    bool is_in_range = selector.isUnsigned() ? (selector._unsigned <= INT64_MAX) : (selector._signed >= 0);
+    int64_t sel_value = selector.isUnsigned() ? (int64_t)selector._unsigned : selector._signed;
+    int64_t selected_num = num_keys;
+    int64_t key;
+
+    if (!is_in_range || sel_value < first_key || sel_value > last_key)  {
+      // Default value
+
+    } else if (last_key - first_key == num_keys - 1)  {
+      selected_num = sel_value - first_key;
+
+    } else  {
+      int64_t low = 0, high = num_keys - 1, mid;
+
+      while (low <= high && selected_num == num_keys && !failed_on_src_line)  {
+        mid = low + (high - low) / 2;
+        if (!getLookupKey (flat_expr_tkns[keys_idx + mid], key))
+          SET_FAILED_ON_SRC_LINE;
+        else if (key == sel_value)
+          selected_num = mid;
+        else if (key < sel_value)
+          low = mid + 1;
+        else
+          high = mid - 1;
+      }
+    }
+
+    // Step over the values ahead of the selected one
+    int value_idx = keys_idx + num_keys;
+    int last_idx_sub_expr, select_end_idx;
+
+    for (int64_t value_num = 0; value_num < selected_num && !failed_on_src_line; value_num++)  {
+      if (OK != getEndOfSubExprIdx (flat_expr_tkns, value_idx, last_idx_sub_expr))
+        SET_FAILED_ON_SRC_LINE;
+      else
+        value_idx = last_idx_sub_expr + 1;
+    }
+
+    if (failed_on_src_line)  {
+      // Already reported
+
+    } else if (OK != getEndOfSubExprIdx (flat_expr_tkns, value_idx, last_idx_sub_expr)
+      || OK != getEndOfSubExprIdx (flat_expr_tkns, opr8r_idx, select_end_idx))  {
+      SET_FAILED_ON_SRC_LINE;
+
+    } else  {
+      // Short-circuit everything but the selected value
+      flat_expr_tkns.erase (flat_expr_tkns.begin() + last_idx_sub_expr + 1, flat_expr_tkns.begin() + select_end_idx + 1);
+      flat_expr_tkns.erase (flat_expr_tkns.begin() + opr8r_idx, flat_expr_tkns.begin() + value_idx);
+
+      if (flat_expr_tkns[opr8r_idx].tkn_type == EXEC_OPR8R_TKN && OK != execFlatExpr_OLR (flat_expr_tkns, opr8r_idx, expected_ret_tkn_cnt))
+        // Resolving the selected value failed
+        SET_FAILED_ON_SRC_LINE;
+      else if (!failed_on_src_line)
+        ret_code = OK;
+    }
+  }
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ * [+cat][# of pieces][piece]+
+ * Every piece is already resolved.  Add up their lengths, size the result once
+ * and append each piece to it, rather than building a new string for every
+ * [+] along the way.  Variables get read right where they're stored.
+ * ***************************************************************************/
+int RunTimeInterpreter::exec_concat_n (std::vector<Token> & flat_expr_tkns, int opr8r_idx, int num_pieces) {
+  int ret_code = GENERAL_FAILURE;
+  int first_piece_idx = opr8r_idx + 2;
+  std::vector<const std::wstring *> pieces;
+  size_t total_len = 0;
+
+  pieces.reserve (num_pieces);
+
+  for (int piece_idx = first_piece_idx; piece_idx < first_piece_idx + num_pieces && !failed_on_src_line; piece_idx++)  {
+    Token * piece_tkn = &flat_expr_tkns[piece_idx];
+    scopeVar * var_handle;
+
+    if (piece_tkn->tkn_type == USER_WORD_TKN)  {
+      if (OK != scope_name_space->getVarHandle (piece_tkn->_string, 0, var_handle))  {
+        SET_FAILED_ON_SRC_LINE;
+        user_messages->logMsg (INTERNAL_ERROR, L"Failed to find variable " + piece_tkn->_string, this_src_file, __LINE__, 0);
+
+      } else  {
+        piece_tkn = &var_handle->value;
+      }
+    }
+
+    if (failed_on_src_line)  {
+      // Already reported
+
+    } else if (piece_tkn->tkn_type != STRING_TKN)  {
+      SET_FAILED_ON_SRC_LINE;
+      user_messages->logMsg (INTERNAL_ERROR, L"Expected a STRING to concatenate but got " + piece_tkn->descr_sans_line_num_col()
+        , this_src_file, __LINE__, 0);
+
+    } else  {
+      pieces.push_back (&piece_tkn->_string.str());
+      total_len += piece_tkn->_string.length();
+    }
+  }
+
+  if (!failed_on_src_line)  {
+    std::wstring joined;
+    joined.reserve (total_len);
+
+    for (auto piece : pieces)
+      joined.append (*piece);
+
+    flat_expr_tkns[opr8r_idx].resetToString (std::move (joined));
+    ret_code = OK;
+  }
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ * Lookup table keys are non-negative integer literals
+ * ***************************************************************************/
+bool RunTimeInterpreter::getLookupKey (Token & key_tkn, int64_t & key)  {
+  bool is_key = false;
+
+  if (key_tkn.isUnsigned() && key_tkn._unsigned <= INT64_MAX)  {
+    key = key_tkn._unsigned;
+    is_key = true;
+
+  } else if (key_tkn.isSigned() && key_tkn._signed >= 0)  {
+    key = key_tkn._signed;
+    is_key = true;
+
+  } else  {
+    user_messages->logMsg (INTERNAL_ERROR, L"Unexpected lookup table key: " + key_tkn.descr_sans_line_num_col(), this_src_file, __LINE__, 0);
+  }
+
+  return is_key;
+}
+
+/* ****************************************************************************
+ * Encountered the IF_SCOPE_OPCODE. Evaluate the conditional to determine if 
+ * the enclosed block will be executed.  Check for follow on [else if] and|or
+ * [else] blocks at the same scope. We'll need to know where the scope that
+ * encloses this [if] block ends.
+ * [op_code][total_length][conditional EXPRESSION][code block]
+ * ***************************************************************************/
+int RunTimeInterpreter::exec_if_block (uint32_t scope_start_pos, uint32_t if_scope_len
+  , uint32_t after_parent_scope_pos, uint32_t & break_scope_end_pos)  {
+  
+  int ret_code = GENERAL_FAILURE;
+  break_scope_end_pos = 0;
+
+  bool is_else_blocks_done = false;
+  bool is_if_cond_true = false;
+  uint32_t pos_after_else_scope = 0;
+  uint8_t curr_obj_op_code = INVALID_OPCODE;
+  uint32_t curr_obj_start_pos = 0;
+  uint32_t curr_obj_len = 0;
+  uint32_t nxt_obj_start_pos = 0;
+  Token if_cond_tkn;
+
+  if (OK != execExpression(scope_start_pos + OPCODE_NUM_BYTES + NUM_BYTES_IN_DWORD, if_cond_tkn)) {
+    SET_FAILED_ON_SRC_LINE;
+  
+  } else if (if_cond_tkn.evalResolvedTokenAsIf()) {
+    // [if] condition is TRUE, so execute the code block
+    is_if_cond_true = true;
+    if (OK != execCurrScope(file_reader.getPos(), scope_start_pos + if_scope_len, break_scope_end_pos))
+      SET_FAILED_ON_SRC_LINE;
+
+
+  } else {
+    // [if] condition is FALSE, so jump around the [if] block
+    file_reader.setPos(scope_start_pos + if_scope_len);
+  }
+
+  if (!failed_on_src_line)  {
+    bool is_skip_block;
+
+    while (!is_else_blocks_done && !failed_on_src_line) {
+      // Consume any [else if][else] blocks after our initial [if] block
+      curr_obj_start_pos = file_reader.getPos();
+      is_skip_block = false;
+
+      if (curr_obj_start_pos == after_parent_scope_pos) {
+        // We've just gone past the parent scope that contains the [if] block
+        // and any chained [else if]+, [else] blocks
+        is_else_blocks_done = true;
+
+      } else if (OK != file_reader.peekNextByte(curr_obj_op_code))  {
+        SET_FAILED_ON_SRC_LINE;
+
+      } else if (curr_obj_op_code != ELSE_IF_SCOPE_OPCODE && curr_obj_op_code != ELSE_SCOPE_OPCODE) {
+        is_else_blocks_done = true;
 
       } else  {
         if (OK != file_reader.readNextByte(curr_obj_op_code)) 
@@ -2537,16 +2996,18 @@ int RunTimeInterpreter::get_expr_from_var_declaration (uint32_t start_pos, std::
 }
 
 /* ****************************************************************************
- * 
+ * The cached list is left alone; it gets resolved in a working copy that hangs
+ * on to its storage from one loop trip to the next.
  * ***************************************************************************/
- int RunTimeInterpreter::exec_cached_expr (std::vector<Token> expr_tkn_list, bool & is_result_true) {
+ int RunTimeInterpreter::exec_cached_expr (const std::vector<Token> & expr_tkn_list, bool & is_result_true) {
   int ret_code = GENERAL_FAILURE;
-  Token result_tkn;
   int expected_ret_tkn_cnt;
 
-  if (OK == resolveFlatExpr(expr_tkn_list, expected_ret_tkn_cnt) && expected_ret_tkn_cnt == 1
-    && expr_tkn_list.size() == 1) {
-    is_result_true = expr_tkn_list[0].evalResolvedTokenAsIf();
+  cached_expr_work = expr_tkn_list;
+
+  if (OK == resolveFlatExpr(cached_expr_work, expected_ret_tkn_cnt) && expected_ret_tkn_cnt == 1
+    && cached_expr_work.size() == 1) {
+    is_result_true = cached_expr_work[0].evalResolvedTokenAsIf();
     ret_code = OK;
   }
 
@@ -2555,71 +3016,217 @@ int RunTimeInterpreter::get_expr_from_var_declaration (uint32_t start_pos, std::
 }
 
 /* ****************************************************************************
- * FOR_SCOPE_OPCODE 0x6D
- * [op_code][total_length][init_expression][conditional_expression][last_expression][code_block]
+ * A counted [for] loop's conditional is [<|<=|>|>=|!=][var][limit] and its last
+ * expression is [++|--][var] or [+=|-=][var][step]; the compiler made sure
+ * nothing else in the loop writes to var. The conditional just came back TRUE,
+ * so work out how many more trips it would come back TRUE for. Anything that
+ * doesn't fit leaves trips_left at 0, and the loop just checks its conditional
+ * the regular way.
  * ***************************************************************************/
- int RunTimeInterpreter::exec_for_loop (uint32_t for_scope_start, uint32_t for_scope_len, uint32_t after_parent_scope_pos
-  , uint32_t & break_scope_end_pos)  {
-  
+int RunTimeInterpreter::get_loop_trips_left (std::vector<Token> & cond_expr_tkn_list, std::vector<Token> & last_expr_tkn_list
+  , uint64_t & trips_left)  {
   int ret_code = GENERAL_FAILURE;
-  break_scope_end_pos = 0;
-  uint8_t op_code;
-  uint32_t init_expr_pos = for_scope_start + OPCODE_NUM_BYTES + NUM_BYTES_IN_DWORD;
-  uint32_t cond_expr_pos, cond_expr_len, last_expr_pos, last_expr_len;
-  Token conditional_result, empty_tkn;
-  uint32_t init_expr_len;
-  std::vector<Token> cond_expr_tkn_list;
-  std::vector<Token> last_expr_tkn_list;
-  bool is_for_scopened = false;
-  int num_for_loops_done = 0;
+  Token var_tkn, limit_tkn;
+  int64_t start, limit, step = 0, num_trips;
 
-  if (OK == file_reader.setPos(init_expr_pos) 
-    && OK == file_reader.readNextByte(op_code)) {
-    // Exec initialization expression OR variable declaration
+  trips_left = 0;
 
-    if (OK == scope_name_space->openNewScope(FOR_SCOPE_OPCODE, empty_tkn, for_scope_start, for_scope_len))
-      is_for_scopened = true;
-    else
-      SET_FAILED_ON_SRC_LINE;
-    
-    if (!failed_on_src_line && op_code == VARIABLES_DECLARATION_OPCODE)  { 
-      // Need to put variables into for loop's scope
-      if (OK != file_reader.readNextDword(init_expr_len))
-        SET_FAILED_ON_SRC_LINE;
-      else if (OK != execVarDeclaration (init_expr_pos, init_expr_len))
-        SET_FAILED_ON_SRC_LINE;
+  if (cond_expr_tkn_list.size() != 3 || cond_expr_tkn_list[0].tkn_type != EXEC_OPR8R_TKN || cond_expr_tkn_list[1].tkn_type != USER_WORD_TKN
+    || last_expr_tkn_list.size() < 2 || last_expr_tkn_list[0].tkn_type != EXEC_OPR8R_TKN
+    || last_expr_tkn_list[1].tkn_type != USER_WORD_TKN || last_expr_tkn_list[1]._string != cond_expr_tkn_list[1]._string)  {
+    // Not the shape the compiler promised; no harm done
+    ret_code = OK;
 
-    } else if (!failed_on_src_line && op_code == EXPRESSION_OPCODE)  {
-      
-      if (OK != file_reader.readNextDword(init_expr_len)) 
-        SET_FAILED_ON_SRC_LINE;
-      
-      else if (OK != execExpression (init_expr_pos, conditional_result))
-        SET_FAILED_ON_SRC_LINE;
-    }
+  } else if (OK != resolveTknOrVar (cond_expr_tkn_list[1], var_tkn)
+    || OK != resolveTknOrVar (cond_expr_tkn_list[2], limit_tkn) || OK != resolveTempSlot (limit_tkn))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    uint8_t last_op_code = last_expr_tkn_list[0]._unsigned;
+    ret_code = OK;
+
+    if (last_expr_tkn_list.size() == 2 && (last_op_code == POST_INCR_OPR8R_OPCODE || last_op_code == PRE_INCR_OPR8R_OPCODE))
+      step = 1;
+    else if (last_expr_tkn_list.size() == 2 && (last_op_code == POST_DECR_OPR8R_OPCODE || last_op_code == PRE_DECR_OPR8R_OPCODE))
+      step = -1;
+    else if (last_expr_tkn_list.size() == 3 && (last_op_code == PLUS_ASSIGN_OPR8R_OPCODE || last_op_code == MINUS_ASSIGN_OPR8R_OPCODE)
+      && util.getCountedLoopValue (last_expr_tkn_list[2], step))
+      step = (last_op_code == PLUS_ASSIGN_OPR8R_OPCODE ? step : -step);
+
+    if (step != 0 && util.getCountedLoopValue (var_tkn, start) && util.getCountedLoopValue (limit_tkn, limit)
+      // Keep unsigned values from ever being compared against a negative
+      && !((var_tkn.isUnsigned() || limit_tkn.isUnsigned()) && (start < 0 || limit < 0))
+      && util.calcLoopTripCount (cond_expr_tkn_list[0]._unsigned, start, limit, step, num_trips) && num_trips > 1)
+      // The conditional already came back TRUE for this trip
+      trips_left = num_trips - 1;
   }
 
-  if (!failed_on_src_line) {
-    // Get conditional expression or single variable declaration with init expression and store it in a copy list
-    cond_expr_pos = init_expr_pos + init_expr_len;
- 
-    if (OK != file_reader.setPos(cond_expr_pos) || OK != file_reader.readNextByte(op_code)) {
-      SET_FAILED_ON_SRC_LINE;
+  return ret_code;
+}
 
-    } else if (op_code == VARIABLES_DECLARATION_OPCODE)  { 
-        // Need to put what should be *SINGLE* variable into for loop's scope
-        if (OK != file_reader.readNextDword(cond_expr_len))  {
-          SET_FAILED_ON_SRC_LINE;
-        
-        }  else if (OK != execVarDeclaration (cond_expr_pos, cond_expr_len))  {
-          SET_FAILED_ON_SRC_LINE;
+/* ****************************************************************************
+ * Exec initialization expression OR variable declaration of a [for] loop whose
+ * scope has already been opened
+ * ***************************************************************************/
+int RunTimeInterpreter::exec_for_loop_init (uint32_t init_expr_pos, uint32_t & init_expr_len)  {
+  int ret_code = GENERAL_FAILURE;
+  uint8_t op_code;
+  Token result_tkn;
 
-        } else if (OK != get_expr_from_var_declaration (cond_expr_pos, cond_expr_tkn_list))  {
-          // Extracting conditional expression from VARIABLES_DECLARATION failed
-          SET_FAILED_ON_SRC_LINE;
-        }
+  if (OK != file_reader.setPos(init_expr_pos) || OK != file_reader.readNextByte(op_code)
+    || OK != file_reader.readNextDword(init_expr_len))  {
+    SET_FAILED_ON_SRC_LINE;
 
-    } else if (op_code == EXPRESSION_OPCODE)  {
+  } else if (op_code == VARIABLES_DECLARATION_OPCODE && OK != execVarDeclaration (init_expr_pos, init_expr_len))  {
+    // Need to put variables into for loop's scope
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (op_code == EXPRESSION_OPCODE && OK != execExpression (init_expr_pos, result_tkn))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    ret_code = OK;
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * UNROLLED_FOR_SCOPE_OPCODE 0x72
+ * [op_code][total_length][init_expression][last_expression][repeat count]
+ *   [trips per block][code_block length][unrolled block][remainder block]
+ * The compiler already worked out how many trips the loop makes and laid the
+ * code blocks out back to back, so there's no conditional to check. The last
+ * expression gets cached and run after each copy of the code block.
+ * ***************************************************************************/
+int RunTimeInterpreter::exec_unrolled_for_loop (uint32_t for_scope_start, uint32_t for_scope_len, uint32_t & break_scope_end_pos)  {
+  int ret_code = GENERAL_FAILURE;
+  uint32_t init_expr_pos = for_scope_start + OPCODE_NUM_BYTES + NUM_BYTES_IN_DWORD;
+  uint32_t init_expr_len, last_expr_pos, last_expr_len, repeat_cnt, trips_per_block, code_block_len;
+  uint32_t for_scope_end_boundary_pos = for_scope_start + for_scope_len;
+  std::vector<Token> last_expr_tkn_list;
+  Token empty_tkn;
+  bool is_for_scopened = false, tmp_bool;
+
+  break_scope_end_pos = 0;
+
+  if (OK == scope_name_space->openNewScope(FOR_SCOPE_OPCODE, empty_tkn, for_scope_start, for_scope_len))
+    is_for_scopened = true;
+  else
+    SET_FAILED_ON_SRC_LINE;
+
+  if (!failed_on_src_line && OK != exec_for_loop_init (init_expr_pos, init_expr_len))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (!failed_on_src_line)  {
+    last_expr_pos = init_expr_pos + init_expr_len;
+
+    if (OK != file_reader.setPos (last_expr_pos + OPCODE_NUM_BYTES) || OK != file_reader.readNextDword (last_expr_len)
+      || OK != file_reader.setPos (last_expr_pos) || OK != file_reader.readExprIntoList (last_expr_tkn_list)
+      || OK != file_reader.setPos (last_expr_pos + last_expr_len) || OK != file_reader.readNextDword (repeat_cnt)
+      || OK != file_reader.readNextDword (trips_per_block) || OK != file_reader.readNextDword (code_block_len))
+      SET_FAILED_ON_SRC_LINE;
+  }
+
+  if (!failed_on_src_line)  {
+    uint32_t block_start_pos = last_expr_pos + last_expr_len + 3 * NUM_BYTES_IN_DWORD;
+    uint32_t block_end_pos = block_start_pos + trips_per_block * code_block_len;
+    uint32_t copy_pos;
+
+    if (code_block_len == 0)  {
+      // Compiler doesn't unroll an empty code block, so there's no way to step through the copies
+      user_messages->logMsg (INTERNAL_ERROR, L"Unrolled [for] loop has an empty code block", this_src_file, __LINE__, 0);
+      SET_FAILED_ON_SRC_LINE;
+      repeat_cnt = 0;
+      block_end_pos = for_scope_end_boundary_pos;
+    }
+
+    for (uint32_t rep_num = 0; rep_num <= repeat_cnt && !failed_on_src_line && 0 == break_scope_end_pos; rep_num++)  {
+      // Unrolled block gets repeated, then the remainder block runs once
+      uint32_t copies_start_pos = (rep_num < repeat_cnt) ? block_start_pos : block_end_pos;
+      uint32_t copies_end_pos = (rep_num < repeat_cnt) ? block_end_pos : for_scope_end_boundary_pos;
+
+      for (copy_pos = copies_start_pos; copy_pos < copies_end_pos && !failed_on_src_line && 0 == break_scope_end_pos
+        ; copy_pos += code_block_len)  {
+        if (OK != execCurrScope (copy_pos, copy_pos + code_block_len, break_scope_end_pos))  {
+          SET_FAILED_ON_SRC_LINE;
+
+        } else if (0 == break_scope_end_pos && !last_expr_tkn_list.empty() && OK != exec_cached_expr (last_expr_tkn_list, tmp_bool))  {
+          SET_FAILED_ON_SRC_LINE;
+        }
+      }
+    }
+
+    if (break_scope_end_pos == for_scope_end_boundary_pos)
+      // [break]ing out of this loop; no need to bubble up
+      break_scope_end_pos = 0;
+  }
+
+  closeScopeErr closeErr;
+  if (is_for_scopened && OK != scope_name_space->closeTopScope (FOR_SCOPE_OPCODE, closeErr, false)) 
+    SET_FAILED_ON_SRC_LINE;
+
+  if (!failed_on_src_line && OK != file_reader.setPos (for_scope_end_boundary_pos))
+    SET_FAILED_ON_SRC_LINE;
+
+  if (!failed_on_src_line)
+    ret_code = OK;
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * FOR_SCOPE_OPCODE 0x6D
+ * COUNTED_FOR_SCOPE_OPCODE 0x71
+ * [op_code][total_length][init_expression][conditional_expression][last_expression][code_block]
+ * A counted loop checks its conditional on the way in, works out how many trips
+ * are left, and only checks the conditional again once those have been done.
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_for_loop (uint8_t for_op_code, uint32_t for_scope_start, uint32_t for_scope_len
+  , uint32_t after_parent_scope_pos, uint32_t & break_scope_end_pos)  {
+  
+  int ret_code = GENERAL_FAILURE;
+  break_scope_end_pos = 0;
+  uint8_t op_code;
+  uint32_t init_expr_pos = for_scope_start + OPCODE_NUM_BYTES + NUM_BYTES_IN_DWORD;
+  uint32_t cond_expr_pos, cond_expr_len, last_expr_pos, last_expr_len;
+  Token conditional_result, empty_tkn;
+  uint32_t init_expr_len;
+  std::vector<Token> cond_expr_tkn_list;
+  std::vector<Token> last_expr_tkn_list;
+  bool is_for_scopened = false;
+  int num_for_loops_done = 0;
+  bool is_body_entered = false;
+
+  if (OK == scope_name_space->openNewScope(FOR_SCOPE_OPCODE, empty_tkn, for_scope_start, for_scope_len))
+    is_for_scopened = true;
+  else
+    SET_FAILED_ON_SRC_LINE;
+
+  if (!failed_on_src_line && OK != exec_for_loop_init (init_expr_pos, init_expr_len))
+    SET_FAILED_ON_SRC_LINE;
+
+  if (!failed_on_src_line) {
+    // Get conditional expression or single variable declaration with init expression and store it in a copy list
+    cond_expr_pos = init_expr_pos + init_expr_len;
+ 
+    if (OK != file_reader.setPos(cond_expr_pos) || OK != file_reader.readNextByte(op_code)) {
+      SET_FAILED_ON_SRC_LINE;
+
+    } else if (op_code == VARIABLES_DECLARATION_OPCODE)  { 
+        // Need to put what should be *SINGLE* variable into for loop's scope
+        if (OK != file_reader.readNextDword(cond_expr_len))  {
+          SET_FAILED_ON_SRC_LINE;
+        
+        }  else if (OK != execVarDeclaration (cond_expr_pos, cond_expr_len))  {
+          SET_FAILED_ON_SRC_LINE;
+
+        } else if (OK != get_expr_from_var_declaration (cond_expr_pos, cond_expr_tkn_list))  {
+          // Extracting conditional expression from VARIABLES_DECLARATION failed
+          SET_FAILED_ON_SRC_LINE;
+        }
+
+    } else if (op_code == EXPRESSION_OPCODE)  {
       if (OK != file_reader.setPos(cond_expr_pos + OPCODE_NUM_BYTES))
         SET_FAILED_ON_SRC_LINE;
       else if (OK != file_reader.readNextDword(cond_expr_len))
@@ -2658,18 +3265,32 @@ int RunTimeInterpreter::get_expr_from_var_declaration (uint32_t start_pos, std::
     uint32_t code_block_start_pos = last_expr_pos + last_expr_len;
     bool is_for_cond_true = true, tmp_bool;
     uint32_t for_scope_end_boundary_pos = for_scope_start + for_scope_len;
+    bool is_trip_cnt_done = (for_op_code != COUNTED_FOR_SCOPE_OPCODE);
+    uint64_t trips_left = 0;
 
 
     while (is_for_cond_true && !failed_on_src_line) {
       // Execute the conditional expression at top of loop
-      if (cond_expr_tkn_list.empty())  {
+      if (trips_left > 0)  {
+        // Counted loop already knows the conditional is TRUE
+        trips_left--;
+        is_for_cond_true = true;
+
+      } else if (cond_expr_tkn_list.empty())  {
         // An empty conditional expression is OK. Hopefully the compiler checked for a [break] statement inside the loop
         is_for_cond_true = true;
       
       } else if (OK != exec_cached_expr (cond_expr_tkn_list, is_for_cond_true))  {
         SET_FAILED_ON_SRC_LINE;
 
-      } else if (is_for_cond_true) {
+      } else if (is_for_cond_true && !is_trip_cnt_done)  {
+        is_trip_cnt_done = true;
+        if (OK != get_loop_trips_left (cond_expr_tkn_list, last_expr_tkn_list, trips_left))
+          SET_FAILED_ON_SRC_LINE;
+      }
+
+      if (!failed_on_src_line && is_for_cond_true) {
+        is_body_entered = true;
         if (OK != execCurrScope(code_block_start_pos, for_scope_end_boundary_pos, break_scope_end_pos)) {
           SET_FAILED_ON_SRC_LINE;
         
@@ -2698,6 +3319,10 @@ int RunTimeInterpreter::get_expr_from_var_declaration (uint32_t start_pos, std::
   if (is_for_scopened && OK != scope_name_space->closeTopScope (FOR_SCOPE_OPCODE, closeErr, false)) 
     SET_FAILED_ON_SRC_LINE;
 
+  // Body never ran, so skip over it
+  if (!failed_on_src_line && !is_body_entered && OK != file_reader.setPos (for_scope_start + for_scope_len))
+    SET_FAILED_ON_SRC_LINE;
+
   if (!failed_on_src_line)
     ret_code = OK;
  
@@ -2721,6 +3346,7 @@ int RunTimeInterpreter::get_expr_from_var_declaration (uint32_t start_pos, std::
   std::vector<Token> cond_expr_tkn_list;
   bool is_while_scopened = false;
   int num_while_loops_done = 0;
+  bool is_body_entered = false;
 
   if (OK == file_reader.setPos(cond_expr_pos) 
     && OK == file_reader.readNextByte(op_code)) {
@@ -2757,6 +3383,7 @@ int RunTimeInterpreter::get_expr_from_var_declaration (uint32_t start_pos, std::
         SET_FAILED_ON_SRC_LINE;
 
       } else if (is_while_cond_true) {
+        is_body_entered = true;
         if (OK != execCurrScope(code_block_start_pos, while_scope_end_boundary_pos, break_scope_end_pos)) {
           SET_FAILED_ON_SRC_LINE;
         
@@ -2782,6 +3409,10 @@ int RunTimeInterpreter::get_expr_from_var_declaration (uint32_t start_pos, std::
   if (is_while_scopened && OK != scope_name_space->closeTopScope (WHILE_SCOPE_OPCODE, closeErr, false)) 
     SET_FAILED_ON_SRC_LINE;
 
+  // Body never ran, so skip over it
+  if (!failed_on_src_line && !is_body_entered && OK != file_reader.setPos (while_scope_start + while_scope_len))
+    SET_FAILED_ON_SRC_LINE;
+
   if (!failed_on_src_line)
     ret_code = OK;
 
@@ -2790,24 +3421,23 @@ int RunTimeInterpreter::get_expr_from_var_declaration (uint32_t start_pos, std::
 }
 
 /* ****************************************************************************
- * This fxn acts as a "routing table" to get the proper system call invoked
- * This fxn is a great candidate for extending with derived classes to add 
- * more functionality. 
- * Will re-visit this if there is a future need
+ * The system call Token holds its ID, which indexes straight into the system
+ * call table kept by CompileExecTerms
  * ***************************************************************************/
  int RunTimeInterpreter::exec_system_call (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
 
   int ret_code = GENERAL_FAILURE;
 
   if (sys_call_idx >= 0 && sys_call_idx < flat_expr_tkns.size())  {
-    std::wstring sys_call = flat_expr_tkns[sys_call_idx]._string;
+    const systemCall * sys_call = exec_terms.get_system_call (flat_expr_tkns[sys_call_idx]._unsigned);
 
-    if (sys_call == SYS_CALL_STR) {
-      ret_code = exec_sys_call_str (flat_expr_tkns, sys_call_idx);
-    
-    } else if (sys_call == SYS_CALL_PRINT_LINE) {
-      ret_code = exec_sys_call_print_line(flat_expr_tkns, sys_call_idx);
-    
+    if (sys_call == NULL)  {
+      SET_FAILED_ON_SRC_LINE;
+      user_messages->logMsg (INTERNAL_ERROR, L"Unknown system call ID " + NumberFormatter::toHexStr (flat_expr_tkns[sys_call_idx]._unsigned)
+        , this_src_file, failed_on_src_line, 0);
+
+    } else  {
+      ret_code = (this->*sys_call->exec_fxn) (flat_expr_tkns, sys_call_idx);
     }
   }
 
@@ -2825,25 +3455,26 @@ int RunTimeInterpreter::get_expr_from_var_declaration (uint32_t start_pos, std::
   std::wstring token_str;
 
   if (flat_expr_tkns.size() >= sys_call_idx + 2) {
-    Token param_tkn = flat_expr_tkns[sys_call_idx + 1];
+    Token & param_tkn = flat_expr_tkns[sys_call_idx + 1];
 
     if (param_tkn.tkn_type == USER_WORD_TKN) {
-      std::wstring lookUpMsg;
-      if (OK != scope_name_space->findVar(param_tkn._string, 0, scratch_tkn, READ_ONLY, lookUpMsg)) {
+      scopeVar * var_handle;
+      if (OK != scope_name_space->getVarHandle (param_tkn._string, 0, var_handle)) {
           user_messages->logMsg (INTERNAL_ERROR, L"Variable " + param_tkn._string + L" was not declared"
             , usr_src_file_name, param_tkn.get_line_number(), param_tkn.get_column_pos());
         SET_FAILED_ON_SRC_LINE;
       
       } else {
-        token_str = scratch_tkn.getValueStr();
+        // Format straight from the variable rather than a copy of it
+        var_handle->value.appendValueStr (token_str);
       }
 
     } else {
-      token_str = param_tkn.getValueStr();
+      param_tkn.appendValueStr (token_str);
     }
 
     if (0 == failed_on_src_line)  {
-      flat_expr_tkns[sys_call_idx].resetToString(token_str);
+      flat_expr_tkns[sys_call_idx].resetToString(std::move (token_str));
       // Only need to delete 1 item from the list - the single parameter passed to the SYS_CALL_STR
       flat_expr_tkns.erase(flat_expr_tkns.begin() + sys_call_idx + 1);
       ret_code = OK;      
@@ -2856,7 +3487,7 @@ int RunTimeInterpreter::get_expr_from_var_declaration (uint32_t start_pos, std::
 
  /* ****************************************************************************
  * System call print_line() doesn't have a return value (void), but takes a
- * resolved STRING_TKN and prints it out.
+ * resolved STRING_TKN and prints it out through the OutputSink.
  * ***************************************************************************/
  int RunTimeInterpreter::exec_sys_call_print_line (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
 
@@ -2864,10 +3495,15 @@ int RunTimeInterpreter::get_expr_from_var_declaration (uint32_t start_pos, std::
   std::wstring token_str;
 
   if (flat_expr_tkns.size() >= sys_call_idx + 2) {
-    Token param_tkn = flat_expr_tkns[sys_call_idx + 1];
+    Token & param_tkn = flat_expr_tkns[sys_call_idx + 1];
+
+    if (param_tkn.tkn_type != STRING_TKN) {
+      // Not expected
 
-    if (param_tkn.tkn_type == STRING_TKN) {
-      std::wcout << param_tkn._string << std::endl;
+    } else if (OK != output_sink->writeLine (param_tkn._string))  {
+      user_messages->logMsg (INTERNAL_ERROR, L"Failed writing out program output", this_src_file, __LINE__, 0);
+
+    } else  {
       // Delete 2 items from the list - print_line sys_call and the single parameter passed to it
       flat_expr_tkns.erase(flat_expr_tkns.begin() + sys_call_idx, flat_expr_tkns.begin() + sys_call_idx + 2);
       ret_code = OK;      
@@ -2877,3 +3513,964 @@ int RunTimeInterpreter::get_expr_from_var_declaration (uint32_t start_pos, std::
   return ret_code;
 
  }
+
+/* ****************************************************************************
+ * min() and max() hand back whichever parameter wins, as is
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_sys_call_min (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
+  return (exec_min_or_max (flat_expr_tkns, sys_call_idx, true));
+ }
+
+ int RunTimeInterpreter::exec_sys_call_max (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
+  return (exec_min_or_max (flat_expr_tkns, sys_call_idx, false));
+ }
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_min_or_max (std::vector<Token> & flat_expr_tkns, int sys_call_idx, bool is_min)  {
+  int ret_code = GENERAL_FAILURE;
+  Token params [2];
+
+  if (OK == resolve_math_params (flat_expr_tkns, sys_call_idx, 2, params))  {
+    bool is_1st_less = is_less_than_num (params[0], params[1]);
+
+    if (is_min == is_1st_less)
+      flat_expr_tkns[sys_call_idx] = params[0];
+    else
+      flat_expr_tkns[sys_call_idx] = params[1];
+
+    ret_code = end_sys_call (flat_expr_tkns, sys_call_idx, 2);
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * Same data type in as out; abs() of the most negative int64 wraps around
+ * the same way [-U] does
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_sys_call_abs (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
+  int ret_code = GENERAL_FAILURE;
+  Token params [1];
+
+  if (OK == resolve_math_params (flat_expr_tkns, sys_call_idx, 1, params))  {
+    Token & result_tkn = flat_expr_tkns[sys_call_idx];
+
+    if (params[0].tkn_type == DOUBLE_TKN)
+      result_tkn.resetToDouble (std::fabs (params[0]._double));
+    else if (params[0].isSigned() && params[0]._signed < 0)
+      result_tkn.resetToSigned ((int64_t) (0 - (uint64_t) params[0]._signed));
+    else
+      result_tkn = params[0];
+
+    ret_code = end_sys_call (flat_expr_tkns, sys_call_idx, 1);
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * A double on either side makes for a double result.  Otherwise the result is
+ * an integer of the same signedness as the base, worked out by squaring and
+ * wrapping around on overflow the same way [*] does.  A negative exponent
+ * gives what 1 / (base ^ -exponent) would in integer math.
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_sys_call_pow (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
+  int ret_code = GENERAL_FAILURE;
+  Token params [2];
+
+  if (OK == resolve_math_params (flat_expr_tkns, sys_call_idx, 2, params))  {
+    Token & result_tkn = flat_expr_tkns[sys_call_idx];
+
+    if (params[0].tkn_type == DOUBLE_TKN || params[1].tkn_type == DOUBLE_TKN)  {
+      result_tkn.resetToDouble (std::pow (get_as_double (params[0]), get_as_double (params[1])));
+      ret_code = OK;
+
+    } else  {
+      uint64_t base = params[0].isSigned() ? (uint64_t) params[0]._signed : params[0]._unsigned;
+      uint64_t exponent = params[1].isSigned() ? (uint64_t) params[1]._signed : params[1]._unsigned;
+      uint64_t result = 1;
+      bool is_neg_exponent = params[1].isSigned() && params[1]._signed < 0;
+      bool is_neg_one = params[0].isSigned() && params[0]._signed == -1;
+
+      if (!is_neg_exponent)  {
+        while (exponent > 0)  {
+          if (exponent & 0x1)
+            result *= base;
+          base *= base;
+          exponent >>= 1;
+        }
+        ret_code = OK;
+
+      } else if (base == 0)  {
+        user_messages->logMsg (USER_ERROR, L"pow() of 0 to a negative power", usr_src_file_name
+          , flat_expr_tkns[sys_call_idx].get_line_number(), flat_expr_tkns[sys_call_idx].get_column_pos());
+
+      } else  {
+        if (is_neg_one)
+          result = (exponent & 0x1) ? (uint64_t) -1 : 1;
+        else if (base != 1)
+          result = 0;
+        ret_code = OK;
+      }
+
+      if (OK == ret_code && params[0].isSigned())
+        result_tkn.resetToSigned ((int64_t) result);
+      else if (OK == ret_code)
+        result_tkn.resetToUnsigned (result);
+    }
+
+    if (OK == ret_code)
+      ret_code = end_sys_call (flat_expr_tkns, sys_call_idx, 2);
+    else
+      SET_FAILED_ON_SRC_LINE;
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * Always a double
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_sys_call_sqrt (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
+  int ret_code = GENERAL_FAILURE;
+  Token params [1];
+
+  if (OK == resolve_math_params (flat_expr_tkns, sys_call_idx, 1, params))  {
+    flat_expr_tkns[sys_call_idx].resetToDouble (std::sqrt (get_as_double (params[0])));
+    ret_code = end_sys_call (flat_expr_tkns, sys_call_idx, 1);
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * Integers are already as low as they go
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_sys_call_floor (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
+  int ret_code = GENERAL_FAILURE;
+  Token params [1];
+
+  if (OK == resolve_math_params (flat_expr_tkns, sys_call_idx, 1, params))  {
+    if (params[0].tkn_type == DOUBLE_TKN)
+      flat_expr_tkns[sys_call_idx].resetToDouble (std::floor (params[0]._double));
+    else
+      flat_expr_tkns[sys_call_idx] = params[0];
+
+    ret_code = end_sys_call (flat_expr_tkns, sys_call_idx, 1);
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * Fill in params with the values of the num_params parameters that follow the
+ * math system call, looking up any variables along the way
+ * ***************************************************************************/
+ int RunTimeInterpreter::resolve_math_params (std::vector<Token> & flat_expr_tkns, int sys_call_idx, int num_params, Token * params)  {
+  int ret_code = GENERAL_FAILURE;
+
+  if (sys_call_idx >= 0 && flat_expr_tkns.size() > sys_call_idx + num_params)  {
+    ret_code = OK;
+
+    for (int idx = 0; idx < num_params && OK == ret_code; idx++)  {
+      if (OK != resolveTknOrVar (flat_expr_tkns[sys_call_idx + 1 + idx], params[idx]))  {
+        SET_FAILED_ON_SRC_LINE;
+        ret_code = GENERAL_FAILURE;
+
+      } else if (!params[idx].isSigned() && !params[idx].isUnsigned() && params[idx].tkn_type != DOUBLE_TKN)  {
+        SET_FAILED_ON_SRC_LINE;
+        user_messages->logMsg (INTERNAL_ERROR, L"System call [" + flat_expr_tkns[sys_call_idx]._string + L"] expects a number but got "
+          + params[idx].descr_sans_line_num_col(), this_src_file, failed_on_src_line, 0);
+        ret_code = GENERAL_FAILURE;
+      }
+    }
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * Result already sits where the system call was; drop its parameters
+ * ***************************************************************************/
+ int RunTimeInterpreter::end_sys_call (std::vector<Token> & flat_expr_tkns, int sys_call_idx, int num_params)  {
+  flat_expr_tkns[sys_call_idx].isInitialized = true;
+  flat_expr_tkns.erase (flat_expr_tkns.begin() + sys_call_idx + 1, flat_expr_tkns.begin() + sys_call_idx + 1 + num_params);
+
+  return OK;
+ }
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+double RunTimeInterpreter::get_as_double (const Token & num_tkn)  {
+  double as_double;
+
+  if (num_tkn.tkn_type == DOUBLE_TKN)
+    as_double = num_tkn._double;
+  else if (num_tkn.isSigned())
+    as_double = (double) num_tkn._signed;
+  else
+    as_double = (double) num_tkn._unsigned;
+
+  return as_double;
+}
+
+/* ****************************************************************************
+ * Compares by value across signed, unsigned & double; a negative signed is less
+ * than any unsigned
+ * ***************************************************************************/
+bool RunTimeInterpreter::is_less_than_num (const Token & lhs_tkn, const Token & rhs_tkn)  {
+  bool is_less;
+
+  if (lhs_tkn.tkn_type == DOUBLE_TKN || rhs_tkn.tkn_type == DOUBLE_TKN)
+    is_less = get_as_double (lhs_tkn) < get_as_double (rhs_tkn);
+  else if (lhs_tkn.isSigned() && rhs_tkn.isSigned())
+    is_less = lhs_tkn._signed < rhs_tkn._signed;
+  else if (lhs_tkn.isSigned())
+    is_less = (lhs_tkn._signed < 0 || (uint64_t) lhs_tkn._signed < rhs_tkn._unsigned);
+  else if (rhs_tkn.isSigned())
+    is_less = (rhs_tkn._signed >= 0 && lhs_tkn._unsigned < (uint64_t) rhs_tkn._signed);
+  else
+    is_less = lhs_tkn._unsigned < rhs_tkn._unsigned;
+
+  return is_less;
+}
+
+/* ****************************************************************************
+ * length(text) -> # of characters
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_sys_call_length (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
+  int ret_code = GENERAL_FAILURE;
+  const InternedString * text;
+
+  if (OK == get_string_param (flat_expr_tkns, sys_call_idx + 1, text))  {
+    flat_expr_tkns[sys_call_idx].resetToUnsigned (text->length());
+    ret_code = end_sys_call (flat_expr_tkns, sys_call_idx, 1);
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * find(text, target) -> position of the 1st target in text, or -1
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_sys_call_find (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
+  int ret_code = GENERAL_FAILURE;
+  const InternedString * text;
+  const InternedString * target;
+
+  if (OK == get_string_param (flat_expr_tkns, sys_call_idx + 1, text) && OK == get_string_param (flat_expr_tkns, sys_call_idx + 2, target))  {
+    size_t found_pos = find_substring (*text, *target, 0);
+
+    flat_expr_tkns[sys_call_idx].resetToSigned (found_pos == std::wstring::npos ? -1 : (int64_t) found_pos);
+    ret_code = end_sys_call (flat_expr_tkns, sys_call_idx, 2);
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * substr(text, start, count) -> up to count characters starting at start.
+ * Running off the end of text just gives back less.
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_sys_call_substr (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
+  int ret_code = GENERAL_FAILURE;
+  const InternedString * text;
+  int64_t start_pos;
+  int64_t num_chars;
+
+  if (OK != get_string_param (flat_expr_tkns, sys_call_idx + 1, text) || OK != get_int_param (flat_expr_tkns, sys_call_idx + 2, start_pos)
+    || OK != get_int_param (flat_expr_tkns, sys_call_idx + 3, num_chars))  {
+    // Already reported
+
+  } else if (start_pos < 0 || num_chars < 0)  {
+    SET_FAILED_ON_SRC_LINE;
+    user_messages->logMsg (USER_ERROR, L"substr() start and count can't be negative", usr_src_file_name
+      , flat_expr_tkns[sys_call_idx].get_line_number(), flat_expr_tkns[sys_call_idx].get_column_pos());
+
+  } else  {
+    size_t text_len = text->length();
+    Token & result_tkn = flat_expr_tkns[sys_call_idx];
+
+    if (start_pos == 0 && num_chars >= text_len)  {
+      // Whole thing; share the characters rather than copy them
+      InternedString whole = *text;
+      result_tkn.resetToString (L"");
+      result_tkn._string = whole;
+
+    } else if (start_pos >= text_len)  {
+      result_tkn.resetToString (L"");
+
+    } else  {
+      result_tkn.resetToString (text->str().substr (start_pos, num_chars));
+    }
+
+    result_tkn.isInitialized = true;
+    ret_code = end_sys_call (flat_expr_tkns, sys_call_idx, 3);
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * replace(text, target, replacement) -> text with every target swapped out
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_sys_call_replace (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
+  int ret_code = GENERAL_FAILURE;
+  const InternedString * text;
+  const InternedString * target;
+  const InternedString * replacement;
+
+  if (OK == get_string_param (flat_expr_tkns, sys_call_idx + 1, text) && OK == get_string_param (flat_expr_tkns, sys_call_idx + 2, target)
+    && OK == get_string_param (flat_expr_tkns, sys_call_idx + 3, replacement))  {
+    const std::wstring & text_str = text->str();
+    size_t found_pos = target->empty() ? std::wstring::npos : find_substring (text_str, *target, 0);
+    Token & result_tkn = flat_expr_tkns[sys_call_idx];
+
+    if (found_pos == std::wstring::npos)  {
+      // Nothing to replace; share the characters rather than copy them
+      InternedString unchanged = *text;
+      result_tkn.resetToString (L"");
+      result_tkn._string = unchanged;
+
+    } else  {
+      std::wstring replaced;
+      size_t copied_up_to = 0;
+
+      replaced.reserve (text_str.length() + (replacement->length() > target->length() ? replacement->length() - target->length() : 0));
+
+      while (found_pos != std::wstring::npos)  {
+        replaced.append (text_str, copied_up_to, found_pos - copied_up_to);
+        replaced.append (*replacement);
+        copied_up_to = found_pos + target->length();
+        found_pos = find_substring (text_str, *target, copied_up_to);
+      }
+
+      replaced.append (text_str, copied_up_to, std::wstring::npos);
+      result_tkn.resetToString (std::move (replaced));
+    }
+
+    result_tkn.isInitialized = true;
+    ret_code = end_sys_call (flat_expr_tkns, sys_call_idx, 3);
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * split_count(text, separator) -> # of fields text splits into; always at
+ * least 1
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_sys_call_split_count (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
+  int ret_code = GENERAL_FAILURE;
+  const InternedString * text;
+  const InternedString * separator;
+
+  if (OK == get_string_param (flat_expr_tkns, sys_call_idx + 1, text) && OK == get_string_param (flat_expr_tkns, sys_call_idx + 2, separator))  {
+    uint64_t num_fields = 1;
+
+    if (!separator->empty())  {
+      size_t found_pos = find_substring (*text, *separator, 0);
+
+      while (found_pos != std::wstring::npos)  {
+        num_fields++;
+        found_pos = find_substring (*text, *separator, found_pos + separator->length());
+      }
+    }
+
+    flat_expr_tkns[sys_call_idx].resetToUnsigned (num_fields);
+    ret_code = end_sys_call (flat_expr_tkns, sys_call_idx, 2);
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * split_field(text, separator, field #) -> that field, counting from 0; empty
+ * if text doesn't have that many fields
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_sys_call_split_field (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
+  int ret_code = GENERAL_FAILURE;
+  const InternedString * text;
+  const InternedString * separator;
+  int64_t field_num;
+
+  if (OK == get_string_param (flat_expr_tkns, sys_call_idx + 1, text) && OK == get_string_param (flat_expr_tkns, sys_call_idx + 2, separator)
+    && OK == get_int_param (flat_expr_tkns, sys_call_idx + 3, field_num))  {
+    const std::wstring & text_str = text->str();
+    size_t field_start = 0;
+    size_t field_end = separator->empty() ? std::wstring::npos : find_substring (text_str, *separator, 0);
+    bool is_field_found = (field_num >= 0);
+
+    for (int64_t field_idx = 0; field_idx < field_num && is_field_found; field_idx++)  {
+      if (field_end == std::wstring::npos)  {
+        is_field_found = false;
+
+      } else  {
+        field_start = field_end + separator->length();
+        field_end = find_substring (text_str, *separator, field_start);
+      }
+    }
+
+    Token & result_tkn = flat_expr_tkns[sys_call_idx];
+
+    if (!is_field_found)
+      result_tkn.resetToString (L"");
+    else
+      result_tkn.resetToString (text_str.substr (field_start, field_end == std::wstring::npos ? std::wstring::npos : field_end - field_start));
+
+    result_tkn.isInitialized = true;
+    ret_code = end_sys_call (flat_expr_tkns, sys_call_idx, 3);
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * compare_ignore_case(text1, text2) -> -1, 0 or 1 as text1 sorts before, the
+ * same as or after text2
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_sys_call_compare_ignore_case (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
+  int ret_code = GENERAL_FAILURE;
+  const InternedString * text1;
+  const InternedString * text2;
+
+  if (OK == get_string_param (flat_expr_tkns, sys_call_idx + 1, text1) && OK == get_string_param (flat_expr_tkns, sys_call_idx + 2, text2))  {
+    const std::wstring & str1 = text1->str();
+    const std::wstring & str2 = text2->str();
+    size_t common_len = std::min (str1.length(), str2.length());
+    int64_t compare_rez = 0;
+
+    if (!text1->isSameRep (*text2))  {
+      for (size_t idx = 0; idx < common_len && compare_rez == 0; idx++)  {
+        wint_t lower1 = std::towlower (str1[idx]);
+        wint_t lower2 = std::towlower (str2[idx]);
+
+        if (lower1 != lower2)
+          compare_rez = (lower1 < lower2 ? -1 : 1);
+      }
+
+      if (compare_rez == 0 && str1.length() != str2.length())
+        compare_rez = (str1.length() < str2.length() ? -1 : 1);
+    }
+
+    flat_expr_tkns[sys_call_idx].resetToSigned (compare_rez);
+    ret_code = end_sys_call (flat_expr_tkns, sys_call_idx, 2);
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * Point string_param at the characters of the STRING parameter, wherever they
+ * live, rather than copy them out of a variable
+ * ***************************************************************************/
+ int RunTimeInterpreter::get_string_param (std::vector<Token> & flat_expr_tkns, int param_idx, const InternedString * & string_param)  {
+  int ret_code = GENERAL_FAILURE;
+  Token * param_tkn = NULL;
+  scopeVar * var_handle;
+
+  if (param_idx >= flat_expr_tkns.size())  {
+    SET_FAILED_ON_SRC_LINE;
+    user_messages->logMsg (INTERNAL_ERROR, L"Missing system call parameter", this_src_file, failed_on_src_line, 0);
+
+  } else if (flat_expr_tkns[param_idx].tkn_type != USER_WORD_TKN)  {
+    param_tkn = &flat_expr_tkns[param_idx];
+
+  } else if (OK != scope_name_space->getVarHandle (flat_expr_tkns[param_idx]._string, 0, var_handle))  {
+    SET_FAILED_ON_SRC_LINE;
+    user_messages->logMsg (INTERNAL_ERROR, L"Failed to find variable " + flat_expr_tkns[param_idx]._string, this_src_file, failed_on_src_line, 0);
+
+  } else  {
+    param_tkn = &var_handle->value;
+  }
+
+  if (param_tkn == NULL)  {
+    // Already reported
+
+  } else if (param_tkn->tkn_type != STRING_TKN)  {
+    SET_FAILED_ON_SRC_LINE;
+    user_messages->logMsg (INTERNAL_ERROR, L"Expected a STRING system call parameter but got " + param_tkn->descr_sans_line_num_col()
+      , this_src_file, failed_on_src_line, 0);
+
+  } else  {
+    string_param = &param_tkn->_string;
+    ret_code = OK;
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+ int RunTimeInterpreter::get_int_param (std::vector<Token> & flat_expr_tkns, int param_idx, int64_t & int_param)  {
+  int ret_code = GENERAL_FAILURE;
+  Token param_tkn;
+
+  if (param_idx >= flat_expr_tkns.size() || OK != resolveTknOrVar (flat_expr_tkns[param_idx], param_tkn))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (param_tkn.isSigned())  {
+    int_param = param_tkn._signed;
+    ret_code = OK;
+
+  } else if (param_tkn.isUnsigned())  {
+    // Anything past INT64_MAX is past the end of any string anyway
+    int_param = (param_tkn._unsigned > INT64_MAX ? INT64_MAX : (int64_t) param_tkn._unsigned);
+    ret_code = OK;
+
+  } else  {
+    SET_FAILED_ON_SRC_LINE;
+    user_messages->logMsg (INTERNAL_ERROR, L"Expected an integer system call parameter but got " + param_tkn.descr_sans_line_num_col()
+      , this_src_file, failed_on_src_line, 0);
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * Position of the 1st needle in haystack at or after start_pos, or npos.
+ * wmemchr skips ahead to each possible 1st character, a vector register's
+ * worth of characters at a time, and wmemcmp checks the rest.
+ * ***************************************************************************/
+size_t RunTimeInterpreter::find_substring (const std::wstring & haystack, const std::wstring & needle, size_t start_pos)  {
+  size_t found_pos = std::wstring::npos;
+  size_t hay_len = haystack.length();
+  size_t needle_len = needle.length();
+
+  if (needle_len == 0)  {
+    if (start_pos <= hay_len)
+      found_pos = start_pos;
+
+  } else  {
+    const wchar_t * hay = haystack.data();
+    size_t curr_pos = start_pos;
+    bool is_done = false;
+
+    while (!is_done && curr_pos + needle_len <= hay_len)  {
+      const wchar_t * first_match = std::wmemchr (hay + curr_pos, needle[0], hay_len - needle_len + 1 - curr_pos);
+
+      if (first_match == NULL)  {
+        is_done = true;
+
+      } else if (0 == std::wmemcmp (first_match + 1, needle.data() + 1, needle_len - 1))  {
+        found_pos = first_match - hay;
+        is_done = true;
+
+      } else  {
+        curr_pos = (first_match - hay) + 1;
+      }
+    }
+  }
+
+  return found_pos;
+}
+
+/* ****************************************************************************
+ * open_file(path, mode) -> file handle, or -1 if the file couldn't be opened.
+ * mode is "r" to read, "w" to write over the file or "a" to append to it.
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_sys_call_open_file (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
+  int ret_code = GENERAL_FAILURE;
+  const InternedString * path;
+  const InternedString * mode;
+
+  if (OK != get_string_param (flat_expr_tkns, sys_call_idx + 1, path) || OK != get_string_param (flat_expr_tkns, sys_call_idx + 2, mode))  {
+    // Already reported
+
+  } else if (*mode != FILE_MODE_READ && *mode != FILE_MODE_WRITE && *mode != FILE_MODE_APPEND)  {
+    SET_FAILED_ON_SRC_LINE;
+    user_messages->logMsg (USER_ERROR, L"open_file() mode must be \"" FILE_MODE_READ L"\", \"" FILE_MODE_WRITE L"\" or \"" FILE_MODE_APPEND
+      L"\" but got \"" + *mode + L"\"", usr_src_file_name, flat_expr_tkns[sys_call_idx].get_line_number(), flat_expr_tkns[sys_call_idx].get_column_pos());
+
+  } else  {
+    std::string path_utf8;
+    openFile new_file;
+    bool is_opened;
+
+    OutputSink::appendUtf8 (*path, path_utf8);
+
+    if (*mode == FILE_MODE_READ)  {
+      new_file.reader = std::make_unique<InputSource> (path_utf8);
+      is_opened = new_file.reader->isOpen();
+    } else  {
+      new_file.writer = std::make_unique<OutputSink> (*mode == FILE_MODE_WRITE ? SINK_TO_FILE : SINK_APPEND_TO_FILE, FLUSH_ON_SIZE, path_utf8);
+      is_opened = new_file.writer->isOpen();
+    }
+
+    int64_t file_handle = -1;
+
+    if (is_opened)  {
+      // Hand out the lowest closed handle 1st, so opening & closing in a loop doesn't keep growing the list
+      for (file_handle = 0; file_handle < open_files.size(); file_handle++)  {
+        if (open_files[file_handle].reader == NULL && open_files[file_handle].writer == NULL)
+          break;
+      }
+
+      if (file_handle == open_files.size())
+        open_files.emplace_back();
+      open_files[file_handle] = std::move (new_file);
+    }
+
+    flat_expr_tkns[sys_call_idx].resetToSigned (file_handle);
+    ret_code = end_sys_call (flat_expr_tkns, sys_call_idx, 2);
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * read_line(file handle) -> next line, without its line ending; empty at the
+ * end of the file
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_sys_call_read_line (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
+  int ret_code = GENERAL_FAILURE;
+  openFile * file;
+  std::wstring text_line;
+
+  if (OK != get_open_file (flat_expr_tkns, sys_call_idx, true, true, file))  {
+    // Already reported
+
+  } else if (OK != file->reader->readLine (text_line))  {
+    SET_FAILED_ON_SRC_LINE;
+    user_messages->logMsg (USER_ERROR, L"read_line() failed reading from file", usr_src_file_name
+      , flat_expr_tkns[sys_call_idx].get_line_number(), flat_expr_tkns[sys_call_idx].get_column_pos());
+
+  } else  {
+    flat_expr_tkns[sys_call_idx].resetToString (std::move (text_line));
+    flat_expr_tkns[sys_call_idx].isInitialized = true;
+    ret_code = end_sys_call (flat_expr_tkns, sys_call_idx, 1);
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * read_chunk(file handle, max chars) -> up to max chars characters, line
+ * endings included; fewer only at the end of the file
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_sys_call_read_chunk (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
+  int ret_code = GENERAL_FAILURE;
+  openFile * file;
+  int64_t max_chars;
+  std::wstring text_chunk;
+
+  if (OK != get_open_file (flat_expr_tkns, sys_call_idx, true, true, file) || OK != get_int_param (flat_expr_tkns, sys_call_idx + 2, max_chars))  {
+    // Already reported
+
+  } else if (max_chars < 0)  {
+    SET_FAILED_ON_SRC_LINE;
+    user_messages->logMsg (USER_ERROR, L"read_chunk() # of characters can't be negative", usr_src_file_name
+      , flat_expr_tkns[sys_call_idx].get_line_number(), flat_expr_tkns[sys_call_idx].get_column_pos());
+
+  } else if (OK != file->reader->readChunk (max_chars, text_chunk))  {
+    SET_FAILED_ON_SRC_LINE;
+    user_messages->logMsg (USER_ERROR, L"read_chunk() failed reading from file", usr_src_file_name
+      , flat_expr_tkns[sys_call_idx].get_line_number(), flat_expr_tkns[sys_call_idx].get_column_pos());
+
+  } else  {
+    flat_expr_tkns[sys_call_idx].resetToString (std::move (text_chunk));
+    flat_expr_tkns[sys_call_idx].isInitialized = true;
+    ret_code = end_sys_call (flat_expr_tkns, sys_call_idx, 2);
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * write_file(file handle, text) -> # of characters written, or -1 if writing
+ * failed.  No line ending gets added.
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_sys_call_write_file (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
+  return (write_to_file (flat_expr_tkns, sys_call_idx, false));
+ }
+
+/* ****************************************************************************
+ * write_line(file handle, text) -> # of characters written, counting the "\n"
+ * that gets added, or -1 if writing failed
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_sys_call_write_line (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
+  return (write_to_file (flat_expr_tkns, sys_call_idx, true));
+ }
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+ int RunTimeInterpreter::write_to_file (std::vector<Token> & flat_expr_tkns, int sys_call_idx, bool is_end_of_line)  {
+  int ret_code = GENERAL_FAILURE;
+  openFile * file;
+  const InternedString * text;
+
+  if (OK == get_open_file (flat_expr_tkns, sys_call_idx, true, false, file) && OK == get_string_param (flat_expr_tkns, sys_call_idx + 2, text))  {
+    int write_rez = (is_end_of_line ? file->writer->writeLine (*text) : file->writer->writeText (*text));
+    int64_t num_written = (OK == write_rez ? (int64_t) text->length() + (is_end_of_line ? 1 : 0) : -1);
+
+    flat_expr_tkns[sys_call_idx].resetToSigned (num_written);
+    ret_code = end_sys_call (flat_expr_tkns, sys_call_idx, 2);
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * is_eof(file handle) -> true once there's nothing left to read
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_sys_call_is_eof (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
+  int ret_code = GENERAL_FAILURE;
+  openFile * file;
+
+  if (OK == get_open_file (flat_expr_tkns, sys_call_idx, true, true, file))  {
+    flat_expr_tkns[sys_call_idx].resetToBool (file->reader->isEof());
+    ret_code = end_sys_call (flat_expr_tkns, sys_call_idx, 1);
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * close_file(file handle) -> 0, or -1 if what was written couldn't all be
+ * flushed out.  The handle can get handed out again after this.
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_sys_call_close_file (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
+  int ret_code = GENERAL_FAILURE;
+  openFile * file;
+
+  if (OK == get_open_file (flat_expr_tkns, sys_call_idx, false, false, file))  {
+    int64_t close_rez = 0;
+
+    if (file->writer != NULL && OK != file->writer->flush())
+      close_rez = -1;
+
+    file->reader.reset();
+    file->writer.reset();
+
+    flat_expr_tkns[sys_call_idx].resetToSigned (close_rez);
+    ret_code = end_sys_call (flat_expr_tkns, sys_call_idx, 1);
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * File handle is the system call's 1st parameter.  is_reading only gets
+ * checked if is_direction_checked.
+ * ***************************************************************************/
+ int RunTimeInterpreter::get_open_file (std::vector<Token> & flat_expr_tkns, int sys_call_idx, bool is_direction_checked, bool is_reading
+  , openFile * & file)  {
+  int ret_code = GENERAL_FAILURE;
+  int64_t file_handle;
+  Token & sys_call_tkn = flat_expr_tkns[sys_call_idx];
+
+  if (OK != get_int_param (flat_expr_tkns, sys_call_idx + 1, file_handle))  {
+    // Already reported
+
+  } else if (file_handle < 0 || file_handle >= open_files.size()
+    || (open_files[file_handle].reader == NULL && open_files[file_handle].writer == NULL))  {
+    SET_FAILED_ON_SRC_LINE;
+    user_messages->logMsg (USER_ERROR, sys_call_tkn._string + L"() got " + std::to_wstring (file_handle) + L", which isn't an open file handle"
+      , usr_src_file_name, sys_call_tkn.get_line_number(), sys_call_tkn.get_column_pos());
+
+  } else if (is_direction_checked && (open_files[file_handle].reader != NULL) != is_reading)  {
+    SET_FAILED_ON_SRC_LINE;
+    user_messages->logMsg (USER_ERROR, sys_call_tkn._string + L"() needs a file opened for " + (is_reading ? L"reading" : L"writing")
+      , usr_src_file_name, sys_call_tkn.get_line_number(), sys_call_tkn.get_column_pos());
+
+  } else  {
+    file = &open_files[file_handle];
+    ret_code = OK;
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * array_fill(array, value) doesn't have a return value (void); every element
+ * gets set to value
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_sys_call_array_fill (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
+  int ret_code = GENERAL_FAILURE;
+  TypedArray * typed_array;
+  Token fill_tkn;
+  std::wstring error_msg;
+  Token & sys_call_tkn = flat_expr_tkns[sys_call_idx];
+
+  if (OK != get_array_param (flat_expr_tkns, sys_call_idx + 1, typed_array))  {
+    // Already reported
+
+  } else if (sys_call_idx + 2 >= flat_expr_tkns.size() || OK != resolveTknOrVar (flat_expr_tkns[sys_call_idx + 2], fill_tkn))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (OK != typed_array->fill (fill_tkn, flat_expr_tkns[sys_call_idx + 1]._string, error_msg))  {
+    SET_FAILED_ON_SRC_LINE;
+    user_messages->logMsg (USER_ERROR, error_msg, usr_src_file_name, sys_call_tkn.get_line_number(), sys_call_tkn.get_column_pos());
+
+  } else  {
+    // Delete 3 items from the list - array_fill sys_call and both of its parameters
+    flat_expr_tkns.erase(flat_expr_tkns.begin() + sys_call_idx, flat_expr_tkns.begin() + sys_call_idx + 3);
+    ret_code = OK;
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * array_copy(dest array, src array) -> # of elements copied, which is the
+ * size of the smaller array
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_sys_call_array_copy (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
+  int ret_code = GENERAL_FAILURE;
+  TypedArray * dest_array;
+  TypedArray * src_array;
+
+  if (OK == get_array_param (flat_expr_tkns, sys_call_idx + 1, dest_array) && OK == get_array_param (flat_expr_tkns, sys_call_idx + 2, src_array))  {
+    flat_expr_tkns[sys_call_idx].resetToUnsigned (dest_array->copyFrom (*src_array));
+    ret_code = end_sys_call (flat_expr_tkns, sys_call_idx, 2);
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * array_sum(numeric array) -> int64|uint64|double total of all the elements
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_sys_call_array_sum (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
+  int ret_code = GENERAL_FAILURE;
+  TypedArray * typed_array;
+
+  if (OK != get_array_param (flat_expr_tkns, sys_call_idx + 1, typed_array))  {
+    // Already reported
+
+  } else if (OK != typed_array->sum (flat_expr_tkns[sys_call_idx]))  {
+    SET_FAILED_ON_SRC_LINE;
+    user_messages->logMsg (INTERNAL_ERROR, L"Cannot sum up array " + flat_expr_tkns[sys_call_idx + 1]._string, this_src_file, failed_on_src_line, 0);
+
+  } else  {
+    ret_code = end_sys_call (flat_expr_tkns, sys_call_idx, 1);
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * array_min() and array_max() hand back the winning element, at the array's
+ * element data type
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_sys_call_array_min (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
+  return (exec_array_min_or_max (flat_expr_tkns, sys_call_idx, true));
+ }
+
+ int RunTimeInterpreter::exec_sys_call_array_max (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
+  return (exec_array_min_or_max (flat_expr_tkns, sys_call_idx, false));
+ }
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_array_min_or_max (std::vector<Token> & flat_expr_tkns, int sys_call_idx, bool is_min)  {
+  int ret_code = GENERAL_FAILURE;
+  TypedArray * typed_array;
+
+  if (OK != get_array_param (flat_expr_tkns, sys_call_idx + 1, typed_array))  {
+    // Already reported
+
+  } else if (OK != typed_array->minOrMax (is_min, flat_expr_tkns[sys_call_idx]))  {
+    SET_FAILED_ON_SRC_LINE;
+    user_messages->logMsg (INTERNAL_ERROR, L"Cannot get the " + std::wstring (is_min ? L"min" : L"max") + L" of array "
+      + flat_expr_tkns[sys_call_idx + 1]._string, this_src_file, failed_on_src_line, 0);
+
+  } else  {
+    ret_code = end_sys_call (flat_expr_tkns, sys_call_idx, 1);
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * array_dot(numeric array, numeric array) -> sum of the products of the
+ * elements both arrays have
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_sys_call_array_dot (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
+  int ret_code = GENERAL_FAILURE;
+  TypedArray * array_1;
+  TypedArray * array_2;
+
+  if (OK != get_array_param (flat_expr_tkns, sys_call_idx + 1, array_1) || OK != get_array_param (flat_expr_tkns, sys_call_idx + 2, array_2))  {
+    // Already reported
+
+  } else if (OK != array_1->dot (*array_2, flat_expr_tkns[sys_call_idx]))  {
+    SET_FAILED_ON_SRC_LINE;
+    user_messages->logMsg (INTERNAL_ERROR, L"Cannot get the dot product of arrays " + flat_expr_tkns[sys_call_idx + 1]._string
+      + L" and " + flat_expr_tkns[sys_call_idx + 2]._string, this_src_file, failed_on_src_line, 0);
+
+  } else  {
+    ret_code = end_sys_call (flat_expr_tkns, sys_call_idx, 2);
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * array_size(array) -> # of elements the array was declared with
+ * ***************************************************************************/
+ int RunTimeInterpreter::exec_sys_call_array_size (std::vector<Token> & flat_expr_tkns, int sys_call_idx)  {
+  int ret_code = GENERAL_FAILURE;
+  TypedArray * typed_array;
+
+  if (OK == get_array_param (flat_expr_tkns, sys_call_idx + 1, typed_array))  {
+    flat_expr_tkns[sys_call_idx].resetToUnsigned (typed_array->size());
+    ret_code = end_sys_call (flat_expr_tkns, sys_call_idx, 1);
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * Arrays get passed to system calls by name
+ * ***************************************************************************/
+ int RunTimeInterpreter::get_array_param (std::vector<Token> & flat_expr_tkns, int param_idx, TypedArray * & typed_array)  {
+  int ret_code = GENERAL_FAILURE;
+
+  if (param_idx >= flat_expr_tkns.size() || flat_expr_tkns[param_idx].tkn_type != USER_WORD_TKN)  {
+    SET_FAILED_ON_SRC_LINE;
+    user_messages->logMsg (INTERNAL_ERROR, L"Expected an array name as a system call parameter", this_src_file, failed_on_src_line, 0);
+
+  } else if (OK != get_array (flat_expr_tkns[param_idx]._string, typed_array))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    ret_code = OK;
+  }
+
+  return ret_code;
+ }
+
+/* ****************************************************************************
+ * BLOCK_PROFILE_OPCODE 0x73
+ * [op_code][total_length][line #][column #]
+ * 1st object in the code block of each [if] [else if] [else] when compiled for
+ * profiling. Copies of the block, e.g. from loop unrolling, count as the same
+ * block.
+ * ***************************************************************************/
+int RunTimeInterpreter::exec_block_profile (uint32_t obj_start_pos, uint32_t object_len)  {
+  int ret_code = GENERAL_FAILURE;
+  uint32_t line_num, col_pos;
+
+  if (object_len != OPCODE_NUM_BYTES + NUM_BYTES_IN_DWORD * 3)  {
+    SET_FAILED_ON_SRC_LINE;
+    user_messages->logMsg(INTERNAL_ERROR, L"Unexpected length of block profile object at " + std::to_wstring (obj_start_pos)
+      , this_src_file, failed_on_src_line, 0);
+
+  } else if (OK != file_reader.readNextDword (line_num) || OK != file_reader.readNextDword (col_pos)) {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    if (block_profile != NULL)
+      block_profile->countHit (line_num, col_pos);
+    ret_code = OK;
+  }
+
+  return (ret_code);
+}
@@ -16,19 +16,31 @@
 #include "Utilities.h"
 #include "StackOfScopes.h"
 #include "UserMessages.h"
+#include "BlockProfile.h"
+#include "OutputSink.h"
+#include "InputSource.h"
+
+// What a file handle from open_file() refers to; exactly 1 of these is set
+// while the file is open, and neither once it's closed
+struct open_file_struct {
+  std::unique_ptr<InputSource> reader;
+  std::unique_ptr<OutputSink> writer;
+};
+
+typedef open_file_struct openFile;
 
 class RunTimeInterpreter {
 public:
-  RunTimeInterpreter();
-  RunTimeInterpreter(CompileExecTerms & execTerms, std::shared_ptr<StackOfScopes> inVarNameSpace
-    , std::wstring userSrcFileName, std::shared_ptr<UserMessages> userMessages, logLvlEnum logLvl);
-  RunTimeInterpreter(std::string interpretedFileName, std::wstring userSrcFileName
+  RunTimeInterpreter(const CompileExecTerms & execTerms, std::string interpretedFileName, std::wstring userSrcFileName
     , std::shared_ptr<StackOfScopes> inVarNameSpace,  std::shared_ptr<UserMessages> userMessages
-    , logLvlEnum logLvl);
+    , logLvlEnum logLvl, std::shared_ptr<BlockProfile> blockProfile, std::shared_ptr<OutputSink> outputSink);
+  RunTimeInterpreter(const CompileExecTerms & execTerms, std::wstring userSrcFileName
+    , std::shared_ptr<StackOfScopes> inVarNameSpace,  std::shared_ptr<UserMessages> userMessages);
 
   virtual ~RunTimeInterpreter();
   // TODO: Should I make this static?
   int resolveFlatExpr(std::vector<Token> & flat_expr_tkns, int & expected_tkn_cnt);
+  int resolveConstExpr (std::vector<Token> & flat_expr_tkns);
   int execRootScope();
 
 
@@ -37,19 +49,29 @@ protected:
 private:
   std::shared_ptr <Token> one_tkn;
   std::shared_ptr <Token> zero_tkn;
-  CompileExecTerms exec_terms;
+  const CompileExecTerms & exec_terms;
   std::wstring this_src_file;
   Utilities util;
   Token scratch_tkn;
   std::shared_ptr<StackOfScopes> scope_name_space;
   std::shared_ptr<UserMessages> user_messages;
   std::wstring usr_src_file_name;
-  InterpreterModesType usage_mode;
   InterpretedFileReader file_reader;
   int failed_on_src_line;
   logLvlEnum log_level;
   bool is_illustrative;
   std::wstring tkns_illustrative_str;
+  // Common sub-expression results saved by [=tmp] for reuse later in the same expression
+  std::vector<Token> temp_slots;
+  // Loop invariant results saved by [=tmp] in front of the loop that uses them
+  std::vector<Token> invariant_slots;
+  // Working copy for exec_cached_expr; resolving an expression eats its Token list
+  std::vector<Token> cached_expr_work;
+  // Counts [if] [else if] [else] blocks as they run; NULL unless profiling
+  std::shared_ptr<BlockProfile> block_profile;
+  std::shared_ptr<OutputSink> output_sink;
+  // Indexed by the file handles open_file() hands out
+  std::vector<openFile> open_files;
 
   int execCurrScope (uint32_t exec_start_pos, uint32_t after_bndry_pos, uint32_t & break_scope_end_pos);
   int check_expr_element_is_ready (std::vector<Token> & flat_expr_tkns, int curr_idx, bool & is_actor);
@@ -70,22 +92,76 @@ private:
   int execShift (std::vector<Token> & expr_tkn_stream, int opr8r_idx);
   int execBitWiseOp (std::vector<Token> & expr_tkn_stream, int opr8r_idx);
   int execStandardMath (std::vector<Token> & expr_tkn_stream, int opr8r_idx);
-  int resolveTknOrVar (Token & original_tkn, Token & resolved_tkn, std::wstring & varName, bool is_check_init);
-  int resolveTknOrVar (Token & original_tkn, Token & resolved_tkn, std::wstring & varName);
+  int resolveTknOrVar (Token & original_tkn, Token & resolved_tkn);
+  int resolveTempSlot (Token & slot_tkn);
+  int exec_temp_store (std::vector<Token> & flat_expr_tkns, int opr8r_idx);
+  int exec_lookup_select (std::vector<Token> & flat_expr_tkns, int opr8r_idx);
+  int exec_concat_n (std::vector<Token> & flat_expr_tkns, int opr8r_idx, int num_pieces);
+  int exec_array_element (std::vector<Token> & flat_expr_tkns, int opr8r_idx);
+  int get_array (const InternedString & array_name, TypedArray * & typed_array);
+  int assign_var_or_element (scopeVar * var_handle, TypedArray * typed_array, const Token & target_tkn, const Token & new_val_tkn
+    , std::wstring & error_msg);
+  bool is_writing_opr8r (uint8_t op_code);
+  bool getLookupKey (Token & key_tkn, int64_t & key);
   int exec_if_block (uint32_t scope_start_pos, uint32_t if_scope_len, uint32_t after_parent_scope_pos, uint32_t & break_scope_end_pos);
-  int exec_cached_expr (std::vector<Token> expr_tkn_list, bool & is_result_true);
+  int exec_cached_expr (const std::vector<Token> & expr_tkn_list, bool & is_result_true);
   int get_expr_from_var_declaration (uint32_t start_pos, std::vector<Token> & expr_tkn_list);
-  int exec_for_loop (uint32_t scope_start_pos, uint32_t for_scope_len, uint32_t after_parent_scope_pos, uint32_t & break_scope_end_pos);
+  int exec_for_loop (uint8_t for_op_code, uint32_t scope_start_pos, uint32_t for_scope_len, uint32_t after_parent_scope_pos
+    , uint32_t & break_scope_end_pos);
+  int exec_for_loop_init (uint32_t init_expr_pos, uint32_t & init_expr_len);
+  int exec_unrolled_for_loop (uint32_t for_scope_start, uint32_t for_scope_len, uint32_t & break_scope_end_pos);
+  int exec_block_profile (uint32_t obj_start_pos, uint32_t object_len);
+  int get_loop_trips_left (std::vector<Token> & cond_expr_tkn_list, std::vector<Token> & last_expr_tkn_list, uint64_t & trips_left);
   int exec_while_loop (uint32_t scope_start_pos, uint32_t for_scope_len, uint32_t after_parent_scope_pos, uint32_t & break_scope_end_pos);
   
   bool isOkToIllustrate ();
   void illustrativeB4op (std::vector<Token> & flat_expr_tkns, int currIdx); 
   void illustrativeAfterOp (std::vector<Token> & flat_expr_tkns);
 
-  // TODO: Should these be protected?  One of them private?
+  // CompileExecTerms points each entry in its system call table at one of these
+  friend class CompileExecTerms;
   int exec_system_call (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
   int exec_sys_call_str (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
   int exec_sys_call_print_line (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int exec_sys_call_min (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int exec_sys_call_max (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int exec_sys_call_abs (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int exec_sys_call_pow (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int exec_sys_call_sqrt (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int exec_sys_call_floor (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int exec_min_or_max (std::vector<Token> & flat_expr_tkns, int sys_call_idx, bool is_min);
+  int resolve_math_params (std::vector<Token> & flat_expr_tkns, int sys_call_idx, int num_params, Token * params);
+  int end_sys_call (std::vector<Token> & flat_expr_tkns, int sys_call_idx, int num_params);
+  double get_as_double (const Token & num_tkn);
+  bool is_less_than_num (const Token & lhs_tkn, const Token & rhs_tkn);
+  int exec_sys_call_length (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int exec_sys_call_find (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int exec_sys_call_substr (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int exec_sys_call_replace (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int exec_sys_call_split_count (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int exec_sys_call_split_field (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int exec_sys_call_compare_ignore_case (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int get_string_param (std::vector<Token> & flat_expr_tkns, int param_idx, const InternedString * & string_param);
+  int get_int_param (std::vector<Token> & flat_expr_tkns, int param_idx, int64_t & int_param);
+  size_t find_substring (const std::wstring & haystack, const std::wstring & needle, size_t start_pos);
+  int exec_sys_call_open_file (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int exec_sys_call_read_line (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int exec_sys_call_read_chunk (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int exec_sys_call_write_file (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int exec_sys_call_write_line (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int write_to_file (std::vector<Token> & flat_expr_tkns, int sys_call_idx, bool is_end_of_line);
+  int exec_sys_call_is_eof (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int exec_sys_call_close_file (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int get_open_file (std::vector<Token> & flat_expr_tkns, int sys_call_idx, bool is_direction_checked, bool is_reading, openFile * & file);
+  int exec_sys_call_array_fill (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int exec_sys_call_array_copy (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int exec_sys_call_array_sum (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int exec_sys_call_array_min (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int exec_sys_call_array_max (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int exec_array_min_or_max (std::vector<Token> & flat_expr_tkns, int sys_call_idx, bool is_min);
+  int exec_sys_call_array_dot (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int exec_sys_call_array_size (std::vector<Token> & flat_expr_tkns, int sys_call_idx);
+  int get_array_param (std::vector<Token> & flat_expr_tkns, int param_idx, TypedArray * & typed_array);
 
 };
 
@@ -14,9 +14,22 @@
 #include "ScopeWindow.h"
 #include "common.h"
 #include <cstdint>
+#include <functional>
 
-ScopeWindow::ScopeWindow(uint8_t inOpCode, Token inOpeningTkn, uint32_t inStartFilePos, uint32_t inScopeLen) {
+ScopeWindow::ScopeWindow(uint8_t inOpCode, const Token & inOpeningTkn, uint32_t inStartFilePos, uint32_t inScopeLen) {
+  num_vars = 0;
+  reopen (inOpCode, inOpeningTkn, inStartFilePos, inScopeLen);
+}
+
+/* ****************************************************************************
+ * Closed scopes go back into the StackOfScopes pool rather than getting freed.
+ * Reopening one sets it back to how a new one would look, but holds on to its
+ * variable slots and whatever memory they've already got.
+ * ***************************************************************************/
+void ScopeWindow::reopen (uint8_t inOpCode, const Token & inOpeningTkn, uint32_t inStartFilePos, uint32_t inScopeLen) {
   opener_opcode = inOpCode;
+  // Token's [=] won't overwrite good src info with empty src info
+  openerTkn.resetToken();
   openerTkn = inOpeningTkn;
   boundary_begin_pos = inStartFilePos;
 
@@ -26,8 +39,15 @@ ScopeWindow::ScopeWindow(uint8_t inOpCode, Token inOpeningTkn, uint32_t inStartF
   else
     boundary_end_pos = 0;
 
+  num_vars = 0;
   loop_break_cnt = 0;    
   is_exists_for_loop_cond = false;
+  if_chain_state = NO_IF_CHAIN;
+  is_unreachable = false;
+  if_chain_blocks.clear();
+  read_variables.clear();
+  var_stores.clear();
+  known_values.clear();
 }
 
 int ScopeWindow::setBoundaryEndPos (uint32_t end_pos) {
@@ -44,3 +64,66 @@ int ScopeWindow::setBoundaryEndPos (uint32_t end_pos) {
 ScopeWindow::~ScopeWindow() {
 }
 
+/* ****************************************************************************
+ * Scopes only hold a handful of variables, so a straight walk through the
+ * slots beats a tree or hash table. Comparing hashes 1st skips most of the
+ * string compares, and names read out of the interpreted file are interned so
+ * the rest are usually a pointer compare.
+ * ***************************************************************************/
+scopeVar * ScopeWindow::findVar (const InternedString & varName, size_t nameHash) {
+  scopeVar * foundVar = NULL;
+
+  for (int idx = 0; idx < num_vars && foundVar == NULL; idx++)  {
+    if (var_slots[idx].name_hash == nameHash && var_slots[idx].name == varName)
+      foundVar = &var_slots[idx];
+  }
+
+  return (foundVar);
+}
+
+/* ****************************************************************************
+ * Fail if the variable is already defined at this scope
+ * ***************************************************************************/
+int ScopeWindow::insertVar (const InternedString & varName, size_t nameHash, const Token & varValue) {
+  int ret_code = GENERAL_FAILURE;
+
+  if (findVar (varName, nameHash) == NULL)  {
+    if (num_vars == var_slots.size())
+      var_slots.emplace_back ();
+
+    scopeVar & slot = var_slots[num_vars];
+    slot.name = varName;
+    slot.name_hash = nameHash;
+    slot.value.resetToken();
+    slot.value = varValue;
+    slot.num_elements = 0;
+    num_vars++;
+    ret_code = OK;
+  }
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ * A slot whose last array is the same shape gets it back cleared out, so an
+ * array declared inside a loop body only gets allocated the 1st time around.
+ * The compiler only needs to know the shape, so it doesn't allocate.
+ * ***************************************************************************/
+int ScopeWindow::insertArray (const InternedString & arrayName, size_t nameHash, const Token & elementTkn, uint64_t numElements, bool isAllocated) {
+  int ret_code = GENERAL_FAILURE;
+
+  if (numElements > 0 && OK == insertVar (arrayName, nameHash, elementTkn))  {
+    scopeVar & slot = var_slots[num_vars - 1];
+    slot.num_elements = numElements;
+    slot.value.isInitialized = true;
+
+    if (isAllocated && slot.elements != NULL && slot.elements->isSameShape (elementTkn.tkn_type, numElements))
+      slot.elements->clear();
+    else if (isAllocated)
+      slot.elements = std::make_shared<TypedArray> (elementTkn.tkn_type, numElements);
+
+    ret_code = OK;
+  }
+
+  return (ret_code);
+}
@@ -10,24 +10,88 @@
 
 #include <cstdint>
 #include <map>
+#include <set>
 #include <string>
+#include <vector>
 #include "common.h"
 #include "Token.h"
+#include "TypedArray.h"
+
+// Compile time only; what's left of the [if] [else if] [else] chain being compiled at a scope
+// once dead branch elimination has had its way
+enum if_chain_state_enum {
+  NO_IF_CHAIN
+  ,IF_CHAIN_LIVE            // At least 1 block kept that gets decided at run time
+  ,IF_CHAIN_TAKEN           // A kept block is always taken, so the rest of the chain is unreachable
+  ,IF_CHAIN_ALL_REMOVED     // Every block so far was unreachable; the next one kept has to start the chain
+};
+
+typedef if_chain_state_enum ifChainState;
+
+// Compile time only; where a variable's declaration or a stand-alone store to it landed in the
+// interpreted file, so it can be cut back out if the variable is never read
+struct store_span_struct {
+  uint32_t start_pos;
+  uint32_t end_pos;
+  uint32_t decl_start_pos;      // VARIABLES_DECLARATION object the span is part of; 0 for a stand-alone store
+  uint32_t decl_end_pos;
+  int num_decl_vars;            // # of variables declared by that VARIABLES_DECLARATION object
+  int line_num;
+};
+
+typedef store_span_struct storeSpan;
+
+// Compile time only; a kept block of the [if] [else if] [else] chain being compiled at a scope,
+// so the chain can be put in order of how often each block ran the last time it was profiled
+struct if_chain_block_struct {
+  uint32_t start_pos;
+  uint8_t op_code;
+  uint32_t line_num;            // Where the block's keyword sits in the source; the profile's key
+  uint32_t col_pos;
+  bool is_reorderable;          // [else], or an [x == key] conditional that can be checked in any order
+  std::wstring selector_name;
+  int64_t key;
+};
+
+typedef if_chain_block_struct ifChainBlock;
+
+// Variable defined at a scope. Slots get reused when the ScopeWindow is reopened out of the
+// StackOfScopes pool, so the strings they hold keep the capacity they already have.
+struct scope_var_struct {
+  InternedString name;
+  size_t name_hash;
+  Token value;                                                  // For an array, an element's data type
+  uint64_t num_elements;                                        // 0 for a scalar variable
+  std::shared_ptr<TypedArray> elements;                         // Kept around with the slot; see insertArray
+};
+
+typedef scope_var_struct scopeVar;
 
 class ScopeWindow {
 public:
-  ScopeWindow (uint8_t inOpCode, Token inOpeningTkn, uint32_t inStartFilePos, uint32_t inScopeLen);
+  ScopeWindow (uint8_t inOpCode, const Token & inOpeningTkn, uint32_t inStartFilePos, uint32_t inScopeLen);
   virtual ~ScopeWindow();
 
+  void reopen (uint8_t inOpCode, const Token & inOpeningTkn, uint32_t inStartFilePos, uint32_t inScopeLen);
   int setBoundaryEndPos (uint32_t end_pos);
+  scopeVar * findVar (const InternedString & varName, size_t nameHash);
+  int insertVar (const InternedString & varName, size_t nameHash, const Token & varValue);
+  int insertArray (const InternedString & arrayName, size_t nameHash, const Token & elementTkn, uint64_t numElements, bool isAllocated);
 
   Token openerTkn;                                              // When compiling, init with Token that opened scope
   uint8_t opener_opcode;                                        // [if] [else if] [else] [for] [while] [function]?
   uint32_t boundary_begin_pos;                                  // Where does this scope object begin in the interpreted file?
   uint32_t boundary_end_pos;
-  std::map <std::wstring, std::shared_ptr<Token>> variables;    // List of variables defined at this scope
+  std::vector<scopeVar> var_slots;                              // Variables defined at this scope are the 1st num_vars slots
+  int num_vars;
   int loop_break_cnt;                                           // Incremented when a [break] statement is found inside a loop      
   bool is_exists_for_loop_cond;                      
+  ifChainState if_chain_state;                                  // Compile time only; [if] chain at this scope
+  bool is_unreachable;                                          // Compile time only; block gets cut when it's closed
+  std::vector<ifChainBlock> if_chain_blocks;                    // Compile time only; kept blocks of the [if] chain at this scope
+  std::set <std::wstring> read_variables;                       // Compile time only; variables at this scope that get read
+  std::map <std::wstring, std::vector<storeSpan>> var_stores;   // Compile time only; removable declaration & stores per variable
+  std::map <std::wstring, Token> known_values;                  // Compile time only; variables whose value is known from here on
 
 };
 
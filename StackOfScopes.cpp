@@ -32,22 +32,47 @@ StackOfScopes::~StackOfScopes() {
 void StackOfScopes::reset() {
   while (scopeStack.size() > 0) {
     std::shared_ptr<ScopeWindow> top = scopeStack[scopeStack.size() - 1];
-    scopeStack.erase(scopeStack.end());
+    scopeStack.pop_back();
     top.reset();
   }
 
+  scopePool.clear();
 }
 
 /* ****************************************************************************
  * Look up this variable in our scopeStack|NameSpace. Only update the variable
  * if isCommitUpdate = COMMIT_UPDATE (true)
  * ***************************************************************************/
-int StackOfScopes::findVar(std::wstring varName, int maxLevels, Token & updateValTkn
+int StackOfScopes::findVar(const InternedString & varName, int maxLevels, Token & updateValTkn
   , ReadOrWrite readOrWrite, std::wstring & errorMsg) {
   int ret_code = GENERAL_FAILURE;
-  bool isFound = false;
+  scopeVar * varHandle;
   errorMsg.clear();
 
+  if (OK == getVarHandle (varName, maxLevels, varHandle))  {
+    if (COMMIT_WRITE == readOrWrite)  {
+      ret_code = assignVar (*varHandle, updateValTkn, errorMsg);
+
+    } else  {
+      updateValTkn = varHandle->value;
+      ret_code = OK;
+    }
+  }
+
+  return (ret_code);
+
+}
+
+/* ****************************************************************************
+ * Resolve a variable once, then read it and update it in place through the
+ * handle instead of copying its Token in and out of the NameSpace. The handle
+ * is good until another variable gets declared at the same scope, or that
+ * scope closes.
+ * ***************************************************************************/
+int StackOfScopes::getVarHandle (const InternedString & varName, int maxLevels, scopeVar * & varHandle) {
+  int ret_code = GENERAL_FAILURE;
+  varHandle = NULL;
+
   int scopeTopIdx = scopeStack.size() - 1;
   int endScopeIdx;
   if (maxLevels <= 0)
@@ -55,25 +80,29 @@ int StackOfScopes::findVar(std::wstring varName, int maxLevels, Token & updateVa
   else
     endScopeIdx = scopeTopIdx - maxLevels + 1;
 
-  for (int currIdx = scopeTopIdx; currIdx >= endScopeIdx && !isFound; currIdx--)  {
-    std::shared_ptr<ScopeWindow> currScope = scopeStack[currIdx];
-    if (auto search = currScope->variables.find(varName); search != currScope->variables.end()) {
-      // TODO: existingTkn is probably going to need to be a POINTER for the update to stick
-      std::shared_ptr<Token> existingTkn = search->second;
-      isFound = true;
-      if (COMMIT_WRITE == readOrWrite)  {
-        std::wstring errMsg;
-
-        if (OK == existingTkn->convertTo(updateValTkn, varName, errorMsg))  {
-          // TODO: What info can I supply to user to resolve src line # etc?
-          existingTkn->isInitialized = true;
-          ret_code = OK;
-        }
-      } else  {
-        updateValTkn = *existingTkn;
-        ret_code = OK;
-      }
-    }
+  size_t nameHash = varName.hash();
+
+  for (int currIdx = scopeTopIdx; currIdx >= endScopeIdx && varHandle == NULL; currIdx--)
+    varHandle = scopeStack[currIdx]->findVar (varName, nameHash);
+
+  if (varHandle != NULL)
+    ret_code = OK;
+
+  return (ret_code);
+
+}
+
+/* ****************************************************************************
+ * Convert newValTkn to the variable's data type right where it's stored.
+ * errorMsg only gets built if that fails.
+ * ***************************************************************************/
+int StackOfScopes::assignVar (scopeVar & varHandle, const Token & newValTkn, std::wstring & errorMsg) {
+  int ret_code = GENERAL_FAILURE;
+
+  if (OK == varHandle.value.convertTo (newValTkn, varHandle.name, errorMsg))  {
+    // TODO: What info can I supply to user to resolve src line # etc?
+    varHandle.value.isInitialized = true;
+    ret_code = OK;
   }
 
   return (ret_code);
@@ -83,36 +112,61 @@ int StackOfScopes::findVar(std::wstring varName, int maxLevels, Token & updateVa
 /* ****************************************************************************
  * Insert this variable at the current scope.  Fail if it already exists
  * ***************************************************************************/
-int StackOfScopes::insertNewVarAtCurrScope (std::wstring varName, Token varValue) {
+int StackOfScopes::insertNewVarAtCurrScope (const InternedString & varName, const Token & varValue) {
   int ret_code = GENERAL_FAILURE;
 
   int top = scopeStack.size() - 1;
 
-  if (auto search = scopeStack[top]->variables.find(varName); search == scopeStack[top]->variables.end()) {
-    std::shared_ptr<Token> newVarTkn = std::make_shared<Token> ();
-    *newVarTkn = varValue;
-    scopeStack[top]->variables[varName] = newVarTkn;
-    ret_code = OK;
-  }
+  ret_code = scopeStack[top]->insertVar (varName, varName.hash(), varValue);
 
   return (ret_code);
 }
 
 /* ****************************************************************************
- * Open a new scope with info that indicates where it started
+ * Arrays only get their elements allocated when they're being run; the compiler
+ * just needs to know what they look like
  * ***************************************************************************/
-int StackOfScopes::openNewScope (uint8_t openedByOpCode, Token scopenerTkn, uint32_t startScopeFilePos, uint32_t scopeLen)  {
+int StackOfScopes::insertNewArrayAtCurrScope (const InternedString & arrayName, const Token & elementTkn, uint64_t numElements, bool isAllocated) {
   int ret_code = GENERAL_FAILURE;
 
-  std::shared_ptr<ScopeWindow> openedScope = std::make_shared<ScopeWindow> (openedByOpCode, scopenerTkn, startScopeFilePos, scopeLen);
-  openedScope->openerTkn = scopenerTkn;
-  scopeStack.push_back(openedScope);
+  int top = scopeStack.size() - 1;
+
+  ret_code = scopeStack[top]->insertArray (arrayName, arrayName.hash(), elementTkn, numElements, isAllocated);
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ * Open a new scope with info that indicates where it started. A scope that was
+ * closed earlier gets reused if there is one, so inner loops that open and close
+ * their scope on every trip of an outer loop don't allocate anything once the
+ * pool is warmed up.
+ * ***************************************************************************/
+int StackOfScopes::openNewScope (uint8_t openedByOpCode, const Token & scopenerTkn, uint32_t startScopeFilePos, uint32_t scopeLen)  {
+  int ret_code = GENERAL_FAILURE;
+
+  if (scopePool.empty())  {
+    scopeStack.push_back (std::make_shared<ScopeWindow> (openedByOpCode, scopenerTkn, startScopeFilePos, scopeLen));
+
+  } else  {
+    scopeStack.push_back (scopePool.back());
+    scopePool.pop_back();
+    scopeStack.back()->reopen (openedByOpCode, scopenerTkn, startScopeFilePos, scopeLen);
+  }
   
   ret_code = OK;
 
   return (ret_code);
 }
 
+/* ****************************************************************************
+ * Top scope is closed; hang on to it for the next openNewScope
+ * ***************************************************************************/
+void StackOfScopes::recycleTopScope ()  {
+  scopePool.push_back (scopeStack.back());
+  scopeStack.pop_back();
+}
+
 /* ****************************************************************************
  * Close the current top level, non-ROOT level scope
  * ***************************************************************************/
@@ -149,13 +203,17 @@ int  StackOfScopes::srcCloseTopScope (InterpretedFileWriter & interpretedFileWri
     std::shared_ptr<ScopeWindow> top = scopeStack[scopeStack.size() - 1];
 
     uint32_t scopeObjFilePos = top->boundary_begin_pos;
+    bool is_unreachable = top->is_unreachable;
     closedScopeOpCode = top->opener_opcode;
 
-    scopeStack.erase(scopeStack.end());
     top.reset();
+    recycleTopScope();
 
     if (isRootScope)
       ret_code = OK;
+    else if (is_unreachable)
+      // Dead branch; the whole block comes back out of the interpreted file
+      ret_code = interpretedFileWriter.truncateTo (scopeObjFilePos);
     else
       ret_code =  interpretedFileWriter.writeObjectLen (scopeObjFilePos);
 
@@ -196,8 +254,8 @@ int  StackOfScopes::srcCloseTopScope (InterpretedFileWriter & interpretedFileWri
       closeErr = SCOPE_OPCODE_MISMATCH;
 
     } else {
-      scopeStack.erase(scopeStack.end());
       top.reset();
+      recycleTopScope();
       ret_code = OK;
       closeErr = SCOPE_CLOSED_OK;
     }
@@ -243,8 +301,8 @@ void StackOfScopes::displayVariables()  {
       std::wcout << L"// Scope opened by: " << currScope->openerTkn.descr_line_num_col() << std::endl;
 
     varNames.clear();
-    for (auto mapr8r = currScope->variables.begin(); mapr8r != currScope->variables.end(); mapr8r++)  {
-      std::wstring nxtName = mapr8r->first;
+    for (int slotIdx = 0; slotIdx < currScope->num_vars; slotIdx++)  {
+      std::wstring nxtName = currScope->var_slots[slotIdx].name;
       varNames.push_back (nxtName);
       maxNameLen = (nxtName.size() > maxNameLen ? nxtName.size() : maxNameLen);
     }
@@ -254,12 +312,18 @@ void StackOfScopes::displayVariables()  {
     std::sort (varNames.begin(), varNames.end());
 
     for (auto var8r = varNames.begin(); var8r != varNames.end(); var8r++) {
-      std::shared_ptr<Token> nxtVarTkn = currScope->variables[*var8r];
+      InternedString lookUpName = *var8r;
+      scopeVar * nxtVar = currScope->findVar (lookUpName, lookUpName.hash());
+      Token & nxtVarTkn = nxtVar->value;
       std::wstring alignedName = *var8r;
       while (alignedName.size() < maxNameLen)
         alignedName.append (L" ");
 
-      std::wcout << alignedName << L" = " << nxtVarTkn->getValueStr() << L";" << std::endl;
+      if (nxtVar->num_elements > 0)
+        // Just the shape; the elements could go on for a while
+        std::wcout << alignedName << L" = " << nxtVarTkn.get_type_str (true) << L"[" << nxtVar->num_elements << L"];" << std::endl;
+      else
+        std::wcout << alignedName << L" = " << nxtVarTkn.getValueStr() << L";" << std::endl;
     }
 
     std::wcout << L"// ********** </SCOPE LEVEL " << currIdx << L"> ********** " << std::endl;
@@ -372,3 +436,249 @@ void StackOfScopes::displayVariables()  {
   return ret_code;
 
 }
+
+/* ****************************************************************************
+ * 
+ * ***************************************************************************/
+ int StackOfScopes::get_top_if_chain_state (ifChainState & chain_state) {
+  int ret_code = GENERAL_FAILURE;
+
+  chain_state = NO_IF_CHAIN;
+  int top_idx = scopeStack.size() - 1;
+
+  if (top_idx >= 0) {
+    chain_state = scopeStack[top_idx]->if_chain_state;
+    ret_code = OK;
+  }
+
+  return ret_code;
+
+}
+
+/* ****************************************************************************
+ * 
+ * ***************************************************************************/
+ int StackOfScopes::set_top_if_chain_state (ifChainState chain_state) {
+  int ret_code = GENERAL_FAILURE;
+
+  int top_idx = scopeStack.size() - 1;
+
+  if (top_idx >= 0) {
+    scopeStack[top_idx]->if_chain_state = chain_state;
+    ret_code = OK;
+  }
+
+  return ret_code;
+
+}
+
+/* ****************************************************************************
+ * 
+ * ***************************************************************************/
+ int StackOfScopes::get_top_is_unreachable (bool & is_unreachable) {
+  int ret_code = GENERAL_FAILURE;
+
+  is_unreachable = false;
+  int top_idx = scopeStack.size() - 1;
+
+  if (top_idx >= 0) {
+    is_unreachable = scopeStack[top_idx]->is_unreachable;
+    ret_code = OK;
+  }
+
+  return ret_code;
+
+}
+
+/* ****************************************************************************
+ * 
+ * ***************************************************************************/
+ int StackOfScopes::set_top_is_unreachable (bool is_unreachable) {
+  int ret_code = GENERAL_FAILURE;
+
+  int top_idx = scopeStack.size() - 1;
+
+  if (top_idx >= 0) {
+    scopeStack[top_idx]->is_unreachable = is_unreachable;
+    ret_code = OK;
+  }
+
+  return ret_code;
+
+}
+
+/* ****************************************************************************
+ * Compile time only. Kept block of the [if] chain at the top scope
+ * ***************************************************************************/
+ int StackOfScopes::add_top_if_chain_block (ifChainBlock chain_block) {
+  int ret_code = GENERAL_FAILURE;
+
+  int top_idx = scopeStack.size() - 1;
+
+  if (top_idx >= 0) {
+    scopeStack[top_idx]->if_chain_blocks.push_back (chain_block);
+    ret_code = OK;
+  }
+
+  return ret_code;
+
+}
+
+/* ****************************************************************************
+ * 
+ * ***************************************************************************/
+ int StackOfScopes::get_top_if_chain_blocks (std::vector<ifChainBlock> & chain_blocks) {
+  int ret_code = GENERAL_FAILURE;
+
+  chain_blocks.clear();
+  int top_idx = scopeStack.size() - 1;
+
+  if (top_idx >= 0) {
+    chain_blocks = scopeStack[top_idx]->if_chain_blocks;
+    ret_code = OK;
+  }
+
+  return ret_code;
+
+}
+
+/* ****************************************************************************
+ * 
+ * ***************************************************************************/
+ int StackOfScopes::clear_top_if_chain_blocks () {
+  int ret_code = GENERAL_FAILURE;
+
+  int top_idx = scopeStack.size() - 1;
+
+  if (top_idx >= 0) {
+    scopeStack[top_idx]->if_chain_blocks.clear();
+    ret_code = OK;
+  }
+
+  return ret_code;
+
+}
+
+/* ****************************************************************************
+ * Compile time only. Note that the variable gets read, at whichever scope
+ * it was declared, so its declaration and stores have to stay.
+ * ***************************************************************************/
+ int StackOfScopes::markVarRead (std::wstring varName) {
+  int ret_code = GENERAL_FAILURE;
+  InternedString lookUpName = varName;
+  size_t nameHash = lookUpName.hash();
+
+  for (int currIdx = scopeStack.size() - 1; currIdx >= 0 && ret_code != OK; currIdx--)  {
+    if (scopeStack[currIdx]->findVar (lookUpName, nameHash) != NULL) {
+      scopeStack[currIdx]->read_variables.insert (varName);
+      ret_code = OK;
+    }
+  }
+
+  return ret_code;
+
+}
+
+/* ****************************************************************************
+ * Compile time only. Remember where a declaration of, or a stand-alone store
+ * to, a variable declared at the top scope was written.
+ * ***************************************************************************/
+ int StackOfScopes::add_top_store_span (std::wstring varName, storeSpan span) {
+  int ret_code = GENERAL_FAILURE;
+
+  int top_idx = scopeStack.size() - 1;
+  InternedString lookUpName = varName;
+
+  if (top_idx >= 0 && scopeStack[top_idx]->findVar (lookUpName, lookUpName.hash()) != NULL) {
+    scopeStack[top_idx]->var_stores[varName].push_back (span);
+    ret_code = OK;
+  }
+
+  return ret_code;
+
+}
+
+/* ****************************************************************************
+ * Compile time only. Every recorded declaration|store span for top scope
+ * variables that never got read.
+ * ***************************************************************************/
+ int StackOfScopes::get_top_unread_stores (std::vector<std::pair<std::wstring, storeSpan>> & unread_stores) {
+  int ret_code = GENERAL_FAILURE;
+
+  unread_stores.clear();
+  int top_idx = scopeStack.size() - 1;
+
+  if (top_idx >= 0) {
+    std::shared_ptr<ScopeWindow> top = scopeStack[top_idx];
+
+    for (auto mapr8r = top->var_stores.begin(); mapr8r != top->var_stores.end(); mapr8r++)  {
+      if (top->read_variables.find(mapr8r->first) == top->read_variables.end()) {
+        for (auto span8r = mapr8r->second.begin(); span8r != mapr8r->second.end(); span8r++)
+          unread_stores.push_back (std::pair {mapr8r->first, *span8r});
+      }
+    }
+    ret_code = OK;
+  }
+
+  return ret_code;
+
+}
+
+/* ****************************************************************************
+ * Compile time only. From here until the variable gets written again, or the
+ * top scope closes, its value is known to be knownValTkn.
+ * ***************************************************************************/
+ int StackOfScopes::setKnownValue (std::wstring varName, Token knownValTkn) {
+  int ret_code = GENERAL_FAILURE;
+
+  int top_idx = scopeStack.size() - 1;
+
+  if (top_idx >= 0 && OK == killKnownValue (varName))  {
+    scopeStack[top_idx]->known_values[varName] = knownValTkn;
+    ret_code = OK;
+  }
+
+  return ret_code;
+
+}
+
+/* ****************************************************************************
+ * Compile time only. Forget what the variable's value is at every scope from
+ * the top down to the one that declared it.
+ * ***************************************************************************/
+ int StackOfScopes::killKnownValue (std::wstring varName) {
+  int ret_code = GENERAL_FAILURE;
+  InternedString lookUpName = varName;
+  size_t nameHash = lookUpName.hash();
+
+  for (int currIdx = scopeStack.size() - 1; currIdx >= 0 && ret_code != OK; currIdx--)  {
+    scopeStack[currIdx]->known_values.erase (varName);
+    if (scopeStack[currIdx]->findVar (lookUpName, nameHash) != NULL)
+      ret_code = OK;
+  }
+
+  return ret_code;
+
+}
+
+/* ****************************************************************************
+ * Compile time only. Don't look past the scope that declared the variable; a
+ * variable it shadows could have a known value of its own.
+ * ***************************************************************************/
+ int StackOfScopes::getKnownValue (std::wstring varName, Token & knownValTkn) {
+  int ret_code = GENERAL_FAILURE;
+  bool isDeclScope = false;
+  InternedString lookUpName = varName;
+  size_t nameHash = lookUpName.hash();
+
+  for (int currIdx = scopeStack.size() - 1; currIdx >= 0 && ret_code != OK && !isDeclScope; currIdx--)  {
+    if (auto search = scopeStack[currIdx]->known_values.find(varName); search != scopeStack[currIdx]->known_values.end())  {
+      knownValTkn = search->second;
+      ret_code = OK;
+    }
+    isDeclScope = (scopeStack[currIdx]->findVar (lookUpName, nameHash) != NULL);
+  }
+
+  return ret_code;
+
+}
@@ -38,10 +38,14 @@ public:
   virtual ~StackOfScopes();
   void reset();
 
-  int findVar(std::wstring varName, int maxLevels, Token & updateValTkn, ReadOrWrite readOrWrite, std::wstring & errorMsg);
-  int insertNewVarAtCurrScope (std::wstring varName, Token varValue);
+  int findVar(const InternedString & varName, int maxLevels, Token & updateValTkn, ReadOrWrite readOrWrite, std::wstring & errorMsg);
+  int getVarHandle (const InternedString & varName, int maxLevels, scopeVar * & varHandle);
+  int assignVar (scopeVar & varHandle, const Token & newValTkn, std::wstring & errorMsg);
+  int insertNewVarAtCurrScope (const InternedString & varName, const Token & varValue);
+  int insertNewArrayAtCurrScope (const InternedString & arrayName, const Token & elementTkn, uint64_t numElements, bool isAllocated);
   void displayVariables();
-  int openNewScope (uint8_t openedByOpCode, Token scopenerTkn, uint32_t startScopeFilePos, uint32_t scopeLen);
+  int openNewScope (uint8_t openedByOpCode, const Token & scopenerTkn, uint32_t startScopeFilePos, uint32_t scopeLen);
+  void recycleTopScope ();
   int closeTopScope (uint8_t closedScopeOpCode, closeScopeErr & closeErr, bool isRootScope);
   int srcCloseTopScope (InterpretedFileWriter & interpretedFileWriter, uint8_t & closedScopeOpCode, closeScopeErr & closeErr, bool isRootScope);
   int srcCloseTopScope (InterpretedFileWriter & interpretedFileWriter, uint8_t & closedScopeOpCode, closeScopeErr & closeErr);
@@ -55,8 +59,25 @@ public:
   int get_top_is_exists_for_loop_cond (bool & is_exists);
   int set_top_is_exists_for_loop_cond (bool & is_exists);
 
+  int get_top_if_chain_state (ifChainState & chain_state);
+  int set_top_if_chain_state (ifChainState chain_state);
+  int get_top_is_unreachable (bool & is_unreachable);
+  int set_top_is_unreachable (bool is_unreachable);
+  int add_top_if_chain_block (ifChainBlock chain_block);
+  int get_top_if_chain_blocks (std::vector<ifChainBlock> & chain_blocks);
+  int clear_top_if_chain_blocks ();
+
+  int markVarRead (std::wstring varName);
+  int add_top_store_span (std::wstring varName, storeSpan span);
+  int get_top_unread_stores (std::vector<std::pair<std::wstring, storeSpan>> & unread_stores);
+
+  int setKnownValue (std::wstring varName, Token knownValTkn);
+  int killKnownValue (std::wstring varName);
+  int getKnownValue (std::wstring varName, Token & knownValTkn);
+
 private:
   std::vector<std::shared_ptr<ScopeWindow>> scopeStack;
+  std::vector<std::shared_ptr<ScopeWindow>> scopePool;          // Closed scopes, ready to be reopened
   Utilities util;
   std::wstring thisSrcFile;
 
@@ -0,0 +1,276 @@
+/*
+ * TernaryLookupBuilder.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ *
+ * Compile time pass over a type checked, constant folded ExprTreeNode tree that
+ * finds chains of [?] OPR8Rs that each compare the same integer variable against
+ * a different integer literal, and turns the whole chain into a single [?sel]
+ * OPR8R with its keys sorted.
+ *
+ * count == 3 ? "three" : count == 1 ? "one" : count == 2 ? "two" : "MANY"
+ * [?sel][3][count][1][2][3]["one"]["two"]["three"]["MANY"]
+ *
+ * [?sel][# of keys][selector][sorted keys][values in key order][default value]
+ *
+ * The RunTimeInterpreter resolves the selector once, looks it up among the
+ * sorted keys and only evaluates the value that goes with it, rather than
+ * evaluating every [==] along the way to it.  The [==] conditionals have no
+ * side effects and the keys are all different, so at most 1 of them can come
+ * back TRUE no matter what order they get checked in.
+ *
+ * Keys have to be non-negative, so a negative selector can't match any of them
+ * even though [==] converts a signed operand to unsigned when the other one is.
+ */
+
+#include "TernaryLookupBuilder.h"
+#include <iostream>
+#include <algorithm>
+#include "InfoWarnError.h"
+#include "OpCodes.h"
+#include "TypeChecker.h"
+#include "common.h"
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+TernaryLookupBuilder::TernaryLookupBuilder(const CompileExecTerms & inExecTerms, std::shared_ptr<UserMessages> userMessages)
+  : execTerms (inExecTerms)  {
+
+  this->userMessages = userMessages;
+  thisSrcFile = util.getLastSegment(util.stringToWstring(__FILE__), L"/");
+  failed_on_src_line = 0;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+TernaryLookupBuilder::~TernaryLookupBuilder() {
+  if (failed_on_src_line > 0 && !userMessages->isExistsInternalError(thisSrcFile, failed_on_src_line))  {
+    // Dump out a debugging hint
+    std::wcout << L"FAILURE on " << thisSrcFile << L":" << failed_on_src_line << std::endl;
+  }
+}
+
+/* ****************************************************************************
+ * Turn every qualifying [?] chain under rootOfExpr into a lookup table in place.
+ * Not finding any is not a failure.
+ * ***************************************************************************/
+int TernaryLookupBuilder::buildLookupTables (std::shared_ptr<ExprTreeNode> rootOfExpr, std::vector<builtLookup> & builtTables) {
+  int ret_code = GENERAL_FAILURE;
+
+  builtTables.clear();
+
+  if (OK != buildNode_OLR (rootOfExpr, builtTables))
+    SET_FAILED_ON_SRC_LINE;
+  else
+    ret_code = OK;
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * Same test a [?] conditional has to pass to be part of a lookup table, for
+ * other chains that pick 1 of several paths off of an integer variable
+ * ***************************************************************************/
+bool TernaryLookupBuilder::isSelectorKeyCompare (std::shared_ptr<ExprTreeNode> condNode, std::wstring & selectorName, int64_t & key)  {
+  std::shared_ptr<ExprTreeNode> selectorNode;
+  lookupArm arm;
+  bool isMatch = isKeyCompare (condNode, selectorNode, arm);
+
+  if (isMatch)  {
+    selectorName = selectorNode->originalTkn->_string;
+    key = arm.key;
+  }
+
+  return isMatch;
+}
+
+/* ****************************************************************************
+ * Outermost [?] of a chain gets looked at 1st; converting an inner one 1st
+ * would break up the chain.
+ * ***************************************************************************/
+int TernaryLookupBuilder::buildNode_OLR (std::shared_ptr<ExprTreeNode> currNode, std::vector<builtLookup> & builtTables) {
+  int ret_code = GENERAL_FAILURE;
+
+  if (currNode == NULL || currNode->originalTkn == NULL)  {
+    ret_code = OK;
+
+  } else  {
+    std::shared_ptr<ExprTreeNode> selectorNode, defaultNode;
+    std::vector<lookupArm> arms;
+
+    if (collectArms (currNode, selectorNode, arms, defaultNode))  {
+      builtTables.push_back ({arms[0].key_tkn->get_line_number(), (int)arms.size()});
+      makeLookup (currNode, selectorNode, arms, defaultNode);
+    }
+
+    ret_code = OK;
+    if (OK != buildNode_OLR (currNode->_1stChild, builtTables) || OK != buildNode_OLR (currNode->_2ndChild, builtTables))
+      ret_code = GENERAL_FAILURE;
+
+    for (int idx = 0; idx < currNode->parameter_list.size() && OK == ret_code; idx++)
+      ret_code = buildNode_OLR (currNode->parameter_list[idx], builtTables);
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * [?][x == key1][:][value1][?][x == key2][:][value2] ... [default]
+ * Walk down the FALSE paths for as long as the conditional compares the same
+ * variable against a literal key that hasn't already been used.
+ * ***************************************************************************/
+bool TernaryLookupBuilder::collectArms (std::shared_ptr<ExprTreeNode> currNode, std::shared_ptr<ExprTreeNode> & selectorNode
+  , std::vector<lookupArm> & arms, std::shared_ptr<ExprTreeNode> & defaultNode)  {
+  std::shared_ptr<ExprTreeNode> chainNode = currNode;
+  bool isChainDone = false;
+  bool isDupKey = false;
+  uint8_t op_code, colon_op_code;
+
+  arms.clear();
+  selectorNode.reset();
+
+  while (!isChainDone && !isDupKey && arms.size() < MAX_LOOKUP_ARMS)  {
+    std::shared_ptr<ExprTreeNode> colonNode = chainNode->_2ndChild;
+    lookupArm arm;
+
+    if (isOpr8rNode (chainNode, op_code) && op_code == TERNARY_1ST_OPR8R_OPCODE && colonNode != NULL
+      && isOpr8rNode (colonNode, colon_op_code) && colon_op_code == TERNARY_2ND_OPR8R_OPCODE
+      && colonNode->_1stChild != NULL && colonNode->_2ndChild != NULL
+      && isKeyCompare (chainNode->_1stChild, selectorNode, arm))  {
+
+      for (auto & prevArm : arms)  {
+        if (prevArm.key == arm.key)
+          // 1st one would win; not worth the trouble
+          isDupKey = true;
+      }
+
+      arm.value_node = colonNode->_1stChild;
+      arms.push_back (arm);
+      chainNode = colonNode->_2ndChild;
+
+    } else  {
+      isChainDone = true;
+    }
+  }
+
+  defaultNode = chainNode;
+
+  return (!isDupKey && arms.size() >= MIN_LOOKUP_ARMS);
+}
+
+/* ****************************************************************************
+ * [==][x][key] or [==][key][x], where x is the same integer variable as the
+ * rest of the chain
+ * ***************************************************************************/
+bool TernaryLookupBuilder::isKeyCompare (std::shared_ptr<ExprTreeNode> condNode, std::shared_ptr<ExprTreeNode> & selectorNode
+  , lookupArm & arm)  {
+  bool isMatch = false;
+  uint8_t op_code;
+
+  if (condNode != NULL && isOpr8rNode (condNode, op_code) && op_code == EQUALITY_OPR8R_OPCODE
+    && condNode->_1stChild != NULL && condNode->_2ndChild != NULL)  {
+    std::shared_ptr<ExprTreeNode> varNode = condNode->_1stChild;
+    std::shared_ptr<ExprTreeNode> keyNode = condNode->_2ndChild;
+
+    if (varNode->originalTkn->tkn_type != USER_WORD_TKN)
+      std::swap (varNode, keyNode);
+
+    if (varNode->originalTkn->tkn_type == USER_WORD_TKN && varNode->_1stChild == NULL && varNode->_2ndChild == NULL
+      && varNode->resultTypes != 0 && (varNode->resultTypes & ~INTEGER_DATA_TYPES) == 0
+      && (selectorNode == NULL || selectorNode->originalTkn->_string == varNode->originalTkn->_string)
+      && isIntegerKey (keyNode, arm.key))  {
+      if (selectorNode == NULL)
+        selectorNode = varNode;
+      arm.key_tkn = keyNode->originalTkn;
+      isMatch = true;
+    }
+  }
+
+  return isMatch;
+}
+
+/* ****************************************************************************
+ * Non-negative UINT[N] or INT[N] literal that fits in an INT64
+ * ***************************************************************************/
+bool TernaryLookupBuilder::isIntegerKey (std::shared_ptr<ExprTreeNode> currNode, int64_t & key)  {
+  bool isKey = false;
+  Token & tkn = *currNode->originalTkn;
+
+  if (currNode->_1stChild == NULL && currNode->_2ndChild == NULL && currNode->parameter_list.empty())  {
+    if (tkn.isUnsigned() && tkn._unsigned <= INT64_MAX)  {
+      key = tkn._unsigned;
+      isKey = true;
+
+    } else if (tkn.isSigned() && tkn._signed >= 0) {
+      key = tkn._signed;
+      isKey = true;
+    }
+  }
+
+  return isKey;
+}
+
+/* ****************************************************************************
+ * currNode -> [?sel][# of keys][selector][sorted keys][values in key order][default value]
+ * ***************************************************************************/
+void TernaryLookupBuilder::makeLookup (std::shared_ptr<ExprTreeNode> currNode, std::shared_ptr<ExprTreeNode> selectorNode
+  , std::vector<lookupArm> & arms, std::shared_ptr<ExprTreeNode> defaultNode)  {
+
+  std::stable_sort (arms.begin(), arms.end(), [] (const lookupArm & arm1, const lookupArm & arm2) {
+    return arm1.key < arm2.key;
+  });
+
+  std::shared_ptr<Token> selectTkn = std::make_shared<Token> (EXEC_OPR8R_TKN, LOOKUP_SELECT_OPR8R);
+  selectTkn->_unsigned = LOOKUP_SELECT_OPR8R_OPCODE;
+  std::shared_ptr<Token> countTkn = std::make_shared<Token> (UINT32_TKN, std::to_wstring (arms.size()));
+  countTkn->_unsigned = arms.size();
+  countTkn->isInitialized = true;
+
+  std::vector<std::shared_ptr<ExprTreeNode>> lookupParams;
+  lookupParams.push_back (std::make_shared<ExprTreeNode> (countTkn));
+  lookupParams.back()->resultTypes = UNSIGNED_DATA_TYPE;
+  lookupParams.push_back (selectorNode);
+
+  for (auto & arm : arms)  {
+    lookupParams.push_back (std::make_shared<ExprTreeNode> (arm.key_tkn));
+    lookupParams.back()->resultTypes = arm.key_tkn->isSigned() ? SIGNED_DATA_TYPE : UNSIGNED_DATA_TYPE;
+  }
+
+  for (auto & arm : arms)
+    lookupParams.push_back (arm.value_node);
+
+  lookupParams.push_back (defaultNode);
+
+  for (auto param : lookupParams)
+    param->treeParent = currNode;
+
+  currNode->originalTkn = selectTkn;
+  currNode->_1stChild.reset();
+  currNode->_2ndChild.reset();
+  currNode->parameter_list = lookupParams;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+bool TernaryLookupBuilder::isOpr8rNode (std::shared_ptr<ExprTreeNode> currNode, uint8_t & op_code) {
+  bool isOpr8r = false;
+  op_code = INVALID_OPCODE;
+
+  if (currNode->originalTkn->tkn_type == SRC_OPR8R_TKN) {
+    if (currNode->originalTkn->_string == execTerms.get_statement_ender())
+      op_code = STATEMENT_ENDER_OPR8R_OPCODE;
+    else
+      op_code = execTerms.getOpCodeFor (currNode->originalTkn->_string);
+    isOpr8r = true;
+
+  } else if (currNode->originalTkn->tkn_type == EXEC_OPR8R_TKN) {
+    op_code = currNode->originalTkn->_unsigned;
+    isOpr8r = true;
+  }
+
+  return isOpr8r;
+}
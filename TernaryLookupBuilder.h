@@ -0,0 +1,69 @@
+/*
+ * TernaryLookupBuilder.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ */
+
+#ifndef TERNARYLOOKUPBUILDER_H_
+#define TERNARYLOOKUPBUILDER_H_
+
+#include <string>
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include "CompileExecTerms.h"
+#include "ExprTreeNode.h"
+#include "Token.h"
+#include "Utilities.h"
+#include "UserMessages.h"
+
+// Shorter chains are just as quick to run 1 [?] at a time
+#define MIN_LOOKUP_ARMS   3
+#define MAX_LOOKUP_ARMS   1024
+
+// [x == key] ? value : ...
+struct lookup_arm_struct {
+  std::shared_ptr<Token> key_tkn;
+  int64_t key;
+  std::shared_ptr<ExprTreeNode> value_node;
+};
+
+typedef lookup_arm_struct lookupArm;
+
+// Where a chain got turned into a lookup table, for VERBOSE output
+struct built_lookup_struct {
+  int line_num;
+  int num_arms;
+};
+
+typedef built_lookup_struct builtLookup;
+
+class TernaryLookupBuilder {
+public:
+  TernaryLookupBuilder(const CompileExecTerms & inExecTerms, std::shared_ptr<UserMessages> userMessages);
+  virtual ~TernaryLookupBuilder();
+
+  int buildLookupTables (std::shared_ptr<ExprTreeNode> rootOfExpr, std::vector<builtLookup> & builtTables);
+  bool isSelectorKeyCompare (std::shared_ptr<ExprTreeNode> condNode, std::wstring & selectorName, int64_t & key);
+
+private:
+  const CompileExecTerms & execTerms;
+  std::shared_ptr<UserMessages> userMessages;
+  std::wstring thisSrcFile;
+  Utilities util;
+  int failed_on_src_line;
+
+  int buildNode_OLR (std::shared_ptr<ExprTreeNode> currNode, std::vector<builtLookup> & builtTables);
+  bool collectArms (std::shared_ptr<ExprTreeNode> currNode, std::shared_ptr<ExprTreeNode> & selectorNode
+    , std::vector<lookupArm> & arms, std::shared_ptr<ExprTreeNode> & defaultNode);
+  bool isKeyCompare (std::shared_ptr<ExprTreeNode> condNode, std::shared_ptr<ExprTreeNode> & selectorNode, lookupArm & arm);
+  bool isIntegerKey (std::shared_ptr<ExprTreeNode> currNode, int64_t & key);
+  void makeLookup (std::shared_ptr<ExprTreeNode> currNode, std::shared_ptr<ExprTreeNode> selectorNode
+    , std::vector<lookupArm> & arms, std::shared_ptr<ExprTreeNode> defaultNode);
+
+  bool isOpr8rNode (std::shared_ptr<ExprTreeNode> currNode, uint8_t & op_code);
+
+};
+
+#endif /* TERNARYLOOKUPBUILDER_H_ */
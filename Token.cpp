@@ -10,6 +10,7 @@
 #include "Token.h"
 #include "TokenCompareResult.h"
 #include "locale_strings.h"
+#include "NumberFormatter.h"
 #include <algorithm>
 #include <cmath>
 #include <cstdint>
@@ -86,9 +87,8 @@ Token::Token (tkn_type_enum found_type, std::wstring tokenized_str, std::wstring
 
 Token::~Token() {
 
-  if (_string.length() > 0) {
-    _string.erase(0, _string.length());
-  }
+  // Drop this Token's reference; the characters go when the last one does
+  _string.clear();
 }
 
 Token& Token::operator= (const Token & srcTkn)
@@ -217,6 +217,18 @@ std::wstring Token::get_type_str(bool is_ret_friendly_name)  {
     case VOID_TKN:
       internal_type_str = L"VOID_TKN";     
       break; 
+    case TEMP_SLOT_TKN:
+      internal_type_str = L"TEMP_SLOT_TKN";
+      friendly_type_str = L"temp slot";
+      break;
+    case INVARIANT_SLOT_TKN:
+      internal_type_str = L"INVARIANT_SLOT_TKN";
+      friendly_type_str = L"invariant slot";
+      break;
+    case ARRAY_ELEMENT_TKN:
+      internal_type_str = L"ARRAY_ELEMENT_TKN";
+      friendly_type_str = L"array element";
+      break;
     default:
       internal_type_str = L"BRKN_TKN";
       friendly_type_str = L"UNDEFINED";
@@ -255,61 +267,78 @@ std::wstring Token::get_type_str(bool is_ret_friendly_name)  {
  * ***************************************************************************/
 std::wstring Token::getValueStr ()  {
   std::wstring value;
-  std::wstringstream hexStream;
+  appendValueStr (value);
+  return (value);
+}
 
-  hexStream.str (L"");
-  hexStream << L"0x" << std::hex << _unsigned;
-  std::wstring hexStr = hexStream.str();
+/* ****************************************************************************
+ * Append the same text getValueStr would give onto valueStr.  Only the number
+ * this type of Token actually shows gets formatted.
+ * ***************************************************************************/
+void Token::appendValueStr (std::wstring & valueStr)  {
+  size_t startLen = valueStr.length();
 
   // Give STRINGs, DATETIMEs and SPR8Rs some context clues
   if (tkn_type == STRING_TKN || tkn_type == DATETIME_TKN) {
-    value.append (L"\"");
-    value.append (_string);
-    value.append (L"\"");
+    valueStr.reserve (startLen + _string.length() + 2);
+    valueStr.append (L"\"");
+    valueStr.append (_string);
+    valueStr.append (L"\"");
   
   } else if (tkn_type == SPR8R_TKN) {
-    value.append (L"'");
-    value.append (_string);
-    value.append (L"'");
+    valueStr.append (L"'");
+    valueStr.append (_string);
+    valueStr.append (L"'");
   
   } else if (tkn_type == USER_WORD_TKN || tkn_type == DATA_TYPE_TKN || tkn_type == SRC_OPR8R_TKN || tkn_type == RESERVED_WORD_TKN
     || tkn_type == INTERNAL_USE_TKN)  {
-    value.append (_string);
+    valueStr.append (_string);
 
   } else if (tkn_type == SYSTEM_CALL_TKN) {
-    value.append (L"sys_call::");
-    value.append (_string);
+    valueStr.append (L"sys_call::");
+    valueStr.append (_string);
 
   } else if (tkn_type == BOOL_TKN)  {
     if (_unsigned > 0)
-      value.append (TRUE_RESERVED_WORD);
+      valueStr.append (TRUE_RESERVED_WORD);
     else
-      value.append (FALSE_RESERVED_WORD);
+      valueStr.append (FALSE_RESERVED_WORD);
   
   } else if (tkn_type == EXEC_OPR8R_TKN)  {
     if (!_string.empty()) {
-      value.append (_string);
+      valueStr.append (_string);
     } else {
-      value.append (L"EXEC_OPR8R_TKN->");
-      value.append (hexStr);
+      valueStr.append (L"EXEC_OPR8R_TKN->");
+      NumberFormatter::appendHex (valueStr, _unsigned);
     }
-  }
 
-  if (isUnsigned()) {
-    value.append (hexStr);
+  } else if (tkn_type == TEMP_SLOT_TKN)  {
+    valueStr.append (L"tmp::");
+    NumberFormatter::appendUnsigned (valueStr, _unsigned);
+
+  } else if (tkn_type == INVARIANT_SLOT_TKN)  {
+    valueStr.append (L"inv::");
+    NumberFormatter::appendUnsigned (valueStr, _unsigned);
+
+  } else if (tkn_type == ARRAY_ELEMENT_TKN)  {
+    // Brackets would throw off the illustrative caret
+    valueStr.append (_string);
+    valueStr.append (L"::");
+    NumberFormatter::appendUnsigned (valueStr, _unsigned);
+
+  } else if (isUnsigned()) {
+    NumberFormatter::appendHex (valueStr, _unsigned);
 
   } else if (isSigned())  {
-    value.append (std::to_wstring (_signed));
+    NumberFormatter::appendSigned (valueStr, _signed);
 
   } else if (tkn_type == DOUBLE_TKN)  {
-    value.append (std::to_wstring (_double));
+    NumberFormatter::appendDouble (valueStr, _double);
   }
 
-  if (value.empty())
+  if (valueStr.length() == startLen)
     // Nothing normal fits, but we need to display SOMETHING
-    value.append (get_type_str(false));
-
-  return (value);
+    valueStr.append (get_type_str(false));
 }
 
 /* ****************************************************************************
@@ -367,11 +396,15 @@ TokenCompareResult Token::compare (Token & otherTkn)  {
     if (tkn_type == otherTkn.tkn_type)  {
       switch (tkn_type) {
         case STRING_TKN:
-          _string > otherTkn._string ? compareRez.gr8rThan = isTrue : compareRez.gr8rThan = isFalse;
-          _string >= otherTkn._string ? compareRez.gr8rEquals = isTrue : compareRez.gr8rEquals = isFalse;
-          _string < otherTkn._string ? compareRez.lessThan = isTrue : compareRez.lessThan = isFalse;
-          _string <= otherTkn._string ? compareRez.lessEquals = isTrue : compareRez.lessEquals = isFalse;
-          _string == otherTkn._string ? compareRez.equals = isTrue : compareRez.equals = isFalse;
+          {
+            // Interned strings settle [==] with a pointer compare; only walk the characters once otherwise
+            int strCmp = (_string == otherTkn._string) ? 0 : _string.compare (otherTkn._string);
+            strCmp > 0 ? compareRez.gr8rThan = isTrue : compareRez.gr8rThan = isFalse;
+            strCmp >= 0 ? compareRez.gr8rEquals = isTrue : compareRez.gr8rEquals = isFalse;
+            strCmp < 0 ? compareRez.lessThan = isTrue : compareRez.lessThan = isFalse;
+            strCmp <= 0 ? compareRez.lessEquals = isTrue : compareRez.lessEquals = isFalse;
+            strCmp == 0 ? compareRez.equals = isTrue : compareRez.equals = isFalse;
+          }
           break;
 
         case DATETIME_TKN:
@@ -564,7 +597,7 @@ bool Token::evalResolvedTokenAsIf ()  {
 /* ****************************************************************************
  *
  * ***************************************************************************/
-bool Token::isUnsigned () {
+bool Token::isUnsigned () const {
   bool isUnsigned = false;
 
   switch (tkn_type) {
@@ -584,7 +617,7 @@ bool Token::isUnsigned () {
 /* ****************************************************************************
  *
  * ***************************************************************************/
-bool Token::isSigned () {
+bool Token::isSigned () const {
   bool isSigned = false;
 
   switch (tkn_type) {
@@ -669,14 +702,14 @@ void Token::resetToDouble (double newValue) {
 void Token::resetToString (std::wstring newValue) {
   resetTokenExceptSrc();
 
-  _string.append (newValue);
+  _string = std::move (newValue);
   tkn_type = STRING_TKN;
 }
 
 /* ****************************************************************************
  *
  * ***************************************************************************/
-int Token::convertTo (Token newValTkn, std::wstring variableName, std::wstring & errorMsg)  {
+int Token::convertTo (const Token & newValTkn, const std::wstring & variableName, std::wstring & errorMsg)  {
   int ret_code = GENERAL_FAILURE;
 
   if (tkn_type == newValTkn.tkn_type) {
@@ -764,7 +797,8 @@ int Token::convertTo (Token newValTkn, std::wstring variableName, std::wstring &
 
   if (OK != ret_code) {
     // TODO:
-    errorMsg = L"Failed to convert variable [" + variableName + L"] of type " + get_type_str(true) + L" to " + newValTkn.descr_sans_line_num_col();
+    Token failedValTkn = newValTkn;
+    errorMsg = L"Failed to convert variable [" + variableName + L"] of type " + get_type_str(true) + L" to " + failedValTkn.descr_sans_line_num_col();
   }
 
   return (ret_code);
@@ -13,6 +13,7 @@
 #include <memory>
 #include <cmath>
 #include "OpCodes.h"
+#include "InternedString.h"
 #include <regex.h>
 
 #define END_OF_STREAM_STR L"END_OF_STREAM"
@@ -53,6 +54,9 @@ enum tkn_type_enum {
                             // Will need a token to indicate EOS since the compiler
                             // could empty the list while the file_parser is still producing
   ,INTERNAL_USE_TKN                            
+  ,TEMP_SLOT_TKN            // Run-time only; _unsigned holds the slot # of a value saved earlier in the same expression
+  ,INVARIANT_SLOT_TKN       // Run-time only; _unsigned holds the slot # of a value saved in front of the enclosing loop
+  ,ARRAY_ELEMENT_TKN        // Run-time only; element of array _string about to be written to, at bounds checked index _unsigned
 };
 
 typedef tkn_type_enum TokenTypeEnum;
@@ -69,6 +73,7 @@ class Token {
     std::wstring descr_sans_line_num_col ();
     std::wstring descr_line_num_col ();
     std::wstring getValueStr ();
+    void appendValueStr (std::wstring & valueStr);
     std::wstring getBracketedValueStr ();
     TokenCompareResult compare (Token & otherTkn);
     // Make isOperand static to live beyond any single Token instance
@@ -76,8 +81,8 @@ class Token {
     static bool is_valid_call_ret_type (TokenTypeEnum token_type);
     bool isDirectOperand();
     bool evalResolvedTokenAsIf ();
-    bool isUnsigned ();
-    bool isSigned ();
+    bool isUnsigned () const;
+    bool isSigned () const;
     void resetToken ();
     void resetTokenExceptSrc ();
     void resetToBool (bool isTrue);
@@ -85,13 +90,13 @@ class Token {
     void resetToSigned (int64_t newValue);
     void resetToDouble (double newValue);
     void resetToString (std::wstring newValue);
-    int convertTo (Token newValTkn, std::wstring variableName, std::wstring & errorMsg);
+    int convertTo (const Token & newValTkn, const std::wstring & variableName, std::wstring & errorMsg);
     int get_line_number ();
     int get_column_pos ();
 
 
     TokenTypeEnum tkn_type;
-    std::wstring _string;
+    InternedString _string;
     uint64_t    _unsigned;
     int64_t     _signed;
     double       _double;
@@ -0,0 +1,971 @@
+/*
+ * TypeChecker.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ *
+ * Static pass over a compiled ExprTreeNode tree that infers the data type(s)
+ * each node can resolve to, checks OPR8R|operand compatibility and flags reads
+ * of uninitialized variables - without evaluating anything. The rules mirror
+ * what RunTimeInterpreter will accept. Because integer widths and even the type
+ * of a [/] result depend on operand values, only combinations that can NEVER
+ * work are reported; value dependent failures (divide by zero, negative shift
+ * counts, etc.) are still caught by the RunTimeInterpreter.
+ *
+ * Inferred types are left in ExprTreeNode::resultTypes for the code generator
+ * and any later passes over the tree.
+ */
+
+#include "TypeChecker.h"
+#include <iostream>
+#include <vector>
+#include "InfoWarnError.h"
+#include "OpCodes.h"
+#include "common.h"
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+TypeChecker::TypeChecker(const CompileExecTerms & inExecTerms, std::shared_ptr<StackOfScopes> inVarScopeStack
+  , std::wstring userSrcFileName, std::shared_ptr<UserMessages> userMessages)
+  : execTerms (inExecTerms) {
+
+  scopedNameSpace = inVarScopeStack;
+  this->userSrcFileName = userSrcFileName;
+  this->userMessages = userMessages;
+  thisSrcFile = util.getLastSegment(util.stringToWstring(__FILE__), L"/");
+  failed_on_src_line = 0;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+TypeChecker::~TypeChecker() {
+
+  if (failed_on_src_line > 0 && !userMessages->isExistsInternalError(thisSrcFile, failed_on_src_line)) {
+    // Dump out a debugging hint
+    std::wcout << L"FAILURE on " << thisSrcFile << L":" << failed_on_src_line << std::endl;
+  }
+}
+
+/* ****************************************************************************
+ * Entry point for a stand-alone expression
+ * ***************************************************************************/
+int TypeChecker::checkExprTree (std::shared_ptr<ExprTreeNode> rootOfExpr, uint8_t & resultTypes)  {
+  return checkNode (rootOfExpr, resultTypes);
+}
+
+/* ****************************************************************************
+ * Variable declaration with an initialization expression.  The expression has
+ * to be checked, its result must be assignable to the declared data type and
+ * the variable is initialized from here on.
+ * ***************************************************************************/
+int TypeChecker::checkVarInitExpr (std::wstring varName, std::shared_ptr<ExprTreeNode> rootOfExpr)  {
+  int ret_code = GENERAL_FAILURE;
+  uint8_t initTypes;
+
+  if (OK != checkNode (rootOfExpr, initTypes))
+    SET_FAILED_ON_SRC_LINE;
+
+  else if (OK != checkConversion (varName, initTypes, rootOfExpr->originalTkn))
+    SET_FAILED_ON_SRC_LINE;
+
+  else if (OK != markVarInitialized (varName))
+    SET_FAILED_ON_SRC_LINE;
+
+  else
+    ret_code = OK;
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * Parameters of a system call are complete expressions in their own right.
+ * Each one has to be compatible with the data type the system call expects; an
+ * INVALID_OPCODE in the definition's parameter list means any type goes, and
+ * SYS_CALL_NUMERIC_PARAM means any integer or double goes.  Array parameters
+ * have to be a bare array name; see checkArrayParam.
+ * ***************************************************************************/
+int TypeChecker::checkSystemCall (std::shared_ptr<ExprTreeNode> sysCallNode, uint8_t & resultTypes)  {
+  int ret_code = GENERAL_FAILURE;
+  std::vector<uint8_t> paramList;
+  TokenTypeEnum retDataType;
+  std::wstring sysCallName = sysCallNode->originalTkn->_string;
+
+  resultTypes = 0;
+
+  if (OK != execTerms.get_system_call_details (sysCallName, paramList, retDataType))  {
+    userMessages->logMsg (INTERNAL_ERROR, L"Unknown system call " + sysCallNode->originalTkn->descr_sans_line_num_col(), thisSrcFile, __LINE__, 0);
+
+  } else if (paramList.size() != sysCallNode->parameter_list.size())  {
+    userMessages->logMsg (INTERNAL_ERROR, L"Parameter count mismatch for system call " + sysCallNode->originalTkn->descr_sans_line_num_col()
+      , thisSrcFile, __LINE__, 0);
+
+  } else {
+    bool isFailed = false;
+    uint8_t allParamTypes = 0;
+    TokenTypeEnum elementType = START_UNDEF_TKN;
+
+    for (int idx = 0; idx < paramList.size() && !isFailed; idx++)  {
+      uint8_t paramTypes;
+      std::wstring varName;
+
+      if (paramList[idx] == SYS_CALL_ARRAY_PARAM || paramList[idx] == SYS_CALL_NUMERIC_ARRAY_PARAM
+        || paramList[idx] == SYS_CALL_MATCHING_ARRAY_PARAM)  {
+        if (OK != checkArrayParam (sysCallNode, idx, paramList[idx], elementType))
+          isFailed = true;
+        else
+          // e.g. array_sum() of a double array is a double
+          allParamTypes |= getDataTypeMask (elementType);
+
+      } else if (OK != checkOperand (sysCallNode->parameter_list[idx], true, paramTypes, varName)) {
+        isFailed = true;
+
+      } else if (paramList[idx] == SYS_CALL_ELEMENT_PARAM) {
+        uint8_t expectedType = getDataTypeMask (elementType);
+        bool isMatch = false;
+
+        for (int srcType = 0x1; srcType <= LAST_DATA_TYPE_BIT && !isMatch; srcType <<= 1)  {
+          if ((srcType & paramTypes) && isConvertible (expectedType, srcType))
+            isMatch = true;
+        }
+
+        if (!isMatch) {
+          userMessages->logMsg (USER_ERROR, L"Parameter " + std::to_wstring(idx + 1) + L" of system call [" + sysCallName + L"] expects "
+            + getDataTypesDescr (expectedType) + L" but got " + getDataTypesDescr (paramTypes)
+            , userSrcFileName, sysCallNode->originalTkn->get_line_number(), sysCallNode->originalTkn->get_column_pos());
+          isFailed = true;
+        }
+
+      } else if (paramList[idx] == SYS_CALL_NUMERIC_PARAM && 0 == (paramTypes & NUMERIC_DATA_TYPES)) {
+        userMessages->logMsg (USER_ERROR, L"Parameter " + std::to_wstring(idx + 1) + L" of system call [" + sysCallName + L"] expects "
+          + getDataTypesDescr (NUMERIC_DATA_TYPES) + L" but got " + getDataTypesDescr (paramTypes)
+          , userSrcFileName, sysCallNode->originalTkn->get_line_number(), sysCallNode->originalTkn->get_column_pos());
+        isFailed = true;
+
+      } else if (paramList[idx] == SYS_CALL_NUMERIC_PARAM) {
+        allParamTypes |= (paramTypes & NUMERIC_DATA_TYPES);
+
+      } else if (paramList[idx] != INVALID_OPCODE) {
+        uint8_t expectedType = getDataTypeMask (execTerms.getTokenTypeForOpCode (paramList[idx]));
+        bool isMatch = false;
+
+        for (int srcType = 0x1; srcType <= LAST_DATA_TYPE_BIT && !isMatch; srcType <<= 1)  {
+          if ((srcType & paramTypes) && isConvertible (expectedType, srcType))
+            isMatch = true;
+        }
+
+        if (!isMatch) {
+          userMessages->logMsg (USER_ERROR, L"Parameter " + std::to_wstring(idx + 1) + L" of system call [" + sysCallName + L"] expects "
+            + getDataTypesDescr (expectedType) + L" but got " + getDataTypesDescr (paramTypes)
+            , userSrcFileName, sysCallNode->originalTkn->get_line_number(), sysCallNode->originalTkn->get_column_pos());
+          isFailed = true;
+        }
+      }
+    }
+
+    if (!isFailed)  {
+      // e.g. abs() of a signed parameter is signed, abs() of a double is a double
+      resultTypes = (retDataType == INTERNAL_USE_TKN ? allParamTypes : getDataTypeMask (retDataType));
+      sysCallNode->resultTypes = resultTypes;
+      ret_code = OK;
+    }
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * An array gets passed to a system call by name.  elementType comes back with
+ * the array's element data type; for SYS_CALL_MATCHING_ARRAY_PARAM, it's
+ * passed in with the preceding array parameter's.
+ * ***************************************************************************/
+int TypeChecker::checkArrayParam (std::shared_ptr<ExprTreeNode> sysCallNode, int paramIdx, uint8_t paramType, TokenTypeEnum & elementType)  {
+  int ret_code = GENERAL_FAILURE;
+  std::shared_ptr<ExprTreeNode> paramNode = sysCallNode->parameter_list[paramIdx];
+  std::wstring paramDescr = L"Parameter " + std::to_wstring(paramIdx + 1) + L" of system call [" + sysCallNode->originalTkn->_string + L"]";
+  scopeVar * arrayHandle = NULL;
+
+  if (paramNode == NULL || paramNode->originalTkn == NULL)  {
+    userMessages->logMsg (INTERNAL_ERROR, L"Unexpected NULL operand", thisSrcFile, __LINE__, 0);
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (!isLeafNode (paramNode) || paramNode->originalTkn->tkn_type != USER_WORD_TKN
+    || OK != scopedNameSpace->getVarHandle (paramNode->originalTkn->_string, 0, arrayHandle) || arrayHandle->num_elements == 0) {
+    userMessages->logMsg (USER_ERROR, paramDescr + L" must be the name of an array"
+      , userSrcFileName, sysCallNode->originalTkn->get_line_number(), sysCallNode->originalTkn->get_column_pos());
+
+  } else if (paramType == SYS_CALL_NUMERIC_ARRAY_PARAM && 0 == (getDataTypeMask (arrayHandle->value.tkn_type) & NUMERIC_DATA_TYPES))  {
+    userMessages->logMsg (USER_ERROR, paramDescr + L" expects an array of " + getDataTypesDescr (NUMERIC_DATA_TYPES)
+      + L" but got an array of " + arrayHandle->value.get_type_str(true)
+      , userSrcFileName, sysCallNode->originalTkn->get_line_number(), sysCallNode->originalTkn->get_column_pos());
+
+  } else if (paramType == SYS_CALL_MATCHING_ARRAY_PARAM && arrayHandle->value.tkn_type != elementType)  {
+    Token expectedTkn (elementType, L"");
+    userMessages->logMsg (USER_ERROR, paramDescr + L" expects an array of " + expectedTkn.get_type_str(true)
+      + L" but got an array of " + arrayHandle->value.get_type_str(true)
+      , userSrcFileName, sysCallNode->originalTkn->get_line_number(), sysCallNode->originalTkn->get_column_pos());
+
+  } else  {
+    elementType = arrayHandle->value.tkn_type;
+    paramNode->resultTypes = getDataTypeMask (elementType);
+    ret_code = OK;
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * Jump gate for checking the sub-tree rooted at currNode
+ * ***************************************************************************/
+int TypeChecker::checkNode (std::shared_ptr<ExprTreeNode> currNode, uint8_t & resultTypes)  {
+  int ret_code = GENERAL_FAILURE;
+  uint8_t op_code;
+  std::wstring varName;
+
+  resultTypes = 0;
+
+  if (currNode == NULL || currNode->originalTkn == NULL)  {
+    userMessages->logMsg (INTERNAL_ERROR, L"Unexpected NULL expression tree node", thisSrcFile, __LINE__, 0);
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (currNode->originalTkn->tkn_type == SYSTEM_CALL_TKN) {
+    ret_code = checkSystemCall (currNode, resultTypes);
+
+  } else if (!isOpr8rNode (currNode, op_code))  {
+    // Expression consists of a single operand
+    ret_code = checkOperand (currNode, true, resultTypes, varName);
+
+  } else  {
+    switch (op_code)  {
+      case STATEMENT_ENDER_OPR8R_OPCODE :
+        // Syntactic sugar
+        if (currNode->_1stChild != NULL)  {
+          ret_code = checkNode (currNode->_1stChild, resultTypes);
+        } else  {
+          resultTypes = VOID_DATA_TYPE;
+          ret_code = OK;
+        }
+        break;
+      case POST_INCR_OPR8R_OPCODE :
+      case POST_DECR_OPR8R_OPCODE :
+      case PRE_INCR_OPR8R_OPCODE :
+      case PRE_DECR_OPR8R_OPCODE :
+        ret_code = checkPrePostFix (currNode, op_code, resultTypes);
+        break;
+      case ARRAY_ELEMENT_OPR8R_OPCODE :
+        ret_code = checkArrayElement (currNode, resultTypes);
+        break;
+      case UNARY_PLUS_OPR8R_OPCODE :
+      case UNARY_MINUS_OPR8R_OPCODE :
+      case LOGICAL_NOT_OPR8R_OPCODE :
+      case BITWISE_NOT_OPR8R_OPCODE :
+        ret_code = checkUnary (currNode, op_code, resultTypes);
+        break;
+      case LOGICAL_AND_OPR8R_OPCODE :
+      case LOGICAL_OR_OPR8R_OPCODE :
+      case TERNARY_1ST_OPR8R_OPCODE :
+        ret_code = checkShortCircuit (currNode, op_code, resultTypes);
+        break;
+      case ASSIGNMENT_OPR8R_OPCODE :
+      case PLUS_ASSIGN_OPR8R_OPCODE :
+      case MINUS_ASSIGN_OPR8R_OPCODE :
+      case MULTIPLY_ASSIGN_OPR8R_OPCODE :
+      case DIV_ASSIGN_OPR8R_OPCODE :
+      case MOD_ASSIGN_OPR8R_OPCODE :
+      case LEFT_SHIFT_ASSIGN_OPR8R_OPCODE :
+      case RIGHT_SHIFT_ASSIGN_OPR8R_OPCODE :
+      case BITWISE_AND_ASSIGN_OPR8R_OPCODE :
+      case BITWISE_XOR_ASSIGN_OPR8R_OPCODE :
+      case BITWISE_OR_ASSIGN_OPR8R_OPCODE :
+        ret_code = checkAssignment (currNode, op_code, resultTypes);
+        break;
+      case INVALID_OPCODE :
+      case TERNARY_2ND_OPR8R_OPCODE :
+      case BREAK_OPR8R_OPCODE :
+        userMessages->logMsg (INTERNAL_ERROR, L"Unexpected OPR8R " + currNode->originalTkn->descr_sans_line_num_col()
+          , thisSrcFile, __LINE__, 0);
+        SET_FAILED_ON_SRC_LINE;
+        break;
+      default:
+        ret_code = checkBinary (currNode, op_code, resultTypes);
+        break;
+    }
+  }
+
+  if (OK == ret_code)
+    currNode->resultTypes = resultTypes;
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * Operand could be a nested sub-expression, a literal or a variable.  If it's
+ * a variable, varName gets filled in and a NameSpace look up provides the
+ * variable's declared data type.
+ * ***************************************************************************/
+int TypeChecker::checkOperand (std::shared_ptr<ExprTreeNode> operandNode, bool isCheckInit, uint8_t & operandTypes, std::wstring & varName) {
+  int ret_code = GENERAL_FAILURE;
+
+  operandTypes = 0;
+  varName.clear();
+
+  if (operandNode == NULL || operandNode->originalTkn == NULL)  {
+    userMessages->logMsg (INTERNAL_ERROR, L"Unexpected NULL operand", thisSrcFile, __LINE__, 0);
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (!isLeafNode (operandNode)) {
+    ret_code = checkNode (operandNode, operandTypes);
+
+  } else if (operandNode->originalTkn->tkn_type == USER_WORD_TKN)  {
+    std::shared_ptr<Token> varNameTkn = operandNode->originalTkn;
+    Token varTkn;
+    scopeVar * varHandle = NULL;
+    varName = varNameTkn->_string;
+
+    if (OK != scopedNameSpace->getVarHandle (varName, 0, varHandle))  {
+      userMessages->logMsg (INTERNAL_ERROR, L"Variable " + varNameTkn->descr_sans_line_num_col() + L" not found", thisSrcFile, __LINE__, 0);
+      SET_FAILED_ON_SRC_LINE;
+
+    } else if (varHandle->num_elements > 0)  {
+      userMessages->logMsg (USER_ERROR, L"Array " + varNameTkn->descr_sans_line_num_col() + L" can only be used 1 element at a time, or passed to an "
+        + L"array system call", userSrcFileName, varNameTkn->get_line_number(), varNameTkn->get_column_pos());
+
+    } else if (0 == (operandTypes = getDataTypeMask ((varTkn = varHandle->value).tkn_type)))  {
+      userMessages->logMsg (INTERNAL_ERROR, L"Variable " + varNameTkn->descr_sans_line_num_col() + L" has unexpected data type "
+        + varTkn.get_type_str(false), thisSrcFile, __LINE__, 0);
+      SET_FAILED_ON_SRC_LINE;
+
+    } else  {
+      if (isCheckInit && !varTkn.isInitialized) {
+        userMessages->logMsg (WARNING, L"Uninitialized variable used - " + varNameTkn->descr_sans_line_num_col()
+          , userSrcFileName, varNameTkn->get_line_number(), varNameTkn->get_column_pos());
+      }
+      ret_code = OK;
+    }
+
+  } else if (0 == (operandTypes = getDataTypeMask (operandNode->originalTkn->tkn_type)))  {
+    userMessages->logMsg (INTERNAL_ERROR, L"Unexpected operand " + operandNode->originalTkn->descr_sans_line_num_col()
+      , thisSrcFile, __LINE__, 0);
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    ret_code = OK;
+  }
+
+  if (OK == ret_code)
+    operandNode->resultTypes = operandTypes;
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * Nested sub-expressions get checked before the OPR8R's own variable operands
+ * are looked up.  That's the order the RunTimeInterpreter resolves them in, so
+ * any warnings come out in the same order as well.
+ * ***************************************************************************/
+int TypeChecker::checkOperandPair (std::shared_ptr<ExprTreeNode> opr8rNode, bool isCheck1stInit, uint8_t & _1stTypes
+  , std::wstring & _1stVarName, uint8_t & _2ndTypes) {
+  int ret_code = GENERAL_FAILURE;
+  std::shared_ptr<ExprTreeNode> _1stNode = opr8rNode->_1stChild;
+  std::shared_ptr<ExprTreeNode> _2ndNode = opr8rNode->_2ndChild;
+  std::wstring _2ndVarName;
+
+  _1stVarName.clear();
+
+  if (_1stNode == NULL || _2ndNode == NULL) {
+    userMessages->logMsg (INTERNAL_ERROR, L"Missing operand for OPR8R " + opr8rNode->originalTkn->descr_sans_line_num_col()
+      , thisSrcFile, __LINE__, 0);
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (!isLeafNode (_1stNode) && OK != checkNode (_1stNode, _1stTypes)) {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (!isLeafNode (_2ndNode) && OK != checkNode (_2ndNode, _2ndTypes)) {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (isLeafNode (_1stNode) && OK != checkOperand (_1stNode, isCheck1stInit, _1stTypes, _1stVarName))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (isLeafNode (_2ndNode) && OK != checkOperand (_2ndNode, true, _2ndTypes, _2ndVarName))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    ret_code = OK;
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * [=] and the compound assignment OPR8Rs.  Left operand has to be a variable,
+ * and the value that ends up being stored must be convertible to the
+ * variable's declared data type.
+ * ***************************************************************************/
+int TypeChecker::checkAssignment (std::shared_ptr<ExprTreeNode> opr8rNode, uint8_t op_code, uint8_t & resultTypes) {
+  int ret_code = GENERAL_FAILURE;
+  uint8_t varTypes;
+  uint8_t valueTypes;
+  std::wstring varName;
+  uint8_t math_op_code = INVALID_OPCODE;
+
+  switch (op_code)  {
+    case PLUS_ASSIGN_OPR8R_OPCODE :
+      math_op_code = BINARY_PLUS_OPR8R_OPCODE;
+      break;
+    case MINUS_ASSIGN_OPR8R_OPCODE :
+      math_op_code = BINARY_MINUS_OPR8R_OPCODE;
+      break;
+    case MULTIPLY_ASSIGN_OPR8R_OPCODE :
+      math_op_code = MULTIPLY_OPR8R_OPCODE;
+      break;
+    case DIV_ASSIGN_OPR8R_OPCODE :
+      math_op_code = DIV_OPR8R_OPCODE;
+      break;
+    case MOD_ASSIGN_OPR8R_OPCODE :
+      math_op_code = MOD_OPR8R_OPCODE;
+      break;
+    case LEFT_SHIFT_ASSIGN_OPR8R_OPCODE :
+      math_op_code = LEFT_SHIFT_OPR8R_OPCODE;
+      break;
+    case RIGHT_SHIFT_ASSIGN_OPR8R_OPCODE :
+      math_op_code = RIGHT_SHIFT_OPR8R_OPCODE;
+      break;
+    case BITWISE_AND_ASSIGN_OPR8R_OPCODE :
+      math_op_code = BITWISE_AND_OPR8R_OPCODE;
+      break;
+    case BITWISE_XOR_ASSIGN_OPR8R_OPCODE :
+      math_op_code = BITWISE_XOR_OPR8R_OPCODE;
+      break;
+    case BITWISE_OR_ASSIGN_OPR8R_OPCODE :
+      math_op_code = BITWISE_OR_OPR8R_OPCODE;
+      break;
+    default:
+      break;
+  }
+
+  resultTypes = 0;
+
+  // Plain [=] doesn't read the variable it's writing to
+  if (OK != checkOperandPair (opr8rNode, op_code != ASSIGNMENT_OPR8R_OPCODE, varTypes, varName, valueTypes))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (varName.empty() && !isArrayElement (opr8rNode->_1stChild, varName)) {
+    userMessages->logMsg (USER_ERROR, L"Left operand of an assignment operator must be a named variable: "
+      + opr8rNode->originalTkn->descr_sans_line_num_col() + L" Assignment operation may need to be enclosed in parentheses."
+      , userSrcFileName, opr8rNode->originalTkn->get_line_number(), opr8rNode->originalTkn->get_column_pos());
+
+  } else  {
+    if (op_code == ASSIGNMENT_OPR8R_OPCODE)
+      resultTypes = valueTypes;
+    else if (0 == (resultTypes = binaryResultTypes (math_op_code, varTypes, valueTypes)))
+      logOpr8rMismatch (opr8rNode, op_code, getDataTypesDescr (varTypes) + L" and " + getDataTypesDescr (valueTypes));
+
+    if (resultTypes != 0 && OK == checkConversion (varName, resultTypes, opr8rNode->originalTkn) && OK == markVarInitialized (varName))
+      ret_code = OK;
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * [++] and [--] in either their PREFIX or POSTFIX form
+ * ***************************************************************************/
+int TypeChecker::checkPrePostFix (std::shared_ptr<ExprTreeNode> opr8rNode, uint8_t op_code, uint8_t & resultTypes) {
+  int ret_code = GENERAL_FAILURE;
+  std::shared_ptr<ExprTreeNode> operandNode = opr8rNode->_1stChild;
+  uint8_t varTypes;
+  std::wstring varName;
+  std::wstring arrayName;
+
+  resultTypes = 0;
+
+  if (operandNode == NULL || ((!isLeafNode (operandNode) || operandNode->originalTkn->tkn_type != USER_WORD_TKN)
+    && !isArrayElement (operandNode, arrayName))) {
+    userMessages->logMsg (USER_ERROR, L"Operand of " + opr8rNode->originalTkn->descr_sans_line_num_col() + L" must be a named variable"
+      , userSrcFileName, opr8rNode->originalTkn->get_line_number(), opr8rNode->originalTkn->get_column_pos());
+
+  } else if (OK != checkOperand (operandNode, true, varTypes, varName))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (0 == (varTypes & INTEGER_DATA_TYPES)) {
+    logOpr8rMismatch (opr8rNode, op_code, getDataTypesDescr (varTypes));
+
+  } else if (OK == markVarInitialized (arrayName.empty() ? varName : arrayName)) {
+    resultTypes = varTypes;
+    ret_code = OK;
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * [@elm] has the array name as its _1stChild and the index expression as its
+ * _2ndChild.  Whether the index is in bounds is up to the RunTimeInterpreter.
+ * ***************************************************************************/
+int TypeChecker::checkArrayElement (std::shared_ptr<ExprTreeNode> opr8rNode, uint8_t & resultTypes) {
+  int ret_code = GENERAL_FAILURE;
+  std::shared_ptr<ExprTreeNode> arrayNode = opr8rNode->_1stChild;
+  scopeVar * arrayHandle = NULL;
+  uint8_t indexTypes;
+  std::wstring varName;
+
+  resultTypes = 0;
+
+  if (arrayNode == NULL || arrayNode->originalTkn->tkn_type != USER_WORD_TKN
+    || OK != scopedNameSpace->getVarHandle (arrayNode->originalTkn->_string, 0, arrayHandle) || arrayHandle->num_elements == 0)  {
+    userMessages->logMsg (INTERNAL_ERROR, L"Expected an array name ahead of " + opr8rNode->originalTkn->descr_sans_line_num_col()
+      , thisSrcFile, __LINE__, 0);
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (OK != checkOperand (opr8rNode->_2ndChild, true, indexTypes, varName))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (0 == (indexTypes & INTEGER_DATA_TYPES))  {
+    userMessages->logMsg (USER_ERROR, L"Index into array [" + arrayNode->originalTkn->_string + L"] must be an integer but got "
+      + getDataTypesDescr (indexTypes), userSrcFileName, opr8rNode->originalTkn->get_line_number(), opr8rNode->originalTkn->get_column_pos());
+
+  } else  {
+    resultTypes = getDataTypeMask (arrayHandle->value.tkn_type);
+    arrayNode->resultTypes = resultTypes;
+    ret_code = OK;
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * [+] [-] [!] [~] UNARY OPR8Rs
+ * ***************************************************************************/
+int TypeChecker::checkUnary (std::shared_ptr<ExprTreeNode> opr8rNode, uint8_t op_code, uint8_t & resultTypes) {
+  int ret_code = GENERAL_FAILURE;
+  uint8_t operandTypes;
+  std::wstring varName;
+
+  resultTypes = 0;
+
+  if (OK != checkOperand (opr8rNode->_1stChild, true, operandTypes, varName))
+    SET_FAILED_ON_SRC_LINE;
+
+  else if (0 == (resultTypes = unaryResultTypes (op_code, operandTypes)))
+    logOpr8rMismatch (opr8rNode, op_code, getDataTypesDescr (operandTypes));
+
+  else
+    ret_code = OK;
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * Garden variety BINARY OPR8Rs; math, shift, comparison and bitwise
+ * ***************************************************************************/
+int TypeChecker::checkBinary (std::shared_ptr<ExprTreeNode> opr8rNode, uint8_t op_code, uint8_t & resultTypes) {
+  int ret_code = GENERAL_FAILURE;
+  uint8_t _1stTypes;
+  uint8_t _2ndTypes;
+  std::wstring _1stVarName;
+
+  resultTypes = 0;
+
+  if (OK != checkOperandPair (opr8rNode, true, _1stTypes, _1stVarName, _2ndTypes))
+    SET_FAILED_ON_SRC_LINE;
+
+  else if (0 == (resultTypes = binaryResultTypes (op_code, _1stTypes, _2ndTypes)))
+    logOpr8rMismatch (opr8rNode, op_code, getDataTypesDescr (_1stTypes) + L" and " + getDataTypesDescr (_2ndTypes));
+
+  else
+    ret_code = OK;
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * [&&] [||] [?] only evaluate what they need to at run time, so each operand
+ * gets checked as a separate expression, in order.  Every operand that gets
+ * tested for TRUE|FALSE has to be something Token::evalResolvedTokenAsIf can
+ * handle. [?] can result in the data type(s) of either path.
+ * ***************************************************************************/
+int TypeChecker::checkShortCircuit (std::shared_ptr<ExprTreeNode> opr8rNode, uint8_t op_code, uint8_t & resultTypes) {
+  int ret_code = GENERAL_FAILURE;
+  uint8_t truthyTypes = NUMERIC_DATA_TYPES | STRING_DATA_TYPE | BOOL_DATA_TYPE;
+  uint8_t _1stTypes;
+  uint8_t _2ndTypes;
+  std::wstring varName;
+  std::shared_ptr<ExprTreeNode> colonNode = opr8rNode->_2ndChild;
+  uint8_t colon_op_code;
+
+  resultTypes = 0;
+
+  if (OK != checkOperand (opr8rNode->_1stChild, true, _1stTypes, varName))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (0 == (_1stTypes & truthyTypes))  {
+    logOpr8rMismatch (opr8rNode, op_code, getDataTypesDescr (_1stTypes));
+
+  } else if (op_code != TERNARY_1ST_OPR8R_OPCODE) {
+    // [&&] [||]
+    if (OK != checkOperand (opr8rNode->_2ndChild, true, _2ndTypes, varName))  {
+      SET_FAILED_ON_SRC_LINE;
+
+    } else if (0 == (_2ndTypes & truthyTypes))  {
+      logOpr8rMismatch (opr8rNode, op_code, getDataTypesDescr (_1stTypes) + L" and " + getDataTypesDescr (_2ndTypes));
+
+    } else  {
+      resultTypes = UNSIGNED_DATA_TYPE;
+      ret_code = OK;
+    }
+
+  } else if (colonNode == NULL || !isOpr8rNode (colonNode, colon_op_code) || colon_op_code != TERNARY_2ND_OPR8R_OPCODE) {
+    userMessages->logMsg (INTERNAL_ERROR, L"Expected [:] after " + opr8rNode->originalTkn->descr_sans_line_num_col()
+      , thisSrcFile, __LINE__, 0);
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (OK != checkOperand (colonNode->_1stChild, true, _1stTypes, varName))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (OK != checkOperand (colonNode->_2ndChild, true, _2ndTypes, varName))  {
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    resultTypes = _1stTypes | _2ndTypes;
+    colonNode->resultTypes = resultTypes;
+    ret_code = OK;
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * Would ANY of the possible srcTypes successfully Token::convertTo the
+ * variable's declared data type?
+ * ***************************************************************************/
+int TypeChecker::checkConversion (std::wstring varName, uint8_t srcTypes, std::shared_ptr<Token> errorTkn) {
+  int ret_code = GENERAL_FAILURE;
+  Token varTkn;
+  std::wstring lookUpMsg;
+
+  if (OK != scopedNameSpace->findVar (varName, 0, varTkn, READ_ONLY, lookUpMsg))  {
+    userMessages->logMsg (INTERNAL_ERROR, lookUpMsg, thisSrcFile, __LINE__, 0);
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    uint8_t varType = getDataTypeMask (varTkn.tkn_type);
+
+    for (int srcType = 0x1; srcType <= LAST_DATA_TYPE_BIT && ret_code != OK; srcType <<= 1)  {
+      if ((srcType & srcTypes) && isConvertible (varType, srcType))
+        ret_code = OK;
+    }
+
+    if (OK != ret_code) {
+      userMessages->logMsg (USER_ERROR, L"Cannot assign " + getDataTypesDescr (srcTypes) + L" to variable [" + varName
+        + L"] of type " + varTkn.get_type_str(true), userSrcFileName, errorTkn->get_line_number(), errorTkn->get_column_pos());
+    }
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * Successive expressions need to know this variable has been written to
+ * ***************************************************************************/
+int TypeChecker::markVarInitialized (std::wstring varName) {
+  int ret_code = GENERAL_FAILURE;
+  Token varTkn;
+  std::wstring lookUpMsg;
+
+  if (OK != scopedNameSpace->findVar (varName, 0, varTkn, READ_ONLY, lookUpMsg))  {
+    userMessages->logMsg (INTERNAL_ERROR, lookUpMsg, thisSrcFile, __LINE__, 0);
+    SET_FAILED_ON_SRC_LINE;
+
+  } else if (varTkn.isInitialized) {
+    ret_code = OK;
+
+  } else if (OK != scopedNameSpace->findVar (varName, 0, varTkn, COMMIT_WRITE, lookUpMsg))  {
+    // Same data type, so this is a straight copy that flips isInitialized
+    userMessages->logMsg (INTERNAL_ERROR, lookUpMsg, thisSrcFile, __LINE__, 0);
+    SET_FAILED_ON_SRC_LINE;
+
+  } else  {
+    ret_code = OK;
+  }
+
+  return ret_code;
+}
+
+/* ****************************************************************************
+ * Tree could still be in compiler form [SRC_OPR8R_TKN] or might have been
+ * flattened already [EXEC_OPR8R_TKN]
+ * ***************************************************************************/
+bool TypeChecker::isOpr8rNode (std::shared_ptr<ExprTreeNode> currNode, uint8_t & op_code) {
+  bool isOpr8r = false;
+  op_code = INVALID_OPCODE;
+
+  if (currNode->originalTkn->tkn_type == SRC_OPR8R_TKN) {
+    if (currNode->originalTkn->_string == execTerms.get_statement_ender())
+      op_code = STATEMENT_ENDER_OPR8R_OPCODE;
+    else
+      op_code = execTerms.getOpCodeFor (currNode->originalTkn->_string);
+    isOpr8r = true;
+
+  } else if (currNode->originalTkn->tkn_type == EXEC_OPR8R_TKN) {
+    op_code = currNode->originalTkn->_unsigned;
+    isOpr8r = true;
+  }
+
+  return isOpr8r;
+}
+
+/* ****************************************************************************
+ * An array element can be written to like a variable; arrayName gets filled in
+ * ***************************************************************************/
+bool TypeChecker::isArrayElement (std::shared_ptr<ExprTreeNode> currNode, std::wstring & arrayName) {
+  uint8_t op_code;
+  bool isElement = (currNode != NULL && isOpr8rNode (currNode, op_code) && op_code == ARRAY_ELEMENT_OPR8R_OPCODE
+    && currNode->_1stChild != NULL);
+
+  if (isElement)
+    arrayName = currNode->_1stChild->originalTkn->_string;
+
+  return isElement;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+bool TypeChecker::isLeafNode (std::shared_ptr<ExprTreeNode> currNode) {
+  uint8_t op_code;
+
+  return (currNode->originalTkn->tkn_type != SYSTEM_CALL_TKN && !isOpr8rNode (currNode, op_code));
+}
+
+/* ****************************************************************************
+ * Mirrors RunTimeInterpreter::execUnaryOp
+ * ***************************************************************************/
+uint8_t TypeChecker::unaryResultTypes (uint8_t op_code, uint8_t operandTypes) {
+  uint8_t resultTypes = 0;
+
+  for (int operandType = 0x1; operandType <= LAST_DATA_TYPE_BIT; operandType <<= 1)  {
+    if (operandType & operandTypes) {
+      switch (op_code)  {
+        case UNARY_PLUS_OPR8R_OPCODE :
+          if (operandType & INTEGER_DATA_TYPES)
+            resultTypes |= operandType;
+          break;
+        case UNARY_MINUS_OPR8R_OPCODE :
+          if (operandType & INTEGER_DATA_TYPES)
+            resultTypes |= SIGNED_DATA_TYPE;
+          else if (operandType == DOUBLE_DATA_TYPE)
+            resultTypes |= DOUBLE_DATA_TYPE;
+          break;
+        case LOGICAL_NOT_OPR8R_OPCODE :
+          if (operandType == BOOL_DATA_TYPE)
+            resultTypes |= BOOL_DATA_TYPE;
+          else if (operandType & NUMERIC_DATA_TYPES)
+            resultTypes |= UNSIGNED_DATA_TYPE;
+          break;
+        case BITWISE_NOT_OPR8R_OPCODE :
+          if (operandType == UNSIGNED_DATA_TYPE)
+            resultTypes |= UNSIGNED_DATA_TYPE;
+          break;
+        default:
+          break;
+      }
+    }
+  }
+
+  return resultTypes;
+}
+
+/* ****************************************************************************
+ * Union of the results of every possible pairing of operand data types.  Zero
+ * means none of the pairings can succeed.
+ * ***************************************************************************/
+uint8_t TypeChecker::binaryResultTypes (uint8_t op_code, uint8_t _1stTypes, uint8_t _2ndTypes) {
+  uint8_t resultTypes = 0;
+
+  for (int _1stType = 0x1; _1stType <= LAST_DATA_TYPE_BIT; _1stType <<= 1)  {
+    for (int _2ndType = 0x1; _2ndType <= LAST_DATA_TYPE_BIT && (_1stType & _1stTypes); _2ndType <<= 1)  {
+      if (_2ndType & _2ndTypes)
+        resultTypes |= binaryPairResult (op_code, _1stType, _2ndType);
+    }
+  }
+
+  return resultTypes;
+}
+
+/* ****************************************************************************
+ * Mirrors RunTimeInterpreter::execStandardMath, execShift, execBitWiseOp and
+ * execEquivalenceOp|Token::compare for a single pair of operand data types
+ * ***************************************************************************/
+uint8_t TypeChecker::binaryPairResult (uint8_t op_code, uint8_t _1stType, uint8_t _2ndType)  {
+  uint8_t resultTypes = 0;
+  bool isBothInts = (_1stType & INTEGER_DATA_TYPES) && (_2ndType & INTEGER_DATA_TYPES);
+  bool isBothNumeric = (_1stType & NUMERIC_DATA_TYPES) && (_2ndType & NUMERIC_DATA_TYPES);
+
+  switch (op_code)  {
+    case BINARY_PLUS_OPR8R_OPCODE :
+      if (_1stType == STRING_DATA_TYPE && _2ndType == STRING_DATA_TYPE)  {
+        resultTypes = STRING_DATA_TYPE;
+        break;
+      }
+      // Fall through to the numeric case
+    case MULTIPLY_OPR8R_OPCODE :
+    case DIV_OPR8R_OPCODE :
+    case BINARY_MINUS_OPR8R_OPCODE :
+      if (!isBothNumeric)
+        resultTypes = 0;
+      else if (_1stType == DOUBLE_DATA_TYPE || _2ndType == DOUBLE_DATA_TYPE)
+        resultTypes = DOUBLE_DATA_TYPE;
+      else if (_1stType == UNSIGNED_DATA_TYPE && _2ndType == UNSIGNED_DATA_TYPE)
+        resultTypes = UNSIGNED_DATA_TYPE;
+      else if (op_code != DIV_OPR8R_OPCODE)
+        resultTypes = SIGNED_DATA_TYPE;
+      else if (_1stType == SIGNED_DATA_TYPE)
+        // Signed division that doesn't come out even becomes a double
+        resultTypes = SIGNED_DATA_TYPE | DOUBLE_DATA_TYPE;
+      else
+        resultTypes = DOUBLE_DATA_TYPE;
+      break;
+    case MOD_OPR8R_OPCODE :
+      if (isBothInts)
+        resultTypes = (_1stType == UNSIGNED_DATA_TYPE && _2ndType == UNSIGNED_DATA_TYPE) ? UNSIGNED_DATA_TYPE : SIGNED_DATA_TYPE;
+      break;
+    case LEFT_SHIFT_OPR8R_OPCODE :
+    case RIGHT_SHIFT_OPR8R_OPCODE :
+      // Shifting a negative # keeps it signed
+      if (isBothInts)
+        resultTypes = (_1stType == UNSIGNED_DATA_TYPE) ? UNSIGNED_DATA_TYPE : (UNSIGNED_DATA_TYPE | SIGNED_DATA_TYPE);
+      break;
+    case BITWISE_AND_OPR8R_OPCODE :
+    case BITWISE_XOR_OPR8R_OPCODE :
+    case BITWISE_OR_OPR8R_OPCODE :
+      if (isBothInts)
+        resultTypes = UNSIGNED_DATA_TYPE;
+      break;
+    case LESS_THAN_OPR8R_OPCODE :
+    case LESS_EQUALS_OPR8R8_OPCODE :
+    case GREATER_THAN_OPR8R_OPCODE :
+    case GREATER_EQUALS_OPR8R8_OPCODE :
+    case EQUALITY_OPR8R_OPCODE :
+    case NOT_EQUALS_OPR8R_OPCODE :
+      if (_1stType == BOOL_DATA_TYPE || _2ndType == BOOL_DATA_TYPE) {
+        // BOOLs can only be tested for [in]equality against each other
+        if (_1stType == _2ndType && (op_code == EQUALITY_OPR8R_OPCODE || op_code == NOT_EQUALS_OPR8R_OPCODE))
+          resultTypes = UNSIGNED_DATA_TYPE;
+
+      } else if (isBothNumeric || (_1stType == _2ndType && _1stType != VOID_DATA_TYPE))  {
+        resultTypes = UNSIGNED_DATA_TYPE;
+      }
+      break;
+    default:
+      break;
+  }
+
+  return resultTypes;
+}
+
+/* ****************************************************************************
+ * Mirrors Token::convertTo; would a value of srcType be accepted by a variable
+ * of targetType?
+ * ***************************************************************************/
+bool TypeChecker::isConvertible (uint8_t targetType, uint8_t srcType) {
+  bool isOk = false;
+
+  if (targetType == srcType)  {
+    isOk = true;
+
+  } else  {
+    switch (targetType) {
+      case UNSIGNED_DATA_TYPE :
+      case SIGNED_DATA_TYPE :
+        isOk = (srcType & (INTEGER_DATA_TYPES | BOOL_DATA_TYPE));
+        break;
+      case BOOL_DATA_TYPE :
+        isOk = (srcType == UNSIGNED_DATA_TYPE);
+        break;
+      case DOUBLE_DATA_TYPE :
+        isOk = (srcType == UNSIGNED_DATA_TYPE || srcType == BOOL_DATA_TYPE);
+        break;
+      default:
+        break;
+    }
+  }
+
+  return isOk;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+void TypeChecker::logOpr8rMismatch (std::shared_ptr<ExprTreeNode> opr8rNode, uint8_t op_code, std::wstring operandDescr)  {
+
+  userMessages->logMsg (USER_ERROR, L"OPR8R [" + execTerms.getSrcOpr8rStrFor (op_code) + L"] cannot be applied to " + operandDescr
+    , userSrcFileName, opr8rNode->originalTkn->get_line_number(), opr8rNode->originalTkn->get_column_pos());
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+uint8_t TypeChecker::getDataTypeMask (TokenTypeEnum tkn_type) {
+  uint8_t dataType = 0;
+
+  switch (tkn_type) {
+    case UINT8_TKN :
+    case UINT16_TKN :
+    case UINT32_TKN :
+    case UINT64_TKN :
+      dataType = UNSIGNED_DATA_TYPE;
+      break;
+    case INT8_TKN :
+    case INT16_TKN :
+    case INT32_TKN :
+    case INT64_TKN :
+      dataType = SIGNED_DATA_TYPE;
+      break;
+    case DOUBLE_TKN :
+      dataType = DOUBLE_DATA_TYPE;
+      break;
+    case STRING_TKN :
+      dataType = STRING_DATA_TYPE;
+      break;
+    case DATETIME_TKN :
+      dataType = DATETIME_DATA_TYPE;
+      break;
+    case BOOL_TKN :
+      dataType = BOOL_DATA_TYPE;
+      break;
+    case VOID_TKN :
+      dataType = VOID_DATA_TYPE;
+      break;
+    default:
+      break;
+  }
+
+  return dataType;
+}
+
+/* ****************************************************************************
+ * e.g. [unsigned integer|double]
+ * ***************************************************************************/
+std::wstring TypeChecker::getDataTypesDescr (uint8_t dataTypes) {
+  std::wstring descr;
+  static const std::pair<uint8_t, std::wstring> typeNames [] = {
+    {UNSIGNED_DATA_TYPE, L"unsigned integer"}
+    ,{SIGNED_DATA_TYPE, L"signed integer"}
+    ,{DOUBLE_DATA_TYPE, L"double"}
+    ,{STRING_DATA_TYPE, L"string"}
+    ,{DATETIME_DATA_TYPE, L"datetime"}
+    ,{BOOL_DATA_TYPE, L"bool"}
+    ,{VOID_DATA_TYPE, L"void"}
+  };
+
+  for (auto & typeName : typeNames) {
+    if (typeName.first & dataTypes)  {
+      if (!descr.empty())
+        descr.append (L"|");
+      descr.append (typeName.second);
+    }
+  }
+
+  return (L"[" + descr + L"]");
+}
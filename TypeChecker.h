@@ -0,0 +1,82 @@
+/*
+ * TypeChecker.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ */
+
+#ifndef TYPECHECKER_H_
+#define TYPECHECKER_H_
+
+#include <string>
+#include <memory>
+#include <cstdint>
+#include "CompileExecTerms.h"
+#include "ExprTreeNode.h"
+#include "Token.h"
+#include "Utilities.h"
+#include "StackOfScopes.h"
+#include "UserMessages.h"
+
+// Data type categories an expression could resolve to, OR'd together into a mask.
+// Integer widths and even the [/] result type depend on the operand *values*, so
+// the checker works with categories rather than exact TokenTypeEnums
+#define UNSIGNED_DATA_TYPE    0x1
+#define SIGNED_DATA_TYPE      0x2
+#define DOUBLE_DATA_TYPE      0x4
+#define STRING_DATA_TYPE      0x8
+#define DATETIME_DATA_TYPE    0x10
+#define BOOL_DATA_TYPE        0x20
+#define VOID_DATA_TYPE        0x40
+#define INTEGER_DATA_TYPES    (UNSIGNED_DATA_TYPE | SIGNED_DATA_TYPE)
+#define NUMERIC_DATA_TYPES    (INTEGER_DATA_TYPES | DOUBLE_DATA_TYPE)
+#define LAST_DATA_TYPE_BIT    VOID_DATA_TYPE
+
+class TypeChecker {
+public:
+  TypeChecker(const CompileExecTerms & inExecTerms, std::shared_ptr<StackOfScopes> inVarScopeStack
+    , std::wstring userSrcFileName, std::shared_ptr<UserMessages> userMessages);
+  virtual ~TypeChecker();
+
+  int checkExprTree (std::shared_ptr<ExprTreeNode> rootOfExpr, uint8_t & resultTypes);
+  int checkVarInitExpr (std::wstring varName, std::shared_ptr<ExprTreeNode> rootOfExpr);
+  int checkSystemCall (std::shared_ptr<ExprTreeNode> sysCallNode, uint8_t & resultTypes);
+
+  static uint8_t getDataTypeMask (TokenTypeEnum tkn_type);
+  static std::wstring getDataTypesDescr (uint8_t dataTypes);
+
+private:
+  const CompileExecTerms & execTerms;
+  std::shared_ptr<StackOfScopes> scopedNameSpace;
+  std::wstring userSrcFileName;
+  std::shared_ptr<UserMessages> userMessages;
+  std::wstring thisSrcFile;
+  Utilities util;
+  int failed_on_src_line;
+
+  int checkNode (std::shared_ptr<ExprTreeNode> currNode, uint8_t & resultTypes);
+  int checkOperand (std::shared_ptr<ExprTreeNode> operandNode, bool isCheckInit, uint8_t & operandTypes, std::wstring & varName);
+  int checkOperandPair (std::shared_ptr<ExprTreeNode> opr8rNode, bool isCheck1stInit, uint8_t & _1stTypes, std::wstring & _1stVarName
+    , uint8_t & _2ndTypes);
+  int checkAssignment (std::shared_ptr<ExprTreeNode> opr8rNode, uint8_t op_code, uint8_t & resultTypes);
+  int checkPrePostFix (std::shared_ptr<ExprTreeNode> opr8rNode, uint8_t op_code, uint8_t & resultTypes);
+  int checkArrayElement (std::shared_ptr<ExprTreeNode> opr8rNode, uint8_t & resultTypes);
+  int checkArrayParam (std::shared_ptr<ExprTreeNode> sysCallNode, int paramIdx, uint8_t paramType, TokenTypeEnum & elementType);
+  int checkUnary (std::shared_ptr<ExprTreeNode> opr8rNode, uint8_t op_code, uint8_t & resultTypes);
+  int checkBinary (std::shared_ptr<ExprTreeNode> opr8rNode, uint8_t op_code, uint8_t & resultTypes);
+  int checkShortCircuit (std::shared_ptr<ExprTreeNode> opr8rNode, uint8_t op_code, uint8_t & resultTypes);
+  int checkConversion (std::wstring varName, uint8_t srcTypes, std::shared_ptr<Token> errorTkn);
+  int markVarInitialized (std::wstring varName);
+
+  bool isOpr8rNode (std::shared_ptr<ExprTreeNode> currNode, uint8_t & op_code);
+  bool isLeafNode (std::shared_ptr<ExprTreeNode> currNode);
+  bool isArrayElement (std::shared_ptr<ExprTreeNode> currNode, std::wstring & arrayName);
+  uint8_t unaryResultTypes (uint8_t op_code, uint8_t operandTypes);
+  uint8_t binaryResultTypes (uint8_t op_code, uint8_t _1stTypes, uint8_t _2ndTypes);
+  uint8_t binaryPairResult (uint8_t op_code, uint8_t _1stType, uint8_t _2ndType);
+  bool isConvertible (uint8_t targetType, uint8_t srcType);
+  void logOpr8rMismatch (std::shared_ptr<ExprTreeNode> opr8rNode, uint8_t op_code, std::wstring operandDescr);
+
+};
+
+#endif /* TYPECHECKER_H_ */
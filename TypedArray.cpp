@@ -0,0 +1,465 @@
+/*
+ * TypedArray.cpp
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ *
+ * Fixed size array of one of the valid data types.  Numbers and bools are
+ * packed into a single buffer at their native width (an int32 array really is
+ * an int32_t[]), rather than a Token per element, so the whole-array system
+ * calls come down to tight loops over a plain C array that the C++ compiler
+ * is free to vectorize.  STRING and DATETIME elements are InternedStrings.
+ *
+ * Storing a value converts it the same way assigning to a variable of the
+ * element's data type would, and then it gets cut down to the element's width.
+ */
+
+#include "TypedArray.h"
+#include <algorithm>
+#include <cstring>
+#include "common.h"
+
+/* ****************************************************************************
+ * Integer sums & dot products wrap around the same way the integer OPR8Rs do;
+ * a signed element converts to a uint64_t with its sign extended, so the bits
+ * come out right for either signedness
+ * ***************************************************************************/
+template <typename T> static uint64_t sumIntegers (const T * elements, uint64_t count)  {
+  uint64_t total = 0;
+
+  for (uint64_t idx = 0; idx < count; idx++)
+    total += (uint64_t) elements[idx];
+
+  return total;
+}
+
+template <typename T> static uint64_t dotIntegers (const T * elements1, const T * elements2, uint64_t count)  {
+  uint64_t total = 0;
+
+  for (uint64_t idx = 0; idx < count; idx++)
+    total += (uint64_t) elements1[idx] * (uint64_t) elements2[idx];
+
+  return total;
+}
+
+/* ****************************************************************************
+ * Kept to a branch-free compare per element, so it can be done a vector at a
+ * time
+ * ***************************************************************************/
+template <typename T> static T minOrMaxNative (const T * elements, uint64_t count, bool isMin)  {
+  T result = elements[0];
+
+  if (isMin)  {
+    for (uint64_t idx = 1; idx < count; idx++)
+      result = (elements[idx] < result ? elements[idx] : result);
+
+  } else  {
+    for (uint64_t idx = 1; idx < count; idx++)
+      result = (elements[idx] > result ? elements[idx] : result);
+  }
+
+  return result;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+TypedArray::TypedArray(TokenTypeEnum inElementType, uint64_t inNumElements) {
+  element_type = inElementType;
+  num_elements = inNumElements;
+
+  switch (element_type) {
+    case BOOL_TKN :
+    case UINT8_TKN :
+    case INT8_TKN :
+      element_size = sizeof (uint8_t);
+      break;
+    case UINT16_TKN :
+    case INT16_TKN :
+      element_size = sizeof (uint16_t);
+      break;
+    case UINT32_TKN :
+    case INT32_TKN :
+      element_size = sizeof (uint32_t);
+      break;
+    case UINT64_TKN :
+    case INT64_TKN :
+      element_size = sizeof (uint64_t);
+      break;
+    case DOUBLE_TKN :
+      element_size = sizeof (double);
+      break;
+    default:
+      element_size = 0;
+      break;
+  }
+
+  if (element_size > 0)
+    // Value-initialized, so every element starts out as 0
+    raw_elements = std::make_unique<uint8_t[]> (num_elements * element_size);
+  else
+    string_elements.resize (num_elements);
+}
+
+TypedArray::~TypedArray() {
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+bool TypedArray::isValidElementType (TokenTypeEnum elementType)  {
+  return (elementType == BOOL_TKN || elementType == STRING_TKN || elementType == DATETIME_TKN || elementType == DOUBLE_TKN
+    || (elementType >= UINT8_TKN && elementType <= INT64_TKN));
+}
+
+/* ****************************************************************************
+ * A scope that gets reopened can reuse the array its declaration made the last
+ * time around if it's the same shape
+ * ***************************************************************************/
+bool TypedArray::isSameShape (TokenTypeEnum elementType, uint64_t numElements) const  {
+  return (element_type == elementType && num_elements == numElements);
+}
+
+/* ****************************************************************************
+ * Back to how a newly declared array looks
+ * ***************************************************************************/
+void TypedArray::clear ()  {
+  if (element_size > 0)
+    memset (raw_elements.get(), 0, num_elements * element_size);
+  else
+    std::fill (string_elements.begin(), string_elements.end(), InternedString());
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+void TypedArray::getElement (uint64_t idx, Token & elementTkn) const  {
+  elementTkn.resetTokenExceptSrc();
+  elementTkn.tkn_type = element_type;
+
+  switch (element_type) {
+    case BOOL_TKN :
+    case UINT8_TKN :
+      elementTkn._unsigned = elements<uint8_t>()[idx];
+      break;
+    case UINT16_TKN :
+      elementTkn._unsigned = elements<uint16_t>()[idx];
+      break;
+    case UINT32_TKN :
+      elementTkn._unsigned = elements<uint32_t>()[idx];
+      break;
+    case UINT64_TKN :
+      elementTkn._unsigned = elements<uint64_t>()[idx];
+      break;
+    case INT8_TKN :
+      elementTkn._signed = elements<int8_t>()[idx];
+      break;
+    case INT16_TKN :
+      elementTkn._signed = elements<int16_t>()[idx];
+      break;
+    case INT32_TKN :
+      elementTkn._signed = elements<int32_t>()[idx];
+      break;
+    case INT64_TKN :
+      elementTkn._signed = elements<int64_t>()[idx];
+      break;
+    case DOUBLE_TKN :
+      elementTkn._double = elements<double>()[idx];
+      break;
+    default:
+      elementTkn._string = string_elements[idx];
+      break;
+  }
+
+  elementTkn.isInitialized = true;
+}
+
+/* ****************************************************************************
+ *
+ * ***************************************************************************/
+int TypedArray::setElement (uint64_t idx, const Token & newValTkn, const std::wstring & arrayName, std::wstring & errorMsg)  {
+  int ret_code = GENERAL_FAILURE;
+  Token convertedTkn;
+
+  if (OK == convertElement (newValTkn, arrayName, convertedTkn, errorMsg))  {
+    storeElement (idx, convertedTkn);
+    ret_code = OK;
+  }
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ * The fill value only gets converted once
+ * ***************************************************************************/
+int TypedArray::fill (const Token & fillTkn, const std::wstring & arrayName, std::wstring & errorMsg)  {
+  int ret_code = GENERAL_FAILURE;
+  Token convertedTkn;
+
+  if (OK == convertElement (fillTkn, arrayName, convertedTkn, errorMsg))  {
+    ret_code = OK;
+
+    switch (element_type) {
+      case BOOL_TKN :
+      case UINT8_TKN :
+      case INT8_TKN :
+        // Signed values get stored by their bits
+        std::fill_n (elements<uint8_t>(), num_elements, (uint8_t) (element_type == INT8_TKN ? convertedTkn._signed : convertedTkn._unsigned));
+        break;
+      case UINT16_TKN :
+        std::fill_n (elements<uint16_t>(), num_elements, (uint16_t) convertedTkn._unsigned);
+        break;
+      case UINT32_TKN :
+        std::fill_n (elements<uint32_t>(), num_elements, (uint32_t) convertedTkn._unsigned);
+        break;
+      case UINT64_TKN :
+        std::fill_n (elements<uint64_t>(), num_elements, convertedTkn._unsigned);
+        break;
+      case INT16_TKN :
+        std::fill_n (elements<int16_t>(), num_elements, (int16_t) convertedTkn._signed);
+        break;
+      case INT32_TKN :
+        std::fill_n (elements<int32_t>(), num_elements, (int32_t) convertedTkn._signed);
+        break;
+      case INT64_TKN :
+        std::fill_n (elements<int64_t>(), num_elements, convertedTkn._signed);
+        break;
+      case DOUBLE_TKN :
+        std::fill_n (elements<double>(), num_elements, convertedTkn._double);
+        break;
+      default:
+        std::fill (string_elements.begin(), string_elements.end(), convertedTkn._string);
+        break;
+    }
+  }
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ * Arrays of the same element type only; copies as many elements as both
+ * arrays have and returns that count
+ * ***************************************************************************/
+uint64_t TypedArray::copyFrom (const TypedArray & srcArray)  {
+  uint64_t num_copied = std::min (num_elements, srcArray.num_elements);
+
+  if (srcArray.element_type != element_type)  {
+    num_copied = 0;
+
+  } else if (&srcArray == this)  {
+    // Nothing to move
+
+  } else if (element_size > 0)  {
+    memcpy (raw_elements.get(), srcArray.raw_elements.get(), num_copied * element_size);
+
+  } else  {
+    std::copy_n (srcArray.string_elements.begin(), num_copied, string_elements.begin());
+  }
+
+  return (num_copied);
+}
+
+/* ****************************************************************************
+ * Integer arrays sum up to an int64|uint64; DOUBLE arrays to a double
+ * ***************************************************************************/
+int TypedArray::sum (Token & sumTkn) const  {
+  int ret_code = OK;
+
+  switch (element_type) {
+    case UINT8_TKN :
+      sumTkn.resetToUnsigned (sumIntegers (elements<uint8_t>(), num_elements));
+      break;
+    case UINT16_TKN :
+      sumTkn.resetToUnsigned (sumIntegers (elements<uint16_t>(), num_elements));
+      break;
+    case UINT32_TKN :
+      sumTkn.resetToUnsigned (sumIntegers (elements<uint32_t>(), num_elements));
+      break;
+    case UINT64_TKN :
+      sumTkn.resetToUnsigned (sumIntegers (elements<uint64_t>(), num_elements));
+      break;
+    case INT8_TKN :
+      sumTkn.resetToSigned ((int64_t) sumIntegers (elements<int8_t>(), num_elements));
+      break;
+    case INT16_TKN :
+      sumTkn.resetToSigned ((int64_t) sumIntegers (elements<int16_t>(), num_elements));
+      break;
+    case INT32_TKN :
+      sumTkn.resetToSigned ((int64_t) sumIntegers (elements<int32_t>(), num_elements));
+      break;
+    case INT64_TKN :
+      sumTkn.resetToSigned ((int64_t) sumIntegers (elements<int64_t>(), num_elements));
+      break;
+    case DOUBLE_TKN :
+      {
+        const double * doubles = elements<double>();
+        double total = 0.0;
+        for (uint64_t idx = 0; idx < num_elements; idx++)
+          total += doubles[idx];
+        sumTkn.resetToDouble (total);
+      }
+      break;
+    default:
+      ret_code = GENERAL_FAILURE;
+      break;
+  }
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ * Result has the same data type as the elements
+ * ***************************************************************************/
+int TypedArray::minOrMax (bool isMin, Token & resultTkn) const  {
+  int ret_code = OK;
+
+  resultTkn.resetTokenExceptSrc();
+  resultTkn.tkn_type = element_type;
+
+  switch (element_type) {
+    case UINT8_TKN :
+      resultTkn._unsigned = minOrMaxNative (elements<uint8_t>(), num_elements, isMin);
+      break;
+    case UINT16_TKN :
+      resultTkn._unsigned = minOrMaxNative (elements<uint16_t>(), num_elements, isMin);
+      break;
+    case UINT32_TKN :
+      resultTkn._unsigned = minOrMaxNative (elements<uint32_t>(), num_elements, isMin);
+      break;
+    case UINT64_TKN :
+      resultTkn._unsigned = minOrMaxNative (elements<uint64_t>(), num_elements, isMin);
+      break;
+    case INT8_TKN :
+      resultTkn._signed = minOrMaxNative (elements<int8_t>(), num_elements, isMin);
+      break;
+    case INT16_TKN :
+      resultTkn._signed = minOrMaxNative (elements<int16_t>(), num_elements, isMin);
+      break;
+    case INT32_TKN :
+      resultTkn._signed = minOrMaxNative (elements<int32_t>(), num_elements, isMin);
+      break;
+    case INT64_TKN :
+      resultTkn._signed = minOrMaxNative (elements<int64_t>(), num_elements, isMin);
+      break;
+    case DOUBLE_TKN :
+      resultTkn._double = minOrMaxNative (elements<double>(), num_elements, isMin);
+      break;
+    default:
+      ret_code = GENERAL_FAILURE;
+      break;
+  }
+
+  resultTkn.isInitialized = (OK == ret_code);
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ * Arrays of the same element type only; covers as many elements as both
+ * arrays have
+ * ***************************************************************************/
+int TypedArray::dot (const TypedArray & otherArray, Token & dotTkn) const  {
+  int ret_code = GENERAL_FAILURE;
+  uint64_t count = std::min (num_elements, otherArray.num_elements);
+
+  if (otherArray.element_type == element_type)  {
+    ret_code = OK;
+
+    switch (element_type) {
+      case UINT8_TKN :
+        dotTkn.resetToUnsigned (dotIntegers (elements<uint8_t>(), otherArray.elements<uint8_t>(), count));
+        break;
+      case UINT16_TKN :
+        dotTkn.resetToUnsigned (dotIntegers (elements<uint16_t>(), otherArray.elements<uint16_t>(), count));
+        break;
+      case UINT32_TKN :
+        dotTkn.resetToUnsigned (dotIntegers (elements<uint32_t>(), otherArray.elements<uint32_t>(), count));
+        break;
+      case UINT64_TKN :
+        dotTkn.resetToUnsigned (dotIntegers (elements<uint64_t>(), otherArray.elements<uint64_t>(), count));
+        break;
+      case INT8_TKN :
+        dotTkn.resetToSigned ((int64_t) dotIntegers (elements<int8_t>(), otherArray.elements<int8_t>(), count));
+        break;
+      case INT16_TKN :
+        dotTkn.resetToSigned ((int64_t) dotIntegers (elements<int16_t>(), otherArray.elements<int16_t>(), count));
+        break;
+      case INT32_TKN :
+        dotTkn.resetToSigned ((int64_t) dotIntegers (elements<int32_t>(), otherArray.elements<int32_t>(), count));
+        break;
+      case INT64_TKN :
+        dotTkn.resetToSigned ((int64_t) dotIntegers (elements<int64_t>(), otherArray.elements<int64_t>(), count));
+        break;
+      case DOUBLE_TKN :
+        {
+          const double * doubles1 = elements<double>();
+          const double * doubles2 = otherArray.elements<double>();
+          double total = 0.0;
+          for (uint64_t idx = 0; idx < count; idx++)
+            total += doubles1[idx] * doubles2[idx];
+          dotTkn.resetToDouble (total);
+        }
+        break;
+      default:
+        ret_code = GENERAL_FAILURE;
+        break;
+    }
+  }
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ * Same conversion rules as assigning to a variable of the element's data type
+ * ***************************************************************************/
+int TypedArray::convertElement (const Token & newValTkn, const std::wstring & arrayName, Token & convertedTkn, std::wstring & errorMsg)  {
+  int ret_code = GENERAL_FAILURE;
+
+  convertedTkn.resetToken();
+  convertedTkn.tkn_type = element_type;
+
+  if (OK == convertedTkn.convertTo (newValTkn, arrayName, errorMsg))
+    ret_code = OK;
+
+  return (ret_code);
+}
+
+/* ****************************************************************************
+ * Anything too big for the element's width gets cut down to it
+ * ***************************************************************************/
+void TypedArray::storeElement (uint64_t idx, const Token & convertedTkn)  {
+
+  switch (element_type) {
+    case BOOL_TKN :
+    case UINT8_TKN :
+      elements<uint8_t>()[idx] = (uint8_t) convertedTkn._unsigned;
+      break;
+    case UINT16_TKN :
+      elements<uint16_t>()[idx] = (uint16_t) convertedTkn._unsigned;
+      break;
+    case UINT32_TKN :
+      elements<uint32_t>()[idx] = (uint32_t) convertedTkn._unsigned;
+      break;
+    case UINT64_TKN :
+      elements<uint64_t>()[idx] = convertedTkn._unsigned;
+      break;
+    case INT8_TKN :
+      elements<int8_t>()[idx] = (int8_t) convertedTkn._signed;
+      break;
+    case INT16_TKN :
+      elements<int16_t>()[idx] = (int16_t) convertedTkn._signed;
+      break;
+    case INT32_TKN :
+      elements<int32_t>()[idx] = (int32_t) convertedTkn._signed;
+      break;
+    case INT64_TKN :
+      elements<int64_t>()[idx] = convertedTkn._signed;
+      break;
+    case DOUBLE_TKN :
+      elements<double>()[idx] = convertedTkn._double;
+      break;
+    default:
+      string_elements[idx] = convertedTkn._string;
+      break;
+  }
+}
@@ -0,0 +1,53 @@
+/*
+ * TypedArray.h
+ *
+ *  Created on: Oct 18, 2026
+ *      Author: Mike Volk
+ */
+
+#ifndef TYPEDARRAY_H_
+#define TYPEDARRAY_H_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Token.h"
+#include "InternedString.h"
+
+class TypedArray {
+public:
+  TypedArray(TokenTypeEnum inElementType, uint64_t inNumElements);
+  virtual ~TypedArray();
+
+  static bool isValidElementType (TokenTypeEnum elementType);
+
+  TokenTypeEnum getElementType () const   { return element_type; }
+  uint64_t size () const                  { return num_elements; }
+  bool isSameShape (TokenTypeEnum elementType, uint64_t numElements) const;
+  void clear ();
+
+  // Callers have already bounds checked idx
+  void getElement (uint64_t idx, Token & elementTkn) const;
+  int setElement (uint64_t idx, const Token & newValTkn, const std::wstring & arrayName, std::wstring & errorMsg);
+
+  int fill (const Token & fillTkn, const std::wstring & arrayName, std::wstring & errorMsg);
+  uint64_t copyFrom (const TypedArray & srcArray);
+  int sum (Token & sumTkn) const;
+  int minOrMax (bool isMin, Token & resultTkn) const;
+  int dot (const TypedArray & otherArray, Token & dotTkn) const;
+
+private:
+  TokenTypeEnum element_type;
+  uint64_t num_elements;
+  size_t element_size;
+  std::unique_ptr<uint8_t[]> raw_elements;                      // Numbers and bools, packed at their native width
+  std::vector<InternedString> string_elements;                  // STRING and DATETIME elements
+
+  int convertElement (const Token & newValTkn, const std::wstring & arrayName, Token & convertedTkn, std::wstring & errorMsg);
+  void storeElement (uint64_t idx, const Token & convertedTkn);
+
+  template <typename T> T * elements () const  { return reinterpret_cast<T *> (raw_elements.get()); }
+};
+
+#endif /* TYPEDARRAY_H_ */
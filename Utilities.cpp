@@ -9,6 +9,7 @@
 #include "Utilities.h"
 #include "Token.h"
 #include "common.h"
+#include "OpCodes.h"
 #include "locale_strings.h"
 #include <cctype>
 #include <cwctype>
@@ -153,3 +154,68 @@ std::wstring Utilities::getTokenListStr (std::vector<Token> & tokenStream, int c
 
   return (tknStrmStr);
 }
+
+/* ****************************************************************************
+ * Integer that's small enough for calcLoopTripCount to do exact math with
+ * ***************************************************************************/
+bool Utilities::getCountedLoopValue (Token & valueTkn, int64_t & value) {
+  bool isOK = false;
+
+  if (valueTkn.isUnsigned() && valueTkn._unsigned <= MAX_COUNTED_LOOP_MAGNITUDE)  {
+    value = valueTkn._unsigned;
+    isOK = true;
+
+  } else if (valueTkn.isSigned() && valueTkn._signed <= (int64_t)MAX_COUNTED_LOOP_MAGNITUDE
+    && valueTkn._signed >= -(int64_t)MAX_COUNTED_LOOP_MAGNITUDE)  {
+    value = valueTkn._signed;
+    isOK = true;
+  }
+
+  return isOK;
+}
+
+/* ****************************************************************************
+ * How many times [var cmpOpCode limit] comes back TRUE when var starts out at
+ * start and moves by step after every trip. FALSE if the loop wouldn't end.
+ * ***************************************************************************/
+bool Utilities::calcLoopTripCount (uint8_t cmpOpCode, int64_t start, int64_t limit, int64_t step, int64_t & numTrips) {
+  bool isEnding = false;
+  numTrips = 0;
+
+  switch (cmpOpCode)  {
+    case LESS_THAN_OPR8R_OPCODE:
+      isEnding = (start >= limit || step > 0);
+      if (start < limit && step > 0)
+        numTrips = (limit - start + step - 1) / step;
+      break;
+
+    case LESS_EQUALS_OPR8R8_OPCODE:
+      isEnding = (start > limit || step > 0);
+      if (start <= limit && step > 0)
+        numTrips = (limit - start) / step + 1;
+      break;
+
+    case GREATER_THAN_OPR8R_OPCODE:
+      isEnding = (start <= limit || step < 0);
+      if (start > limit && step < 0)
+        numTrips = (start - limit - step - 1) / -step;
+      break;
+
+    case GREATER_EQUALS_OPR8R8_OPCODE:
+      isEnding = (start < limit || step < 0);
+      if (start >= limit && step < 0)
+        numTrips = (start - limit) / -step + 1;
+      break;
+
+    case NOT_EQUALS_OPR8R_OPCODE:
+      isEnding = (step != 0 && (limit - start) % step == 0 && (limit - start) / step >= 0);
+      if (isEnding)
+        numTrips = (limit - start) / step;
+      break;
+
+    default:
+      break;
+  }
+
+  return isEnding;
+}
@@ -9,8 +9,12 @@
 #define UTILITIES_H_
 
 #include <string>
+#include <cstdint>
 #include "Token.h"
 
+// Induction variable, limit & step of a counted [for] loop have to be this small or smaller to keep the trip count math exact
+#define MAX_COUNTED_LOOP_MAGNITUDE  0x10000000000
+
 class Utilities {
 public:
   Utilities();
@@ -21,6 +25,8 @@ public:
   std::wstring trim (std::wstring inStr);
   void splitString (std::wstring inStr, std::wstring spr8r, std::vector<std::wstring> & strVector);
   std::wstring getTokenListStr (std::vector<Token> & tokenStream, int caretTgtIdx, int & caretPos);
+  bool getCountedLoopValue (Token & valueTkn, int64_t & value);
+  bool calcLoopTripCount (uint8_t cmpOpCode, int64_t start, int64_t limit, int64_t step, int64_t & numTrips);
 };
 
 #endif /* UTILITIES_H_ */
@@ -105,6 +105,22 @@ enum log_level_enum {
 
 typedef log_level_enum logLvlEnum;
 
+// Selects how ExpressionParser turns a closed expression scope into a tree
+enum expr_parser_enum {
+  PRECEDENCE_LVL_PARSER
+  ,PRATT_PARSER
+};
+
+typedef expr_parser_enum exprParserEnum;
+
+// Compile time optimizations GeneralParser applies before writing out to the interpreted file
+enum optimize_lvl_enum {
+  NO_OPTIMIZATION
+  ,FULL_OPTIMIZATION
+};
+
+typedef optimize_lvl_enum optimizeLvlEnum;
+
 
 #endif
 
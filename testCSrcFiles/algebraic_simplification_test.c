@@ -0,0 +1,39 @@
+// OPR8Rs that can't change their operand get dropped, and multiply|divide|modulo by a power of 2
+// become shifts and masks where the data types allow it. Run with "-O NONE" to check the results
+// don't change
+
+uint32 count = 100, zero = 0;
+int32 negative = -100;
+double ratio = -5 / 2;
+bool is_set = true;
+
+// Identities
+uint32 count_100 = count * 0x1 + 0x0;
+int32 signed_100 = count * 1 + 0;
+int32 negative_m100 = 1 * negative - 0;
+double ratio_m2_5 = ratio * 1 / 1;
+uint32 bits_100 = ((count | 0) ^ 0) << 0 >> 0;
+bool not_not_true = !(!is_set);
+uint8 not_not_count_1 = !(!count);
+
+// Strength reduction. Decimal literals are signed, and signed math results in a signed (or a
+// DOUBLE for [/]) that a shift or mask wouldn't, so only unsigned values get shifted & masked
+uint32 times_8_800 = count * 0x8;
+uint32 times_8_left_800 = (1 << 3) * count;
+uint32 div_8_12 = count / 0x8;
+uint32 mod_8_4 = count % 0x8;
+uint32 mod_1_0 = count % 0x1;
+int64 signed_times_8_800 = count * 8;
+uint64 times_2_200 = count * 2;
+int32 times_2_m200 = negative * 2;
+double times_2_m5_0 = 2 * ratio;
+
+// A signed [/] that doesn't come out even becomes a DOUBLE, so it has to stay a [/]
+double signed_div_m12_5 = negative / 8;
+int32 signed_mod_m4 = negative % 8;
+
+// [x * 1] isn't the same data type width as [x], which [~] would notice
+uint32 not_mask = ~(count * 0x1);
+uint8 not_small = ~(zero | 0);
+
+print_line ("Simplified: " + str(count * 0x1) + " " + str(count * 0x4) + " " + str(count % 0x10) + " " + str(!(!is_set)));
@@ -0,0 +1,72 @@
+// Arrays are 1 dimension, with a fixed # of elements of a single data type,
+// packed at their native width.  Elements get read & written 1 at a time, and
+// whole arrays get passed by name to the array_ system calls.
+// Run with "-O NONE" to check the results don't change.
+
+int32 squares[6];
+double weights[4];
+double ones[4];
+uint8 bytes[3];
+string words[3];
+int32 idx;
+int32 other[3];
+
+// Element by element in a loop, with an index expression
+for (idx = 0; idx < 6; idx++)  {
+  squares[idx] = idx * idx;
+}
+
+int32 squares_total_55 = array_sum(squares);
+int32 at_idx_expr_16 = squares[idx - 2];
+int32 nested_idx_9 = squares[squares[2] - 1];
+int32 max_25 = array_max(squares);
+int32 min_0 = array_min(squares);
+uint64 size_6 = array_size(squares);
+
+// Compound assignment, [pre|post]-fix OPR8Rs
+squares[1] += 10;
+squares[2] *= 3;
+int32 post_incr_11 = squares[1]++;
+int32 pre_decr_11 = --squares[2];
+int32 after_incr_12 = squares[1];
+
+// Stores truncate to the element's width, same as assigning to a variable
+bytes[0] = 250;
+bytes[0] += 10;
+bytes[1] = 255;
+bytes[1]++;
+uint8 byte_wrapped_4 = bytes[0];
+uint8 byte_wrapped_0 = bytes[1];
+
+array_fill(weights, 1 / 2);
+weights[3] = 5 / 2;
+array_fill(ones, 0x1);
+double weights_total_4 = array_sum(weights);
+double dot_4 = array_dot(weights, ones);
+double min_dbl_0_5 = array_min(weights);
+
+array_fill(words, "abc");
+words[1] = words[0] + "def";
+string joined = words[0] + words[1] + words[2];
+
+// Copies as many elements as the smaller array has
+uint64 copied_3 = array_copy(other, squares);
+int32 copy_sum = array_sum(other);
+
+// Elements written inside a loop can't be hoisted out of it
+int32 running = 0;
+other[0] = 0;
+for (idx = 0; idx < 4; idx++)  {
+  other[0] += squares[idx];
+  running += other[0];
+}
+int32 other_0_32 = other[0];
+int32 running_67 = running;
+
+while (squares[idx - 1] > 0)  {
+  idx--;
+}
+int32 first_zero_idx_1 = idx;
+
+print_line ("squares: " + str(squares[0]) + " " + str(squares[1]) + " " + str(squares[2]) + " " + str(squares[3]) + " " + str(squares[4]) + " " + str(squares[5]));
+print_line ("words: " + words[1] + " " + str(array_size(words)));
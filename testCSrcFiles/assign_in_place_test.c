@@ -0,0 +1,32 @@
+// Assignments and [pre|post]-fix OPR8Rs resolve their variable once, then
+// convert and store the new value in place.  Loop keeps the values unknown at
+// compile time, so the RunTimeInterpreter does all of the work
+
+uint8 small = 250;
+int16 signed_small = -3;
+uint32 accum = 0;
+int64 mixed = 100;
+string tag = "x";
+bool flip = false;
+int32 trips = 0;
+
+while (trips < 4)  {
+  trips++;
+  small++;
+  --signed_small;
+  accum += trips * 3;
+  accum <<= 1;
+  mixed -= accum;
+  mixed *= -1;
+  tag += "y";
+  flip = !flip;
+}
+
+uint8 small_254 = small;
+int16 signed_small_neg_7 = signed_small;
+uint32 accum_156 = accum;
+int64 mixed_208 = mixed;
+string tag_xyyyy = tag;
+bool flip_false = flip;
+int32 post_4 = trips++;
+int32 pre_6 = ++trips;
@@ -0,0 +1,22 @@
+// Pure sub-expressions that show up more than once in the same expression are evaluated once and
+// the saved value is re-used. Run with "-O NONE" to check the results don't change
+
+int32 one = 1, two = 2, three = 3, res_27, res_26, res_13, res_12;
+bool is_3_true;
+
+// (one * two + three) and (one * two) are each evaluated once
+res_27 = (one * two + three) * (one * two + three) + one * two;
+
+// Only one of the ternary paths gets taken, so neither path is allowed to save the shared value
+res_26 = one > two ? one * three : (one * three) * 8 + one * three - 1;
+
+// The right side of [&&] might never run, so only the left side's copy can be saved
+is_3_true = one * three > 2 && one * three < 5 && one * three != 4;
+
+// [two] gets written part way through, so (two + one) can't be shared
+res_13 = (two + one) + (two = 5) + (two + one) - 1;
+
+// Pure system calls get shared too
+string repeated = str(one + two) + "-" + str(one + two) + "-" + str(three * 4);
+res_12 = three * 4;
+print_line ("Shared: " + repeated + " " + str(res_27 + res_26 + res_13 + res_12));
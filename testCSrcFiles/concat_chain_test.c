@@ -0,0 +1,26 @@
+// A chain of [+] OPR8Rs on STRINGs gets joined into a single [+cat] OPR8R that
+// sizes the result once, instead of building a new string at every [+].
+// Run with "-O NONE" to check the results don't change.
+// Run with "-l VERBOSE -O FULL" to see which chains got joined
+
+string first = "";
+string last = "";
+string joined = "";
+string grouped = "";
+string picked = "";
+int32 trips = 0;
+
+while (trips < 3)  {
+  trips++;
+  first += "a";
+  last = last + "z";
+  joined = first + "-" + last + "-" + str(trips);
+  // Parentheses don't change the order the pieces go in
+  grouped = first + ("(" + last + ")") + "!";
+  picked = "<" + str(trips * 10) + ">" + str(trips);
+}
+
+string joined_aaa_zzz_3 = joined;
+string grouped_aaa_zzz = grouped;
+string picked_30_3 = picked;
+string literals_abcd = "a" + "b" + "c" + "d";
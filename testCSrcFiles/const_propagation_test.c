@@ -0,0 +1,68 @@
+// Variables whose value is known at compile time get swapped for that value in later expressions,
+// so those expressions can be constant folded. Run with "-O NONE" to check the results don't change.
+// Run with "-l VERBOSE -O FULL" to see what got replaced
+
+uint8 a = 3;
+uint8 b_6 = a * 2;
+uint8 c_9 = a + b_6;
+
+// [~] depends on the width of the variable's data type, which has to carry over
+uint8 narrow = 0x0F;
+uint8 not_narrow_f0 = ~narrow;
+uint32 wide = 0x0F;
+uint32 not_wide = ~wide;
+
+string greeting = "Hello";
+string hello_world = greeting + " World";
+bool is_on = true;
+bool is_off_ok = !is_on == false;
+
+// Stand-alone stores are known from there on, until the next write
+int32 step = 4;
+step = 5;
+int32 step_10 = step * 2;
+step += 1;
+int32 step_12 = step * 2;
+
+// Variables written anywhere in a loop aren't known inside of it, or after it
+int32 count = 0;
+int32 limit = 4;
+int32 loop_sum_10 = 0;
+while (count < limit)  {
+  count++;
+  loop_sum_10 += count;
+}
+int32 count_4 = count;
+
+int32 total_12 = 0;
+for (int32 idx = 0; idx < limit; idx++)  {
+  total_12 += 3;
+}
+
+// Value the loop stores isn't known either; it's whatever the last trip left behind
+int32 last_seen_3 = 0;
+int32 trips = 0;
+while (trips < 3)  {
+  trips++;
+  last_seen_3 = 1;
+  last_seen_3 = last_seen_3 + trips - 1;
+}
+
+// A store inside of a block that might not run can't be counted on after the block
+int32 maybe = 1;
+if (count > 100)
+  maybe = 2;
+int32 maybe_1 = maybe;
+if (count > 100)  {
+  maybe = 3;
+  maybe_1 = maybe;
+}
+int32 still_maybe_1 = maybe;
+
+// Inside of the block, the value stored there is the one that counts
+int32 blocked_20 = 0;
+if (count < 100)  {
+  blocked_20 = 10;
+  blocked_20 = blocked_20 * 2;
+}
+int32 after_block_20 = blocked_20;
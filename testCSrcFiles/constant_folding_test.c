@@ -0,0 +1,39 @@
+// Sub-expressions made up entirely of literals are resolved at compile time and written to the
+// interpreted file as a single literal. Run with "-O NONE" to check the results don't change
+
+int32 first = 3, last = 18;
+
+// Only the variables are left for run time: (last - first + 1)/2 * (first + last)
+int32 gauss_sum_168 = (last - first + 1)/2 * (first + last);
+int32 folded_sum_168 = (18 - 3 + 1)/2 * (3 + 18);
+
+// Same data type promotion and overflow rules as run time
+uint8 sum_0x104 = 250 + 10;
+int64 big_product = 65536 * 65536 * 1024;
+int16 negative_div_m7 = -21 / 3;
+int16 minus_folded_m9 = -(4 + 5);
+uint64 unsigned_shift_1024 = 1 << 10;
+uint32 bit_mask_0xf0 = 0xFF & ~0x0F;
+int32 mod_2 = 17 % 5;
+
+// Not evenly divisible, so [/] promotes to a DOUBLE; that one is still resolved at run time
+double three_and_a_half = 7 / 2;
+double half_of_first = first / 2;
+
+// Comparisons, short circuiting and constant conditionals
+bool is_less = 3 < 4;
+bool is_string_equal = "abc" == "abc";
+uint8 and_short_circuit_0 = 0 && first;
+uint8 or_short_circuit_1 = 1 || first;
+uint8 and_both_literals_1 = 5 > 4 && "non-empty";
+int32 picked_true_path_21 = 2 > 1 ? first + last : first - last;
+int32 picked_false_path_m15 = 2 < 1 ? first + last : first - last;
+string picked_nested = 1 == 2 ? "one" : 2 == 2 ? "two" : "three";
+
+// str() of a literal is pure; print_line() is not
+string str_of_literals = "total " + str(15 * 10) + " " + str(true) + " " + str(-1);
+print_line ("Folded: " + str(3 * 5) + " " + str_of_literals);
+
+// Parts of an expression that aren't constant are left alone
+last = first * (2 + 3) - (10 - 4);
+int32 partial_3 = last - (1 << 2) - 2 * 1;
@@ -0,0 +1,66 @@
+// [for] loops whose induction variable only moves by a constant step get their trip count worked out at loop entry
+
+// Stepping up to a literal limit
+int32 up_sum_66 = 0;
+for (int8 idx = 0; idx < 12; idx++)
+  up_sum_66 += idx;
+
+// Stepping down by more than 1 to a limit that isn't hit exactly
+int32 down_sum_30 = 0;
+int32 down_trips_6 = 0;
+for (int32 cnt = 10; cnt >= 0; cnt -= 2)  {
+  down_sum_30 += cnt;
+  down_trips_6++;
+}
+
+// Limit held in a variable the loop never writes to, with a [<=] conditional
+uint32 limit = 0x7;
+uint32 odd_sum = 0x0;
+for (uint32 odd = 0x1; odd <= limit; odd += 0x2)
+  odd_sum += odd;
+bool is_odd_sum_16 = odd_sum == 0x10;
+
+// Limit gets hoisted out in front of the loop as a loop invariant
+int32 step = 3;
+int32 hoisted_trips_6 = 0;
+for (int32 mult = 0; mult < step * 2; ++mult)
+  hoisted_trips_6++;
+
+// [!=] only counts when the step lands right on the limit
+int32 ne_trips_5 = 0;
+for (int32 ne = 0; ne != 10; ne += 2)
+  ne_trips_5++;
+
+// Never runs
+int32 never_0 = 0;
+for (int32 none = 5; none < 5; none++)
+  never_0++;
+
+// Loop variable declared outside the loop keeps its final value
+int32 outside;
+int32 outside_trips_4 = 0;
+for (outside = 1; outside < 12; outside += 3)
+  outside_trips_4++;
+bool is_outside_13 = outside == 13;
+
+// [break] gets out early, same as a regular loop
+int32 break_trips_4 = 0;
+for (int32 brk = 0; brk < 100; brk++)  {
+  break_trips_4++;
+  if (brk == 3)
+    break;
+}
+
+// Body writes the loop variable, so it's a regular loop
+int32 body_write_trips_3 = 0;
+for (int32 skip = 0; skip < 9; skip++)  {
+  skip += 2;
+  body_write_trips_3++;
+}
+
+// Nested counted loops
+int32 nested_sum_18 = 0;
+for (int32 row = 0; row < 4; row++)  {
+  for (int32 col = 0; col < 3; col++)
+    nested_sum_18 += row;
+}
@@ -0,0 +1,63 @@
+// Blocks behind a constant condition and block-local variables that never get read are removed at
+// compile time. Run with "-O NONE" to check the results don't change; the removed variables just
+// won't show up in the variable dump. Run with "-l VERBOSE -O FULL" to see what was removed
+
+int32 first = 3, last = 18;
+
+// Statically false [if] is removed; the [else if] after it has to start the chain
+int8 expect_block_2 = -1;
+if (1 > 2)  {
+  expect_block_2 = 1;
+} else if (first < last)  {
+  expect_block_2 = 2;
+} else  {
+  expect_block_2 = 3;
+}
+
+// Statically true [else if] makes everything after it unreachable
+int8 expect_block_3 = -1;
+if (first > last)
+  expect_block_3 = 1;
+else if (2 * 3 == 7)
+  expect_block_3 = 2;
+else if (true)  {
+  expect_block_3 = 3;
+} else if (first == 3)  {
+  expect_block_3 = 4;
+} else
+  expect_block_3 = 5;
+
+// Only the [else] is left; it runs unconditionally
+int8 expect_else_4 = -1;
+if (0)
+  expect_else_4 = 1;
+else if ("" == "x")
+  expect_else_4 = 2;
+else
+  expect_else_4 = 4;
+
+// Nothing left at all
+int8 expect_untouched_m1 = -1;
+if (false)  {
+  expect_untouched_m1 = 1;
+  if (first < last)
+    expect_untouched_m1 = 2;
+}
+
+// Block-local variables and stores nobody reads
+int32 sum_42 = 0;
+if (first < last)  {
+  int32 unused = 15, scratch;
+  int32 kept = first * 14;
+  scratch = 99;
+  unused = 7;
+  sum_42 = kept;
+}
+
+// A declaration where only some of the variables are unread
+int32 product_108 = 0;
+if (sum_42 > 0)  {
+  int32 never_read = 5, six = 6, not_either;
+  product_108 = six * last;
+  never_read = 1;
+}
@@ -0,0 +1,53 @@
+// Files get streamed through large buffers rather than read in whole.
+// read_line() drops "\n" & "\r\n"; is_eof() is true once nothing's left.
+// Reads file_io_test_input.txt; writes & reads back a scratch file in /tmp.
+
+int64 in_file = open_file("file_io_test_input.txt", "r");
+uint32 num_lines = 0;
+string all_lines = "";
+uint64 cafe_len_7 = 0;
+string line;
+while (!is_eof(in_file)) {
+  line = read_line(in_file);
+  if (num_lines == 3)
+    cafe_len_7 = length(line);
+  all_lines = all_lines + "[" + substr(line, 0, 3) + "]";
+  num_lines++;
+}
+string past_end_empty = read_line(in_file);
+int32 close_in_0 = close_file(in_file);
+
+// Chunks keep line endings; a multi-byte UTF-8 character counts as 1
+int64 chunk_file = open_file("file_io_test_input.txt", "r");
+string chunk_name = read_chunk(chunk_file, 4);
+uint64 skipped_len_24 = length(read_chunk(chunk_file, 24));
+string chunk_last = read_chunk(chunk_file, 4);
+int32 close_chunk_0 = close_file(chunk_file);
+
+// Round trip through a file this program writes
+string scratch_path = "/tmp/file_io_test_scratch.txt";
+int64 out_file = open_file(scratch_path, "w");
+int64 wrote_6 = write_line(out_file, "line1");
+int64 wrote_5 = write_file(out_file, "line2");
+int32 close_out_0 = close_file(out_file);
+int64 append_file = open_file(scratch_path, "a");
+int64 wrote_6_more = write_line(append_file, "+more");
+write_file(append_file, "Z");
+close_file(append_file);
+
+int64 back_file = open_file(scratch_path, "r");
+string read_back_1 = read_line(back_file);
+string read_back_2 = read_line(back_file);
+string read_back_3 = read_line(back_file);
+bool at_end = is_eof(back_file);
+close_file(back_file);
+
+// Closed handles get handed out again
+int64 held_handle_0 = open_file(scratch_path, "r");
+int64 next_handle_1 = open_file(scratch_path, "r");
+close_file(held_handle_0);
+int64 reused_handle_0 = open_file(scratch_path, "r");
+close_file(next_handle_1);
+close_file(reused_handle_0);
+
+int64 missing_m1 = open_file("no_such_dir/no_such_file.txt", "r");
@@ -0,0 +1,54 @@
+// Compile and run with "-P <profile file>" to count how many times each [if] [else if] [else] block
+// runs. The next compile with the same profile file checks the busiest blocks of a chain 1st, as
+// long as every conditional compares the same integer variable against a different literal.
+// Run with "-l VERBOSE -O FULL -P <profile file>" twice to see the reordering; results don't change.
+
+uint32 kind = 0;
+uint32 ones_4 = 0;
+uint32 twos_0 = 0;
+uint32 threes_16 = 0;
+uint32 others_0 = 0;
+
+for (uint32 idx = 0; idx < 20; idx++)  {
+  kind = idx % 5 == 0 ? 1 : 3;
+  if (kind == 1)
+    ones_4++;
+  else if (kind == 2)
+    twos_0++;
+  else if (3 == kind)  {
+    threes_16++;
+  } else
+    others_0++;
+}
+
+// [<] conditionals overlap, so the 1st one that's TRUE has to win; this chain stays as is
+uint32 small_5 = 0;
+uint32 big_15 = 0;
+uint32 level = 0;
+while (level < 20)  {
+  if (level < 5)
+    small_5++;
+  else if (level < 100)
+    big_15++;
+  level++;
+}
+
+// Chain inside of a block gets its own order
+uint32 mode = 0;
+uint32 red_1 = 0;
+uint32 green_0 = 0;
+uint32 blue_5 = 0;
+uint32 rounds = 0;
+while (rounds < 6)  {
+  mode = rounds < 5 ? 2 : 0;
+  if (rounds < 10)  {
+    if (mode == 0)  {
+      red_1++;
+    } else if (mode == 1)  {
+      green_0++;
+    } else if (mode == 2)  {
+      blue_5++;
+    }
+  }
+  rounds++;
+}
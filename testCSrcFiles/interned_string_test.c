@@ -0,0 +1,29 @@
+// String literals & variable names are interned when they're read back in, so
+// copying a STRING only copies a pointer and [==] between 2 literals is a
+// pointer compare.  Strings built at run time still compare by their characters
+
+string picked = "";
+string built = "";
+uint32 literal_hits_2 = 0;
+uint32 built_hits_1 = 0;
+uint32 ordered_4 = 0;
+int32 trips = 0;
+
+while (trips < 4)  {
+  trips++;
+  picked = trips == 1 ? "one" : trips == 2 ? "two" : "many";
+  built += "o";
+  if (picked == "many")
+    literal_hits_2++;
+  if ("f" + built == "foo")
+    built_hits_1++;
+  if (picked < "p" || picked > "tw")
+    ordered_4++;
+}
+
+string picked_many = picked;
+string built_oooo = built;
+bool is_same_true = picked == "many";
+bool is_diff_true = built != "ooo";
+bool is_less_true = "many" < "manz";
+bool is_gr8r_eq_true = built >= "oooo";
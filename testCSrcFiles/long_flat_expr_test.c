@@ -0,0 +1,17 @@
+// Long expressions with no parentheses; the tree shape comes entirely from OPR8R precedence.
+// Run with "-p PRATT" to check the Pratt parser against the precedence level parser
+
+int32 one = 1, two = 2, three = 3, four = 4, five = 5;
+
+int32 flat_sum_55 = one + two + three + four + five + 6 + 7 + 8 + 9 + 10;
+int32 flat_mixed_38 = one + two * three - four + five * 6 * 7 - 8 * 9 - 10 * 5 + 100 - 200 + 300 / 3 - four - five * 10 + one;
+int32 flat_left_to_right_0 = 100 - 50 - 25 - 12 - 6 - 3 - 2 - one - one;
+uint32 flat_shift_mask_7 = 1 << 4 << 1 >> 2 >> 1 & 15 | 1 << 2 | 2 | 1 ^ 0;
+bool flat_logical_true = one < two && two <= three || four > five && five >= 6 || 7 == 8 && 9 != 10;
+int32 flat_ternary_30 = one > two ? 10 : two > three ? 20 : three < four ? 30 : 40;
+int32 flat_unary_m17 = -one + -two * -three - four - 9 - +5 * two + !0 - !one + ++five - five--;
+
+int32 chain_134, chain_312, chain_176;
+chain_134 = 5 + 4 * 3 - 2 * 1 + 10 * 10 - 50 / 5 % 3 + one * two * three * four * five - 100;
+chain_312 = chain_134 * 2 - chain_134 + chain_134 % 5 * 5 - chain_134 % 7 + 3 << 1;
+chain_176 = chain_134 < chain_312 ? chain_312 - chain_134 + one * 2 - 3 + 4 - 5 : chain_134 + chain_312 * 2;
@@ -0,0 +1,54 @@
+// Sub-expressions that don't change inside a loop get computed once, in front of the loop
+
+uint32 limit = 0x5;
+uint32 step = 0x3;
+int32 offset = 7;
+
+// [limit * 2] in the conditional & [step * step + offset] in the body are invariant
+uint32 idx = 0x0;
+int32 while_sum_130 = 0;
+while (idx < limit * 2)  {
+  while_sum_130 += step * step + offset - 3;
+  idx++;
+}
+
+// Same sub-expression twice in the body shares 1 slot
+int32 for_sum_320 = 0;
+for (int32 cnt = 0; cnt < 10; cnt++)
+  for_sum_320 += (step * step + offset) + (step * step + offset) + cnt - cnt;
+
+// [base] is written inside of the loop, so [base * step] can't be hoisted
+uint32 base = 0x1;
+uint32 base_sum_48 = 0x0;
+for (uint32 loop = 0x0; loop < 0x4; loop++)  {
+  base_sum_48 += base * step;
+  base += 0x2;
+}
+
+// Inner loop's invariants go in front of the inner loop; [outer] is invariant to the inner loop only
+int32 nested_sum_75 = 0;
+int32 outer = 0;
+int32 inner;
+while (outer < 3)  {
+  inner = 0;
+  while (inner < 5)  {
+    nested_sum_75 += outer * 2 + offset * 1 - 5 + (limit == 0x5 ? 1 : 0);
+    inner++;
+  }
+  outer++;
+}
+
+// Body never runs, so a division that could blow up must stay inside the loop
+uint32 zero = 0x0;
+uint32 never_0 = 0x0;
+while (zero > 0x0)  {
+  never_0 += limit / zero + (limit & step);
+  zero--;
+}
+
+// Pure system call with invariant parameters
+string label = "";
+for (int32 rep = 0; rep < 3; rep++)
+  label = label + str(limit * step);
+
+bool is_label_ok = label == "0xf0xf0xf";
@@ -0,0 +1,44 @@
+// Math system calls run natively rather than as loops & ternaries in the
+// source language.  Integer parameters give integer results and doubles give
+// doubles; sqrt() always gives a double.
+// Calls with literal parameters get resolved at compile time.
+// Run with "-O NONE" to check the results don't change.
+
+int32 neg = -17;
+int32 pos = 42;
+uint8 small = 3;
+double half = 1 / 2;
+double neg_two_and_a_half = -5 / 2;
+
+int32 min_m17 = min(neg, pos);
+int32 max_42 = max(neg, pos);
+int32 min_mixed_m17 = min(small, neg);
+uint8 max_mixed_3 = max(small, neg);
+double min_dbl_m2_5 = min(half, neg_two_and_a_half);
+double max_dbl_0_5 = max(neg_two_and_a_half, half);
+
+int32 abs_17 = abs(neg);
+uint8 abs_3 = abs(small);
+double abs_2_5 = abs(neg_two_and_a_half);
+
+int64 pow_1024 = pow(2, 10);
+int64 pow_m27 = pow(neg / 17 * 3, 3);
+int32 pow_neg_exp_0 = pow(pos, -1);
+int32 pow_m1_odd = pow(-1, -3);
+double pow_dbl_0_25 = pow(half, 2);
+
+double sqrt_1_5 = sqrt(9 / 4);
+double sqrt_of_int_3 = sqrt(9);
+
+double floor_m3 = floor(neg_two_and_a_half);
+int32 floor_int_42 = floor(pos);
+
+// Nested and in the middle of expressions
+int32 clamp_10 = max(0, min(pos, 10));
+int32 sum_59 = abs(neg) + max(neg, pos);
+uint32 loop_total = 0;
+uint32 idx;
+for (idx = 0; idx < 5; idx++)
+  loop_total += pow(idx, 2);
+uint32 loop_total_30 = loop_total;
+string shown = "[" + str(min(neg, pos)) + "|" + str(sqrt(2)) + "]";
@@ -0,0 +1,23 @@
+// Inner loops open and close their scope on every trip of the outer loop. Closed scopes get reused
+// for the next one opened, so each reopened scope has to start out empty.
+
+uint32 outer = 0;
+uint32 inner_sum_135 = 0;
+int64 signed_sum_neg_30 = 0;
+string letters_9 = "";
+
+while (outer < 3)  {
+  for (uint32 up = 0; up < 10; up++)  {
+    inner_sum_135 += up;
+  }
+
+  for (int64 down = -1; down > -5; down--)  {
+    signed_sum_neg_30 += down;
+  }
+
+  for (string letter = "a"; letter != "aaa"; letter += "a")  {
+    letters_9 += letter;
+  }
+
+  outer++;
+}
@@ -0,0 +1,30 @@
+// str() formats each data type the way the variable dump shows it:
+// unsigned in hex, signed in decimal and doubles with as few digits as it
+// takes to get the exact same double back.
+
+uint8 u8 = 255;
+uint16 u16 = 0xFACE;
+uint32 u32 = 0;
+uint64 u64 = 0xFFFFFFFF * 0x100000001;
+int8 i8 = -128;
+int16 i16 = -32768;
+int32 i32 = 2147483647;
+int64 i64 = -9000000000000000000;
+double whole = 5 / 2 * 2;
+double tenth = 1 / 10;
+double third = 1 / 3;
+double neg_half = -1 / 2;
+
+string u8_0xff = str(u8);
+string u16_0xface = str(u16);
+string u32_0x0 = str(u32);
+string u64_all_fs = str(u64);
+string i8_m128 = str(i8);
+string i16_m32768 = str(i16);
+string i32_max = str(i32);
+string i64_m9e18 = str(i64);
+string whole_5_0 = str(whole);
+string tenth_0_1 = str(tenth);
+string third_shortest = str(third);
+string neg_half_m0_5 = str(neg_half);
+string in_a_chain = "[" + str(i8) + "|" + str(u8) + "|" + str(third) + "]";
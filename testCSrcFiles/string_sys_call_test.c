@@ -0,0 +1,46 @@
+// String system calls run natively.  Parameters get read where they sit
+// rather than copied out of their variables, and a result that's all of a
+// parameter shares its characters.
+// Calls with literal parameters get resolved at compile time.
+// Run with "-O NONE" to check the results don't change.
+
+string csv = "alpha,beta,,gamma";
+string greeting = "Hello, World";
+string empty = "";
+
+uint64 len_17 = length(csv);
+uint64 len_0 = length(empty);
+uint64 len_lit_5 = length("abcde");
+
+int64 find_6 = find(csv, "beta");
+int64 find_missing = find(csv, "delta");
+int64 find_concat_0 = find(csv, "a" + "lpha");
+int64 find_empty_0 = find(csv, empty);
+
+string substr_beta = substr(csv, 6, 4);
+string substr_whole = substr(greeting, 0, 100);
+string substr_tail = substr(greeting, 7, 100);
+string substr_past_end = substr(greeting, 50, 2);
+
+string replace_all = replace(csv, ",", " | ");
+string replace_none = replace(greeting, "xyz", "abc");
+string replace_shrink = replace("aaaa", "aa", "b");
+
+uint64 count_4 = split_count(csv, ",");
+uint64 count_1 = split_count(greeting, ";");
+string field_0 = split_field(csv, ",", 0);
+string field_2_empty = split_field(csv, ",", 2);
+string field_3 = split_field(csv, ",", 3);
+string field_9_none = split_field(csv, ",", 9);
+
+int32 cmp_same = compare_ignore_case(greeting, "hELLO, wORLD");
+int32 cmp_less = compare_ignore_case("apple", "Banana");
+int32 cmp_more = compare_ignore_case("apples", "APPLE");
+
+// Nested and in loops
+string world = substr(greeting, find(greeting, "W"), length("World"));
+uint32 idx;
+string all_fields = "";
+for (idx = 0; idx < split_count(csv, ","); idx++)
+  all_fields = all_fields + "<" + split_field(csv, ",", idx) + ">";
+string joined = all_fields;
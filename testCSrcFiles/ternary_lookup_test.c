@@ -0,0 +1,42 @@
+// Chains of [?] that compare 1 integer variable against different literals get turned into a lookup table
+
+// Keys without gaps; out of order in the source
+int32 dense_sum_14 = 0;
+string dense_str = "";
+for (int32 cnt = 0; cnt < 5; cnt++)  {
+  dense_str = dense_str + (cnt == 2 ? "b" : cnt == 0 ? "z" : cnt == 1 ? "a" : cnt == 3 ? "c" : "?");
+  dense_sum_14 += cnt == 1 ? 1 : cnt == 2 ? 2 : cnt == 3 ? 3 : 4;
+}
+bool is_dense_str_ok = dense_str == "zabc?";
+
+// Keys with gaps get searched; key can be on either side of the [==]
+uint32 code = 0x0;
+string sparse_str = "";
+while (code < 0x70)  {
+  sparse_str = sparse_str + (code == 0x40 ? "F" : 0x10 == code ? "B" : code == 0x20 ? "C" : code == 0x60 ? "L" : ".");
+  code += 0x10;
+}
+bool is_sparse_str_ok = sparse_str == ".BC.F.L";
+
+// Negative selector can't match a key
+int32 neg = -1;
+string neg_many = neg == 0 ? "zero" : neg == 1 ? "one" : neg == 2 ? "two" : "many";
+
+// Only the selected value gets evaluated
+int32 pick = 2;
+int32 hit_one = 0, hit_two_1 = 0, hit_three = 0, hit_other = 0;
+pick == 1 ? hit_one = 1 : pick == 2 ? hit_two_1 = 1 : pick == 3 ? hit_three = 1 : hit_other = 1;
+pick = 7;
+pick == 1 ? hit_one = 1 : pick == 2 ? hit_two_1 = 1 : pick == 3 ? hit_three = 1 : hit_other = hit_other + 5;
+int32 hit_other_5 = hit_other;
+
+// Values can be whole sub-expressions, including another chain on a different variable
+int32 row = 1, col = 3;
+int32 nested_13 = row == 0 ? col * 2 : row == 1 ? (col == 1 ? 11 : col == 2 ? 12 : col == 3 ? 13 : 19) : row == 2 ? 20 : 99;
+
+// Repeated key isn't turned into a table; 1st one still wins
+int32 dup = 3;
+string dup_first = dup == 3 ? "first" : dup == 3 ? "second" : dup == 4 ? "four" : "none";
+
+// Too short to bother with
+string short_two = pick == 7 ? "seven" : pick == 8 ? "eight" : "other";
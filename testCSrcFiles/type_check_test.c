@@ -0,0 +1,34 @@
+// Data types are checked, and reads of uninitialized variables flagged, without 
+// evaluating anything at compile time
+uint8 neverSet, setLater;
+int16 minusTen = -10;
+string greeting = "Hello";
+
+// Should get messages about using unitialized variables
+// Uninitialized variable used - USER_WORD_TKN(U)->[neverSet]   System call parameter
+// Uninitialized variable used - USER_WORD_TKN(U)->[setLater]   Compound assignment reads the variable too
+string neverSetStr = str(neverSet);
+setLater += 1;
+
+// No message; [=] only writes to its left operand, and setLater is initialized from here on
+setLater = 5;
+uint8 six = setLater + 1;
+
+// Mixed data types that resolve at run time
+int16 minusFive = minusTen / 2;
+uint32 bits = 0xF0 | setLater;
+bool isNegative = minusFive < 0 ? true : false;
+string greetingStr = greeting + " World " + str(bits) + " " + str(minusFive);
+int16 abs_minusTen = minusTen < 0 ? -minusTen : minusTen;
+
+// IMPROPER: Data type contention caught before anything is written to the interpreted file
+// greeting = greeting * 2;
+// USER ERROR MESSAGES: Unique messages = 1; Total messages = 1;
+// OPR8R [*] cannot be applied to [string] and [signed integer]
+// type_check_test.c:25:21
+//
+// minusTen = "ten";
+// Cannot assign [string] to variable [minusTen] of type int16
+//
+// print_line (minusTen);
+// Parameter 1 of system call [print_line] expects [string] but got [signed integer]
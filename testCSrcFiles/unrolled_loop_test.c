@@ -0,0 +1,61 @@
+// [for] loops with a trip count known at compile time get unrolled
+
+// Few enough trips to unroll completely
+int32 full_sum_10 = 0;
+for (int32 idx = 0; idx < 5; idx++)
+  full_sum_10 += idx;
+
+// Too many trips to unroll completely; unrolled blocks get repeated & the leftover trips go at the end
+int32 partial_sum_231 = 0;
+int32 partial_trips_21 = 0;
+for (int32 cnt = 1; cnt <= 21; cnt++)  {
+  partial_sum_231 += cnt;
+  partial_trips_21++;
+}
+
+// Counting down by more than 1, with an [if] in the body
+int32 even_hits_3 = 0;
+int32 odd_hits_2 = 0;
+for (int32 down = 9; down > 0; down -= 2)  {
+  if (down % 4 == 1)
+    even_hits_3++;
+  else
+    odd_hits_2++;
+}
+
+// Loop variable declared outside the loop still ends up where the loop leaves it
+uint32 outside;
+uint32 outside_sum = 0x0;
+for (outside = 0x2; outside < 0x20; outside += 0x3)
+  outside_sum += outside;
+bool is_outside_sum_155 = outside_sum == 0x9B;
+bool is_outside_32 = outside == 0x20;
+
+// Loop invariant gets hoisted in front of an unrolled loop
+int32 scale = 3;
+int32 scaled_sum_36 = 0;
+for (int32 rep = 0; rep < 4; rep++)
+  scaled_sum_36 += scale * 3;
+
+// Unrolled loop inside of a [while] loop
+int32 outer = 0;
+int32 nested_sum_18 = 0;
+int32 inner;
+while (outer < 3)  {
+  for (inner = 0; inner < 3; inner++)
+    nested_sum_18 += outer + inner;
+  outer++;
+}
+
+// Loops with a [break] or a declaration in the body aren't unrolled
+int32 break_trips_3 = 0;
+for (int32 brk = 0; brk < 6; brk++)  {
+  break_trips_3++;
+  if (brk == 2)
+    break;
+}
+
+// Never runs
+int32 never_0 = 0;
+for (int32 none = 4; none < 4; none++)
+  never_0++;
@@ -21,6 +21,7 @@ print ("\n****************************************")
 
 src_directory = ""
 executable = ""
+expr_parser = ""
 idx = 1
 isFailed = False
 while idx < numArgs and not isFailed:
@@ -39,6 +40,14 @@ while idx < numArgs and not isFailed:
         else:
             executable = sys.argv[idx]
 
+    elif flag == "-p" or flag == "--expr_parser":
+        # Optional; passed through to the executable to pick the expression parser [PRECEDENCE_LVL|PRATT]
+        idx += 1
+        if idx >= numArgs:
+            isFailed = True
+        else:
+            expr_parser = sys.argv[idx]
+
     # Increment loop counter
     idx += 1
 
@@ -76,7 +85,10 @@ if not isFailed:
                 #    isFailed = True
 
             if not isFailed:
-                process_ret = subprocess.run([executable, src_file_path, "-l", verbosity_lvl], capture_output=True)
+                exec_args = [executable, src_file_path, "-l", verbosity_lvl]
+                if expr_parser != "":
+                    exec_args.extend(["-p", expr_parser])
+                process_ret = subprocess.run(exec_args, capture_output=True)
                 with open(outfile_path, "ab") as outfile:
                     outfile.write(process_ret.stdout)
 